@@ -0,0 +1,144 @@
+#include "AI/AIServiceSchedulerSubsystem.h"
+#include "AI/BTService_Scheduled.h"
+#include "AI/PlayerSpatialGridSubsystem.h"
+#include "AIController.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "Character/EnemyCharacter.h"
+#include "Engine/World.h"
+
+TStatId UAIServiceSchedulerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAIServiceSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+EAIServicePriority UAIServiceSchedulerSubsystem::ClassifyOwner(const UBehaviorTreeComponent& OwnerComp) const
+{
+    const AAIController* AIC = OwnerComp.GetAIOwner();
+    const APawn* Pawn = AIC ? AIC->GetPawn() : nullptr;
+    if (!Pawn) return EAIServicePriority::Far;
+
+    if (const AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Pawn))
+    {
+        if (Enemy->IsAggro()) return EAIServicePriority::Combat;
+    }
+
+    if (UPlayerSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UPlayerSpatialGridSubsystem>())
+    {
+        if (Grid->FindNearestPlayer(Pawn->GetActorLocation(), NearPlayerRadius))
+        {
+            return EAIServicePriority::Near;
+        }
+    }
+    return EAIServicePriority::Far;
+}
+
+void UAIServiceSchedulerSubsystem::RequestUpdate(UBehaviorTreeComponent& OwnerComp, UBTService_Scheduled& Service, FBTScheduledServiceMemory& Memory)
+{
+    // 이미 대기 중이면 누적 DeltaSeconds 만 반영하고 합침
+    if (Memory.bQueued)
+    {
+        ++SkippedSinceTick;
+        return;
+    }
+
+    const EAIServicePriority Priority = ClassifyOwner(OwnerComp);
+    const int32 Stride = FMath::Max(1, RequestStride[static_cast<int32>(Priority)]);
+    if (++Memory.RequestsSinceRun < Stride)
+    {
+        ++SkippedSinceTick;
+        return;
+    }
+
+    Memory.bQueued = true;
+
+    FPendingRequest& Request = Pending.AddDefaulted_GetRef();
+    Request.OwnerComp = &OwnerComp;
+    Request.Service = &Service;
+    Request.Priority = Priority;
+    Request.RequestFrame = GFrameCounter;
+}
+
+bool UAIServiceSchedulerSubsystem::ExecuteRequest(const FPendingRequest& Request)
+{
+    UBehaviorTreeComponent* OwnerComp = Request.OwnerComp.Get();
+    UBTService_Scheduled* Service = Request.Service.Get();
+    if (!OwnerComp || !Service) return false;
+
+    // 요청 후 서브트리가 내려갔으면 메모리도 사라졌으므로 건너뜀
+    const int32 InstanceIdx = OwnerComp->FindInstanceContainingNode(Service);
+    if (InstanceIdx == INDEX_NONE) return false;
+
+    uint8* NodeMemory = OwnerComp->GetNodeMemory(Service, InstanceIdx);
+    FBTScheduledServiceMemory* Memory = reinterpret_cast<FBTScheduledServiceMemory*>(NodeMemory);
+
+    // 메모리가 다시 초기화된 경우 (트리 재시작) 이 요청은 무효
+    if (!Memory || !Memory->bQueued) return false;
+    Memory->bQueued = false;
+
+    if (!OwnerComp->IsAuxNodeActive(Service, InstanceIdx)) return false;
+
+    const float Delta = Memory->PendingDeltaSeconds;
+    Memory->PendingDeltaSeconds = 0.f;
+    Memory->RequestsSinceRun = 0;
+
+    Service->TickScheduled(*OwnerComp, NodeMemory, Delta);
+    return true;
+}
+
+void UAIServiceSchedulerSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    Stats.ExecutedLastFrame = 0;
+    Stats.DeferredLastFrame = 0;
+    Stats.SkippedLastFrame = SkippedSinceTick;
+    Stats.LastFrameMs = 0.f;
+    SkippedSinceTick = 0;
+
+    if (Pending.Num() == 0)
+    {
+        Stats.TotalSkipped += Stats.SkippedLastFrame;
+        return;
+    }
+
+    // 우선순위 → 오래 기다린 순
+    Pending.StableSort([](const FPendingRequest& A, const FPendingRequest& B)
+    {
+        if (A.Priority != B.Priority) return A.Priority < B.Priority;
+        return A.RequestFrame < B.RequestFrame;
+    });
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = FrameBudgetMs * 0.001;
+
+    TArray<FPendingRequest> Deferred;
+    for (const FPendingRequest& Request : Pending)
+    {
+        const bool bOverBudget = (FPlatformTime::Seconds() - StartTime) >= BudgetSeconds;
+        const bool bStarving = (GFrameCounter - Request.RequestFrame) >= static_cast<uint64>(MaxDeferredFrames);
+
+        // 최소 1개는 실행해서 예산이 0 이어도 진행되도록 함
+        if (bOverBudget && !bStarving && Stats.ExecutedLastFrame > 0)
+        {
+            Deferred.Add(Request);
+            continue;
+        }
+
+        if (ExecuteRequest(Request))
+        {
+            ++Stats.ExecutedLastFrame;
+        }
+        else
+        {
+            ++Stats.SkippedLastFrame;
+        }
+    }
+
+    Pending = MoveTemp(Deferred);
+
+    Stats.DeferredLastFrame = Pending.Num();
+    Stats.LastFrameMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Stats.TotalExecuted += Stats.ExecutedLastFrame;
+    Stats.TotalDeferred += Stats.DeferredLastFrame;
+    Stats.TotalSkipped += Stats.SkippedLastFrame;
+}
@@ -0,0 +1,31 @@
+#include "AI/BTService_Scheduled.h"
+#include "AI/AIServiceSchedulerSubsystem.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "Engine/World.h"
+
+void UBTService_Scheduled::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+    new (NodeMemory) FBTScheduledServiceMemory();
+}
+
+void UBTService_Scheduled::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+
+    FBTScheduledServiceMemory* Memory = reinterpret_cast<FBTScheduledServiceMemory*>(NodeMemory);
+    Memory->PendingDeltaSeconds += DeltaSeconds;
+
+    UWorld* World = OwnerComp.GetWorld();
+    UAIServiceSchedulerSubsystem* Scheduler = (bUseScheduler && World) ? World->GetSubsystem<UAIServiceSchedulerSubsystem>() : nullptr;
+    if (Scheduler)
+    {
+        Scheduler->RequestUpdate(OwnerComp, *this, *Memory);
+        return;
+    }
+
+    // 스케줄러가 없으면 즉시 실행
+    const float Delta = Memory->PendingDeltaSeconds;
+    Memory->PendingDeltaSeconds = 0.f;
+    Memory->RequestsSinceRun = 0;
+    TickScheduled(OwnerComp, NodeMemory, Delta);
+}
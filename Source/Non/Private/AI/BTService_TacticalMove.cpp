@@ -1,22 +1,51 @@
 #include "AI/BTService_TacticalMove.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
-#include "NavigationSystem.h"
-#include "NavigationPath.h"
+#include "AI/NavQueryBatchSubsystem.h"
 #include "DrawDebugHelpers.h"
 
+namespace
+{
+    // 모든 인스턴스가 공유하는 단조 증가 세대 (트리 재시작으로 메모리가 초기화돼도 이전 세대와 겹치지 않음)
+    uint32 GTacticalMoveQueryGeneration = 0;
+}
+
 UBTService_TacticalMove::UBTService_TacticalMove()
 {
     bNotifyTick = true;
     Interval = 1.5f;        // 0.5f -> 1.5f (너무 정신없지 않게 수정)
     RandomDeviation = 0.2f;
     NodeName = TEXT("Tactical Move (C++)");
+    bNotifyCeaseRelevant = true;
+}
+
+void UBTService_TacticalMove::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+    new (NodeMemory) FBTTacticalMoveMemory();
+}
+
+void UBTService_TacticalMove::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    // 대기 중인 질의 결과가 비활성화 이후 블랙보드를 덮어쓰지 않도록 세대 증가
+    reinterpret_cast<FBTTacticalMoveMemory*>(NodeMemory)->QueryGeneration = ++GTacticalMoveQueryGeneration;
+
+    Super::OnCeaseRelevant(OwnerComp, NodeMemory);
 }
 
-void UBTService_TacticalMove::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+bool UBTService_TacticalMove::IsQueryCurrent(UBehaviorTreeComponent* OwnerComp, UBTService_TacticalMove* Service, uint32 Generation)
 {
-    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+    if (!OwnerComp || !Service) return false;
 
+    const int32 InstanceIdx = OwnerComp->FindInstanceContainingNode(Service);
+    if (InstanceIdx == INDEX_NONE || !OwnerComp->IsAuxNodeActive(Service, InstanceIdx)) return false;
+
+    const FBTTacticalMoveMemory* Memory = reinterpret_cast<const FBTTacticalMoveMemory*>(OwnerComp->GetNodeMemory(Service, InstanceIdx));
+    return Memory && Memory->QueryGeneration == Generation;
+}
+
+void UBTService_TacticalMove::TickScheduled(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
     AAIController* AIC = OwnerComp.GetAIOwner();
     UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
     if (!AIC || !BB) return;
@@ -32,106 +61,118 @@ void UBTService_TacticalMove::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
     const FVector TargetLoc = TargetActor->GetActorLocation();
     const float Dist = FVector::Dist2D(MyLoc, TargetLoc);
 
-    FVector NewDest = FVector::ZeroVector;
-    bool bFound = false;
     UWorld* World = AIC->GetWorld();
+    FBTTacticalMoveMemory* Memory = reinterpret_cast<FBTTacticalMoveMemory*>(NodeMemory);
 
     // 1. 너무 가까우면 -> Backstep (회피)
-    if (Dist < ToCloseDistance)
-    {
-        bFound = GetBackstepLocation(World, MyLoc, TargetLoc, NewDest);
-    }
     // 2. 적정 사거리 안쪽이면 -> Strafe (좌우) 시도
-    else if (Dist <= MaxTacticalRange)
+    //    후보 지점을 모아 NavMesh 질의 배치에 넘기고, 결과가 오면 블랙보드 기록
+    if (Dist <= MaxTacticalRange)
     {
-        // Strafe 확률 체크
-        if (FMath::FRand() <= StrafeChance)
+        FNavCandidateQuery Query;
+        Query.Owner = AIC;
+        Query.ScoreTarget = TargetLoc;
+
+        if (Dist < ToCloseDistance)
         {
-             bFound = GetStrafeLocation(World, MyLoc, TargetLoc, NewDest);
+            BuildBackstepCandidates(MyLoc, TargetLoc, Query.Candidates);
+            Query.DesiredDistance = Dist + StrafeStepDistance * 0.8f;
+        }
+        else if (FMath::FRand() <= StrafeChance)
+        {
+            BuildStrafeCandidates(MyLoc, TargetLoc, Query.Candidates);
+            // 타겟을 중심으로 도는 느낌이 나도록 현재 거리 유지
+            Query.DesiredDistance = Dist;
         }
         else
         {
-            // 확률 안 걸리면 그냥 타겟 바라보거나 제자리 대기
-            // 여기서는 '현재 위치' 혹은 '타겟 위치'를 넣어서 
-            // 너무 멀어지지 않게 관리할 수도 있음.
-            // 일단은 bFound = false 로 둬서 이전 이동 유지 or 멈춤
+            // 확률 안 걸리면 이전 이동 유지 or 멈춤
+            return;
         }
+
+        UNavQueryBatchSubsystem* NavBatch = World ? World->GetSubsystem<UNavQueryBatchSubsystem>() : nullptr;
+        if (!NavBatch) return;
+
+        // 이번 질의 세대: 결과가 오기 전에 새 질의를 보내거나 비활성화되면 이 결과는 버림
+        Memory->QueryGeneration = ++GTacticalMoveQueryGeneration;
+
+        TWeakObjectPtr<UBehaviorTreeComponent> WeakOwnerComp = &OwnerComp;
+        TWeakObjectPtr<UBTService_TacticalMove> WeakService = this;
+        TWeakObjectPtr<APawn> WeakPawn = Pawn;
+        const uint32 Generation = Memory->QueryGeneration;
+        const FName LocationKeyName = TargetLocationKey.SelectedKeyName;
+        const bool bDraw = bDebugDraw;
+
+        Query.OnResolved = [WeakOwnerComp, WeakService, WeakPawn, Generation, LocationKeyName, bDraw](bool bFound, const FVector& NewDest)
+        {
+            if (!bFound) return;
+
+            UBehaviorTreeComponent* ResolvedOwnerComp = WeakOwnerComp.Get();
+            if (!IsQueryCurrent(ResolvedOwnerComp, WeakService.Get(), Generation)) return;
+
+            UBlackboardComponent* ResolvedBB = ResolvedOwnerComp->GetBlackboardComponent();
+            if (!ResolvedBB) return;
+
+            ResolvedBB->SetValueAsVector(LocationKeyName, NewDest);
+
+            APawn* ResolvedPawn = WeakPawn.Get();
+            if (bDraw && ResolvedPawn)
+            {
+                UWorld* DrawWorld = ResolvedPawn->GetWorld();
+                DrawDebugSphere(DrawWorld, NewDest, 30.f, 12, FColor::Purple, false, 0.6f);
+                DrawDebugLine(DrawWorld, ResolvedPawn->GetActorLocation(), NewDest, FColor::Purple, false, 0.6f, 0, 2.f);
+            }
+        };
+
+        NavBatch->SubmitQuery(MoveTemp(Query));
+        return;
     }
+
     // 3. 멀면 -> 추격(Chase)
     //    Behavior Tree 구조상 "추격" 노드가 따로 없다면, 여기서 위치를 갱신해줘야 함.
-    else
+    //    대기 중인 전술 질의가 나중에 덮어쓰지 않도록 취소 (이미 처리 중인 결과는 세대로 걸러짐)
+    Memory->QueryGeneration = ++GTacticalMoveQueryGeneration;
+    if (UNavQueryBatchSubsystem* NavBatch = World ? World->GetSubsystem<UNavQueryBatchSubsystem>() : nullptr)
     {
-        NewDest = TargetLoc;
-        bFound = true;
+        NavBatch->CancelQueries(AIC);
     }
 
-    if (bFound)
+    BB->SetValueAsVector(TargetLocationKey.SelectedKeyName, TargetLoc);
+
+    if (bDebugDraw && World)
     {
-        BB->SetValueAsVector(TargetLocationKey.SelectedKeyName, NewDest);
-        
-        if (bDebugDraw && World)
-        {
-            DrawDebugSphere(World, NewDest, 30.f, 12, FColor::Purple, false, 0.6f);
-            DrawDebugLine(World, MyLoc, NewDest, FColor::Purple, false, 0.6f, 0, 2.f);
-        }
+        DrawDebugSphere(World, TargetLoc, 30.f, 12, FColor::Purple, false, 0.6f);
+        DrawDebugLine(World, MyLoc, TargetLoc, FColor::Purple, false, 0.6f, 0, 2.f);
     }
 }
 
-bool UBTService_TacticalMove::GetStrafeLocation(UWorld* World, const FVector& Origin, const FVector& Target, FVector& OutLoc) const
+void UBTService_TacticalMove::BuildStrafeCandidates(const FVector& Origin, const FVector& Target, TArray<FVector>& OutCandidates) const
 {
-    if (!World) return false;
-    UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(World);
-    if (!NavSys) return false;
-
     // Target -> Me 벡터
-    FVector Dir = (Origin - Target).GetSafeNormal2D();
-    
-    // 왼쪽(-90) 혹은 오른쪽(+90) 중 랜덤 선택. 
-    // 약간의 전진/후진도 섞어서 완전히 원이 아니게 (45~135도 사이)
-    const bool bRight = FMath::RandBool();
-    const float BaseAngle = bRight ? 90.f : -90.f;
-    const float RandomAngle = FMath::FRandRange(-20.f, 20.f); 
-
-    const FVector RotateDir = Dir.RotateAngleAxis(BaseAngle + RandomAngle, FVector::UpVector);
-
-    // 목표점 후보
-    const FVector Candidate = Origin + RotateDir * StrafeStepDistance;
-
-    // NavMesh 위에 있는지 확인
-    FNavLocation NavLoc;
-    // ProjectPointToNavigation: 후보 지점 근처 NavMesh 찾기
-    if (NavSys->ProjectPointToNavigation(Candidate, NavLoc, FVector(100, 100, 100)))
+    const FVector Dir = (Origin - Target).GetSafeNormal2D();
+
+    // 먼저 고른 쪽을 앞에 두고, 막혔을 때를 대비해 반대쪽도 후보로 추가
+    // 약간의 전진/후진도 섞어서 완전히 원이 아니게 (70~110도 사이)
+    const float FirstSide = FMath::RandBool() ? 90.f : -90.f;
+    for (const float Side : { FirstSide, -FirstSide })
     {
-        // 벽 너머인지 체크 (Raycast) - 간단하게만
-        FHitResult Hit;
-        FCollisionQueryParams Params;
-        Params.AddIgnoredActor(Cast<AActor>(World->GetFirstPlayerController()->GetPawn())); // 임시
-        
-        // 경로 유효성까지 체크하면 좋음
-        OutLoc = NavLoc.Location;
-        return true;
+        for (int32 i = 0; i < 2; ++i)
+        {
+            const float RandomAngle = FMath::FRandRange(-20.f, 20.f);
+            const FVector RotateDir = Dir.RotateAngleAxis(Side + RandomAngle, FVector::UpVector);
+            OutCandidates.Add(Origin + RotateDir * StrafeStepDistance);
+        }
     }
-
-    return false;
 }
 
-bool UBTService_TacticalMove::GetBackstepLocation(UWorld* World, const FVector& Origin, const FVector& Target, FVector& OutLoc) const
+void UBTService_TacticalMove::BuildBackstepCandidates(const FVector& Origin, const FVector& Target, TArray<FVector>& OutCandidates) const
 {
-    if (!World) return false;
-    UNavigationSystemV1* NavSys = UNavigationSystemV1::GetCurrent(World);
-    if (!NavSys) return false;
-
-    // Target에서 멀어지는 방향
-    FVector Dir = (Origin - Target).GetSafeNormal2D();
-    
-    // 뒤로 조금 물러남
-    const FVector Candidate = Origin + Dir * (StrafeStepDistance * 0.8f); 
-
-    FNavLocation NavLoc;
-    if (NavSys->ProjectPointToNavigation(Candidate, NavLoc, FVector(100, 100, 100)))
+    // Target에서 멀어지는 방향 (정면 뒤가 막혀 있으면 비스듬히)
+    const FVector Dir = (Origin - Target).GetSafeNormal2D();
+    const float StepDistance = StrafeStepDistance * 0.8f;
+
+    for (const float Angle : { 0.f, 30.f, -30.f, 60.f, -60.f })
     {
-        OutLoc = NavLoc.Location;
-        return true;
+        OutCandidates.Add(Origin + Dir.RotateAngleAxis(Angle, FVector::UpVector) * StepDistance);
     }
-    return false;
 }
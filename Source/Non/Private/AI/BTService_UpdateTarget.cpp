@@ -1,6 +1,6 @@
 #include "AI/BTService_UpdateTarget.h"
 #include "BehaviorTree/BlackboardComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "AI/PlayerSpatialGridSubsystem.h"
 #include "AIController.h"
 #include "Character/EnemyCharacter.h"
 #include "GameFramework/Pawn.h"
@@ -14,17 +14,19 @@ UBTService_UpdateTarget::UBTService_UpdateTarget()
     NodeName = TEXT("Update Target (C++)");
 }
 
-void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UBTService_UpdateTarget::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
 {
-    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+    new (NodeMemory) FBTUpdateTargetMemory();
+}
 
+void UBTService_UpdateTarget::TickScheduled(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
     AAIController* AIC = OwnerComp.GetAIOwner();
     UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
     if (!AIC || !BB) return;
 
     AEnemyCharacter* Self = Cast<AEnemyCharacter>(AIC->GetPawn());
-    APawn* Player = UGameplayStatics::GetPlayerPawn(AIC, 0);
-    if (!Self || !Player) return;
+    if (!Self) return;
 
     if (Self->IsSpawnFading())
     {
@@ -33,14 +35,32 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
 
     UWorld* World = AIC->GetWorld();
     const float Now = World ? World->GetTimeSeconds() : 0.f;
+    float& LastSwitchTime = reinterpret_cast<FBTUpdateTargetMemory*>(NodeMemory)->LastSwitchTime;
 
     AActor* Curr = Cast<AActor>(BB->GetValueAsObject(TargetActorKey.SelectedKeyName));
-    const float DistToPlayer = FVector::Dist2D(Self->GetActorLocation(), Player->GetActorLocation());
+
+    // [Multiplayer] 타겟이 없으면 플레이어 격자에서 가장 가까운 살아 있는 플레이어 탐색
+    UPlayerSpatialGridSubsystem* Grid = World ? World->GetSubsystem<UPlayerSpatialGridSubsystem>() : nullptr;
+    APawn* Player = nullptr;
+    float DistToPlayer = MAX_flt;
+    if (Curr)
+    {
+        DistToPlayer = FVector::Dist2D(Self->GetActorLocation(), Curr->GetActorLocation());
+    }
+    else if (Grid)
+    {
+        Player = Grid->FindNearestPlayer(Self->GetActorLocation(), FMath::Max(EnterRadius, ExitRadius), &DistToPlayer);
+    }
 
     // [New] 블랙보드에 실시간 거리 기록
+    // 감지 반경 안에 아무도 없어도 가장 가까운 플레이어까지 실제 거리를 기록 (플레이어가 없으면 이전 값 유지)
     if (!DistanceKey.IsNone())
     {
-        BB->SetValueAsFloat(DistanceKey.SelectedKeyName, DistToPlayer);
+        float KeyDist = DistToPlayer;
+        if (Curr || Player || (Grid && Grid->GetNearestPlayerDistance2D(Self->GetActorLocation(), KeyDist)))
+        {
+            BB->SetValueAsFloat(DistanceKey.SelectedKeyName, KeyDist);
+        }
     }
 
     const bool bReactiveMode =
@@ -97,15 +117,9 @@ void UBTService_UpdateTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*
     }
 
     // ── 2) 신규 타겟 획득 ───────────────────────────
-    if (DistToPlayer < EnterRadius && (Now - LastSwitchTime) >= MinHoldTimeOnEnter)
+    // (죽은 플레이어는 격자에서 이미 제외됨)
+    if (Player && DistToPlayer < EnterRadius && (Now - LastSwitchTime) >= MinHoldTimeOnEnter)
     {
-        // [Fix] 플레이어가 죽었는지 먼저 확인하고 죽었으면 신규 타겟으로 잡지 않습니다!
-        if (ANonCharacterBase* TargetChar = Cast<ANonCharacterBase>(Player)) {
-            if (TargetChar->IsDead()) {
-                return;
-            }
-        }
-
         bool bCanAggro = true;
 
         if (bReactiveMode)
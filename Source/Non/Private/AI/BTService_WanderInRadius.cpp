@@ -56,10 +56,8 @@ bool UBTService_WanderInRadius::PickReachable(UWorld* World, const FVector& Cent
     return false;
 }
 
-void UBTService_WanderInRadius::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+void UBTService_WanderInRadius::TickScheduled(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
-    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
-
     AAIController* AIC = OwnerComp.GetAIOwner();
     UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
     if (!AIC || !BB) return;
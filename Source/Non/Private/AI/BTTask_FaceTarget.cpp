@@ -5,6 +5,7 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "AbilitySystemGlobals.h"
 #include "AbilitySystemComponent.h"
+#include "Ability/NonGameplayTags.h"
 
 UBTTask_FaceTarget::UBTTask_FaceTarget()
 {
@@ -29,7 +30,7 @@ EBTNodeResult::Type UBTTask_FaceTarget::ExecuteTask(UBehaviorTreeComponent& Owne
     // [New] 공격 중일 때는 회전 로직을 완전히 차단합니다.
     if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Pawn))
     {
-        if (ASC->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(TEXT("State.Attacking"))))
+        if (ASC->HasMatchingGameplayTag(NonGameplayTags::State_Attacking))
         {
             return EBTNodeResult::Succeeded;
         }
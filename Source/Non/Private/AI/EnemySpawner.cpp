@@ -46,6 +46,21 @@ void AEnemySpawner::BeginPlay()
     }
 }
 
+void AEnemySpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 스포너가 사라지면 숨겨 둔 적도 정리
+    for (AEnemyCharacter* Pooled : Pool)
+    {
+        if (IsValid(Pooled))
+        {
+            Pooled->Destroy();
+        }
+    }
+    Pool.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void AEnemySpawner::TryInitialSpawn()
 {
     for (int32 i = 0; i < InitialCount; ++i)
@@ -79,6 +94,14 @@ void AEnemySpawner::TrySpawnOne()
     }
     SpawnLoc.Z += HalfHeight + 2.f; // 살짝 여유
 
+    // [Pool] 보관 중인 적이 있으면 재사용
+    if (bUsePooling)
+    {
+        if (TrySpawnFromPool(SpawnLoc, SpawnRot, HalfHeight, Radius)) return;
+        if (Pool.Num() > 0) return; // 자리가 막혀서 실패 → 다음 리필틱에 재시도
+        ++PoolMisses;
+    }
+
     // 충돌나면 스폰하지 않음(끼임 방지)
     FActorSpawnParameters SP;
     SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding;
@@ -101,6 +124,44 @@ void AEnemySpawner::TrySpawnOne()
 
     // 죽음 이벤트 구독(이미 있으면 유지)
     E->OnEnemyDied.AddDynamic(this, &AEnemySpawner::OnEnemyDied);
+
+    if (bUsePooling)
+    {
+        E->SetOwningSpawner(this);
+    }
+}
+
+bool AEnemySpawner::TrySpawnFromPool(const FVector& SpawnLoc, const FRotator& SpawnRot, float HalfHeight, float Radius)
+{
+    // 파괴된 항목 정리
+    Pool.RemoveAll([](const TObjectPtr<AEnemyCharacter>& P) { return !IsValid(P); });
+    if (Pool.Num() == 0) return false;
+
+    // SpawnActor 의 "충돌나면 스폰하지 않음" 정책과 동일하게 캡슐 자리 검사
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(EnemySpawnerPoolFit), false);
+    Params.AddIgnoredActor(this);
+    if (GetWorld()->OverlapBlockingTestByChannel(SpawnLoc, SpawnRot.Quaternion(), ECC_Pawn,
+        FCollisionShape::MakeCapsule(Radius, HalfHeight), Params))
+    {
+        return false;
+    }
+
+    AEnemyCharacter* E = Pool.Pop(EAllowShrinking::No);
+    E->ActivateFromPool(SpawnLoc, SpawnRot);
+
+    Alive.Add(E);
+    ++PoolHits;
+    return true;
+}
+
+bool AEnemySpawner::ReleaseToPool(AEnemyCharacter* Enemy)
+{
+    if (!bUsePooling || !IsValid(Enemy) || Pool.Num() >= MaxPoolSize) return false;
+    if (Pool.Contains(Enemy)) return true;
+
+    Enemy->DeactivateForPool();
+    Pool.Add(Enemy);
+    return true;
 }
 
 // 지점을 고르는 로직: NavMesh 투영 → 지면 스냅
@@ -0,0 +1,106 @@
+#include "AI/NavQueryBatchSubsystem.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Engine/World.h"
+
+TStatId UNavQueryBatchSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNavQueryBatchSubsystem, STATGROUP_Tickables);
+}
+
+void UNavQueryBatchSubsystem::SubmitQuery(FNavCandidateQuery&& Query)
+{
+    if (Query.Candidates.Num() == 0 || !Query.OnResolved) return;
+
+    if (const UObject* Owner = Query.Owner.Get())
+    {
+        CancelQueries(Owner);
+    }
+    Pending.Add(MoveTemp(Query));
+}
+
+void UNavQueryBatchSubsystem::CancelQueries(const UObject* Owner)
+{
+    if (!Owner) return;
+
+    Pending.RemoveAll([Owner](const FNavCandidateQuery& Query)
+    {
+        return Query.Owner.Get() == Owner;
+    });
+}
+
+void UNavQueryBatchSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (Pending.Num() == 0) return;
+
+    UWorld* World = GetWorld();
+    UNavigationSystemV1* NavSys = World ? UNavigationSystemV1::GetCurrent(World) : nullptr;
+    const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr;
+
+    // 이번 프레임에 처리할 질의 수 (오래된 것부터)
+    int32 NumQueries = 0;
+    int32 NumPoints = 0;
+    while (NumQueries < Pending.Num())
+    {
+        const int32 QueryPoints = Pending[NumQueries].Candidates.Num();
+        if (NumQueries > 0 && NumPoints + QueryPoints > MaxPointsPerFrame) break;
+        NumPoints += QueryPoints;
+        ++NumQueries;
+    }
+
+    // 콜백 중 새 질의가 제출될 수 있으므로 먼저 꺼냄
+    TArray<FNavCandidateQuery> Batch;
+    Batch.Reserve(NumQueries);
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        Batch.Add(MoveTemp(Pending[i]));
+    }
+    Pending.RemoveAt(0, NumQueries, EAllowShrinking::No);
+
+    // 질의별 투영 범위가 다를 수 있으므로 각 지점에 개별 범위 지정
+    TArray<FNavigationProjectionWork> Workload;
+    Workload.Reserve(NumPoints);
+    for (const FNavCandidateQuery& Query : Batch)
+    {
+        for (const FVector& Candidate : Query.Candidates)
+        {
+            Workload.Emplace(Candidate, FBox(Candidate - Query.ProjectExtent, Candidate + Query.ProjectExtent));
+        }
+    }
+
+    if (NavData)
+    {
+        NavSys->BatchProjectPoints(Workload, FVector(100.f, 100.f, 100.f), NavData);
+    }
+
+    int32 WorkIndex = 0;
+    for (FNavCandidateQuery& Query : Batch)
+    {
+        bool bFound = false;
+        FVector Best = FVector::ZeroVector;
+        float BestScore = TNumericLimits<float>::Max();
+
+        for (const FVector& Candidate : Query.Candidates)
+        {
+            const FNavigationProjectionWork& Work = Workload[WorkIndex++];
+            if (!NavData || !Work.bResult) continue;
+
+            const FVector& Projected = Work.OutLocation.Location;
+            const float RangeError = FMath::Abs(FVector::Dist2D(Projected, Query.ScoreTarget) - Query.DesiredDistance);
+            const float Score = RangeError + FVector::Dist(Projected, Candidate) * Query.SnapPenalty;
+            if (Score < BestScore)
+            {
+                BestScore = Score;
+                Best = Projected;
+                bFound = true;
+            }
+        }
+
+        // 소유자가 사라진 질의는 결과를 버림
+        if (Query.Owner.IsStale()) continue;
+
+        Query.OnResolved(bFound, Best);
+    }
+}
@@ -0,0 +1,121 @@
+#include "AI/PlayerSpatialGridSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Character/NonCharacterBase.h"
+
+void UPlayerSpatialGridSubsystem::RebuildIfStale()
+{
+    if (BuiltFrame == GFrameCounter) return;
+    BuiltFrame = GFrameCounter;
+
+    Players.Reset();
+    Cells.Reset();
+
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        APlayerController* PC = It->Get();
+        APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+        if (!Pawn) continue;
+
+        // 죽은 플레이어는 격자에 넣지 않음
+        if (const ANonCharacterBase* Char = Cast<ANonCharacterBase>(Pawn))
+        {
+            if (Char->IsDead()) continue;
+        }
+
+        const int32 Index = Players.Num();
+        FPlayerEntry& Entry = Players.AddDefaulted_GetRef();
+        Entry.Pawn = Pawn;
+        Entry.Location = FVector2D(Pawn->GetActorLocation());
+
+        Cells.FindOrAdd(ToCell(Entry.Location)).Add(Index);
+    }
+}
+
+APawn* UPlayerSpatialGridSubsystem::FindNearestPlayer(const FVector& Origin, float Radius, float* OutDist2D)
+{
+    RebuildIfStale();
+    if (Players.Num() == 0 || Radius <= 0.f) return nullptr;
+
+    const FVector2D Origin2D(Origin);
+    const FIntPoint MinCell = ToCell(Origin2D - FVector2D(Radius));
+    const FIntPoint MaxCell = ToCell(Origin2D + FVector2D(Radius));
+
+    APawn* Best = nullptr;
+    float BestDistSq = FMath::Square(Radius);
+
+    auto Consider = [&](const FPlayerEntry& Entry)
+    {
+        const float DistSq = FVector2D::DistSquared(Origin2D, Entry.Location);
+        if (DistSq <= BestDistSq)
+        {
+            if (APawn* Pawn = Entry.Pawn.Get())
+            {
+                Best = Pawn;
+                BestDistSq = DistSq;
+            }
+        }
+    };
+
+    // 확인할 셀이 플레이어 수보다 많으면 (소수 인원 협동 등) 전부 검사하는 편이 더 쌈
+    // 셀 조회 한 번이 거리 계산 한 번보다 비싸므로 기준을 더 낮추지 않음
+    const int64 NumCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+    if (NumCells > Players.Num())
+    {
+        for (const FPlayerEntry& Entry : Players)
+        {
+            Consider(Entry);
+        }
+    }
+    else
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+            {
+                if (const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y)))
+                {
+                    for (const int32 Index : *Bucket)
+                    {
+                        Consider(Players[Index]);
+                    }
+                }
+            }
+        }
+    }
+
+    if (Best && OutDist2D)
+    {
+        *OutDist2D = FMath::Sqrt(BestDistSq);
+    }
+    return Best;
+}
+
+bool UPlayerSpatialGridSubsystem::GetNearestPlayerDistance2D(const FVector& Origin, float& OutDist2D)
+{
+    RebuildIfStale();
+
+    const FVector2D Origin2D(Origin);
+    float BestDistSq = MAX_flt;
+    for (const FPlayerEntry& Entry : Players)
+    {
+        if (Entry.Pawn.IsValid())
+        {
+            BestDistSq = FMath::Min(BestDistSq, FVector2D::DistSquared(Origin2D, Entry.Location));
+        }
+    }
+
+    if (BestDistSq == MAX_flt) return false;
+    OutDist2D = FMath::Sqrt(BestDistSq);
+    return true;
+}
+
+int32 UPlayerSpatialGridSubsystem::GetNumPlayers()
+{
+    RebuildIfStale();
+    return Players.Num();
+}
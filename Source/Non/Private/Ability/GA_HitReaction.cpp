@@ -1,4 +1,5 @@
 #include "Ability/GA_HitReaction.h"
+#include "Ability/NonGameplayTags.h"
 #include "Character/NonCharacterBase.h"
 #include "Character/EnemyCharacter.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
@@ -16,7 +17,7 @@ UGA_HitReaction::UGA_HitReaction()
 
     // Trigger on Tag
     FAbilityTriggerData Trigger;
-    Trigger.TriggerTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Hit"));
+    Trigger.TriggerTag = NonGameplayTags::Effect_Hit;
     Trigger.TriggerSource = EGameplayAbilityTriggerSource::GameplayEvent; 
     // 주의: Effect.Hit 태그가 Event로 오는지, 아니면 OwnedTag로 추가되는지에 따라 다름.
     // 보통은 AttributeSet에서 PostGameplayEffectExecute 때 SendGameplayEvent를 호출해줘야 함.
@@ -58,7 +59,7 @@ void UGA_HitReaction::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
     }
 
     // 1. 트리거 태그 확인
-    FGameplayTag HitTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Hit.Light")); // Default
+    FGameplayTag HitTag = NonGameplayTags::Effect_Hit_Light; // Default
     ActualReactionDelay = PostReactionAttackDelay; // 기본값으로 세팅
 
     if (TriggerEventData)
@@ -143,7 +144,7 @@ void UGA_HitReaction::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
         // [New] State.Stunned 태그가 만료되었을 때 어빌리티를 강제로 종료하기 위한 리스너
         if (UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo())
         {
-            FGameplayTag StunTag = FGameplayTag::RequestGameplayTag(TEXT("State.Stunned"));
+            FGameplayTag StunTag = NonGameplayTags::State_Stunned;
             TagEventHandle = ASC->RegisterGameplayTagEvent(StunTag, EGameplayTagEventType::NewOrRemoved)
                                 .AddUObject(this, &UGA_HitReaction::OnStunTagChanged);
         }
@@ -180,7 +181,7 @@ void UGA_HitReaction::EndAbility(const FGameplayAbilitySpecHandle Handle,
 {
     if (TagEventHandle.IsValid() && ActorInfo && ActorInfo->AbilitySystemComponent.IsValid())
     {
-        FGameplayTag StunTag = FGameplayTag::RequestGameplayTag(TEXT("State.Stunned"));
+        FGameplayTag StunTag = NonGameplayTags::State_Stunned;
         ActorInfo->AbilitySystemComponent->RegisterGameplayTagEvent(StunTag, EGameplayTagEventType::NewOrRemoved).Remove(TagEventHandle);
         TagEventHandle.Reset();
     }
@@ -201,7 +202,7 @@ void UGA_HitReaction::EndAbility(const FGameplayAbilitySpecHandle Handle,
                 if (UBrainComponent* Brain = AIC->GetBrainComponent())
                 {
                     // 적이 치명상으로 죽은 상태(State.Dead)라면 절대로 뇌를 켜지 않도록 방어 코드 추가
-                    if (!Enemy->GetAbilitySystemComponent()->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(TEXT("State.Dead"))))
+                    if (!Enemy->GetAbilitySystemComponent()->HasMatchingGameplayTag(NonGameplayTags::State_Dead))
                     {
                         Brain->RestartLogic();
                     }
@@ -1,8 +1,10 @@
 #include "Ability/NonAttributeSet.h"
+#include "Ability/NonGameplayTags.h"
 #include "GameplayEffectExtension.h"
 #include "Net/UnrealNetwork.h"
 #include "Character/NonCharacterBase.h"
 #include "Character/EnemyCharacter.h"
+#include "Combat/CombatEventSubsystem.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "Core/NonPlayerController.h"
 
@@ -103,7 +105,7 @@ void UNonAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbac
             ANonCharacterBase* SourceChar = Cast<ANonCharacterBase>(SourceActor);
 
             // 결투 태그 체크
-            FGameplayTag DuelTag = FGameplayTag::RequestGameplayTag(TEXT("State.Combat.Dueling"), false);
+            FGameplayTag DuelTag = NonGameplayTags::State_Combat_Dueling;
 
             // 1. 평화구역 데미지 필터링 (마을 PvP 차단 및 1:1 결투 활성화)
             if (TargetChar && TargetChar->bIsInPeaceZone)
@@ -187,7 +189,7 @@ void UNonAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbac
             if (NewHP <= 0.f && OldHP > 0.f)
             {
                 // Send "Effect.Death" Event
-                FGameplayTag DeathTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Death"));
+                FGameplayTag DeathTag = NonGameplayTags::Effect_Death;
                 FGameplayEventData Payload;
                 Payload.EventTag = DeathTag;
                 Payload.Instigator = Data.EffectSpec.GetContext().GetInstigator();
@@ -218,13 +220,13 @@ void UNonAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbac
 
                 // ------------- [Fix] GAS 피격 이벤트 공용 발송 (플레이어, 적 모두 포함) -------------
                 // 기본 태그: Effect.Hit.Light
-                FGameplayTag HitEventTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Hit.Light"));
+                FGameplayTag HitEventTag = NonGameplayTags::Effect_Hit_Light;
                 
                 // EffectSpec.DynamicAssetTags에서 "Effect.Hit" 하위 태그가 있는지 확인
                 FGameplayTagContainer AssetTags = Data.EffectSpec.GetDynamicAssetTags();
                 for (const FGameplayTag& LinkTag : AssetTags)
                 {
-                    if (LinkTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Effect.Hit"))))
+                    if (LinkTag.MatchesTag(NonGameplayTags::Effect_Hit))
                     {
                         HitEventTag = LinkTag; // Found Specific Tag
                         break;
@@ -260,29 +262,25 @@ void UNonAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbac
                 }
 
                 // Critical 여부 확인
-                const FGameplayTag CritTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Damage.Critical"), false);
+                const FGameplayTag CritTag = NonGameplayTags::Effect_Damage_Critical;
                 const bool bIsCritical = Data.EffectSpec.GetDynamicAssetTags().HasTag(CritTag);
 
+                // 데미지 숫자는 프레임 단위 전투 이벤트로 묶어서 주변 클라이언트에 전송
+                const ECombatEventType NumberType = bIsCritical ? ECombatEventType::CriticalDamage : ECombatEventType::Damage;
+
                 if (TargetChar)
                 {
                      const FVector SpawnLoc = bHasHitLoc ? ExactHitLoc : TargetChar->GetActorLocation(); 
                      
-                     // [New] 플레이어가 맞았는지 체크
-                     if (TargetChar->IsPlayerControlled())
-                     {
-                         // 플레이어가 맞은 경우 전용 함수나 플래그를 통해 PlayerDamage 전달
-                         // (Multicast_SpawnDamageNumber를 확장하거나 내부에서 처리)
-                         TargetChar->Multicast_SpawnPlayerDamageNumber(Damage, SpawnLoc);
-                     }
-                     else
-                     {
-                         TargetChar->Multicast_SpawnDamageNumber(Damage, SpawnLoc, bIsCritical);
-                     }
+                     // [New] 플레이어가 맞았는지 체크 (플레이어 피격은 PlayerDamage 로 표시)
+                     UCombatEventSubsystem::Post(TargetChar,
+                         TargetChar->IsPlayerControlled() ? ECombatEventType::PlayerDamage : NumberType,
+                         TargetChar, SpawnLoc, Damage);
                 }
                 else if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Data.Target.GetAvatarActor()))
                 {
                      const FVector SpawnLoc = bHasHitLoc ? ExactHitLoc : Enemy->GetActorLocation(); 
-                     Enemy->Multicast_SpawnDamageNumber(Damage, SpawnLoc, bIsCritical);
+                     UCombatEventSubsystem::Post(Enemy, NumberType, Enemy, SpawnLoc, Damage);
                 }
             }
         }
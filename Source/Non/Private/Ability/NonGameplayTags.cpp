@@ -0,0 +1,96 @@
+#include "Ability/NonGameplayTags.h"
+#include "GameplayTagsManager.h"
+
+namespace NonGameplayTags
+{
+    UE_DEFINE_GAMEPLAY_TAG(State_Attack, "State.Attack");
+    UE_DEFINE_GAMEPLAY_TAG(State_Attacking, "State.Attacking");
+    UE_DEFINE_GAMEPLAY_TAG(State_Combat, "State.Combat");
+    UE_DEFINE_GAMEPLAY_TAG(State_Combat_Dueling, "State.Combat.Dueling");
+    UE_DEFINE_GAMEPLAY_TAG(State_Combo_Ready, "State.Combo.Ready");
+    UE_DEFINE_GAMEPLAY_TAG(State_Dead, "State.Dead");
+    UE_DEFINE_GAMEPLAY_TAG(State_Dodge, "State.Dodge");
+    UE_DEFINE_GAMEPLAY_TAG(State_Guard, "State.Guard");
+    UE_DEFINE_GAMEPLAY_TAG(State_HitReacting, "State.HitReacting");
+    UE_DEFINE_GAMEPLAY_TAG(State_IFrame, "State.IFrame");
+    UE_DEFINE_GAMEPLAY_TAG(State_Invincible, "State.Invincible");
+    UE_DEFINE_GAMEPLAY_TAG(State_Jump, "State.Jump");
+    UE_DEFINE_GAMEPLAY_TAG(State_Skill, "State.Skill");
+    UE_DEFINE_GAMEPLAY_TAG(State_Stunned, "State.Stunned");
+    UE_DEFINE_GAMEPLAY_TAG(State_ToggleWeapon_Root, "State.ToggleWeapon.Root");
+
+    UE_DEFINE_GAMEPLAY_TAG(Ability_Attack, "Ability.Attack");
+    UE_DEFINE_GAMEPLAY_TAG(Ability_Combo, "Ability.Combo");
+    UE_DEFINE_GAMEPLAY_TAG(Ability_Combo1, "Ability.Combo1");
+    UE_DEFINE_GAMEPLAY_TAG(Ability_Combo2, "Ability.Combo2");
+    UE_DEFINE_GAMEPLAY_TAG(Ability_Combo3, "Ability.Combo3");
+    UE_DEFINE_GAMEPLAY_TAG(Ability_Dodge, "Ability.Dodge");
+    UE_DEFINE_GAMEPLAY_TAG(Ability_Guard, "Ability.Guard");
+    UE_DEFINE_GAMEPLAY_TAG(Ability_ToggleWeapon, "Ability.ToggleWeapon");
+
+    UE_DEFINE_GAMEPLAY_TAG(Effect_Damage_Critical, "Effect.Damage.Critical");
+    UE_DEFINE_GAMEPLAY_TAG(Effect_Death, "Effect.Death");
+    UE_DEFINE_GAMEPLAY_TAG(Effect_Hit, "Effect.Hit");
+    UE_DEFINE_GAMEPLAY_TAG(Effect_Hit_Light, "Effect.Hit.Light");
+    UE_DEFINE_GAMEPLAY_TAG(Effect_Revive, "Effect.Revive");
+
+    UE_DEFINE_GAMEPLAY_TAG(Data_Damage, "Data.Damage");
+    UE_DEFINE_GAMEPLAY_TAG(Data_ExpToNextLevel, "Data.ExpToNextLevel");
+    UE_DEFINE_GAMEPLAY_TAG(Data_MaxHP, "Data.MaxHP");
+    UE_DEFINE_GAMEPLAY_TAG(Data_MaxMP, "Data.MaxMP");
+    UE_DEFINE_GAMEPLAY_TAG(Data_StunDuration, "Data.StunDuration");
+
+    const FGameplayTagContainer& GetRotationLockTags()
+    {
+        static const FGameplayTagContainer Tags = []
+        {
+            FGameplayTagContainer C;
+            C.AddTag(State_Dodge);
+            C.AddTag(State_Attack);
+            C.AddTag(State_Attacking);
+            C.AddTag(Ability_Combo);
+            C.AddTag(Ability_Combo1);
+            C.AddTag(Ability_Combo2);
+            C.AddTag(Ability_Combo3);
+            C.AddTag(State_Skill);
+            C.AddTag(State_HitReacting);
+            C.AddTag(State_Stunned);
+            C.AddTag(State_Dead);
+            C.AddTag(State_ToggleWeapon_Root);
+            return C;
+        }();
+        return Tags;
+    }
+
+    const FGameplayTagContainer& GetActionBusyTags()
+    {
+        static const FGameplayTagContainer Tags = []
+        {
+            FGameplayTagContainer C;
+            C.AddTag(State_Dodge);
+            C.AddTag(State_Attack);
+            C.AddTag(Ability_Combo);
+            C.AddTag(State_Skill);
+            C.AddTag(State_Guard);
+            return C;
+        }();
+        return Tags;
+    }
+
+    FGameplayTag GetComboReadyTag(FName SkillId)
+    {
+        // 게임 스레드 전용. 정의되지 않은 태그도 빈 태그로 캐시해서 다시 조회하지 않음
+        check(IsInGameThread());
+        static TMap<FName, FGameplayTag> Cache;
+
+        if (const FGameplayTag* Found = Cache.Find(SkillId))
+        {
+            return *Found;
+        }
+
+        const FString TagString = FString::Printf(TEXT("State.Combo.Ready.%s"), *SkillId.ToString());
+        const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
+        Cache.Add(SkillId, Tag);
+        return Tag;
+    }
+}
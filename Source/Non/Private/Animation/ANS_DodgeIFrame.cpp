@@ -5,6 +5,7 @@
 #include "Components/CapsuleComponent.h"
 #include "AbilitySystemInterface.h"
 #include "AbilitySystemComponent.h"
+#include "Ability/NonGameplayTags.h"
 
 // 전역 static 객체 생성은 태그 매니저 초기화 이전 시점에 호출될 수 있어 크래시를 유발하므로 제거합니다.
 void UANS_DodgeIFrame::NotifyBegin(
@@ -38,7 +39,7 @@ void UANS_DodgeIFrame::NotifyBegin(
         {
             if (UAbilitySystemComponent* ASC = Iface->GetAbilitySystemComponent())
             {
-                FGameplayTag IFrameTag = FGameplayTag::RequestGameplayTag(TEXT("State.IFrame"), false);
+                FGameplayTag IFrameTag = NonGameplayTags::State_IFrame;
                 ASC->AddLooseGameplayTag(IFrameTag);
             }
         }
@@ -75,7 +76,7 @@ void UANS_DodgeIFrame::NotifyEnd(
         {
             if (UAbilitySystemComponent* ASC = Iface->GetAbilitySystemComponent())
             {
-                FGameplayTag IFrameTag = FGameplayTag::RequestGameplayTag(TEXT("State.IFrame"), false);
+                FGameplayTag IFrameTag = NonGameplayTags::State_IFrame;
                 ASC->RemoveLooseGameplayTag(IFrameTag);
             }
         }
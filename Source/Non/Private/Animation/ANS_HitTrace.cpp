@@ -4,7 +4,9 @@
 #include "Camera/CameraShakeBase.h"
 #include "Character/EnemyCharacter.h"
 #include "Character/NonCharacterBase.h"
+#include "Combat/CombatResolverSubsystem.h"
 #include "Combat/NonDamageHelpers.h"
+#include "Combat/WeaponTraceComponent.h"
 #include "Components/SceneComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/EngineTypes.h"
@@ -13,100 +15,86 @@
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetSystemLibrary.h"
 
-// 소켓 소유 컴포넌트 찾기
-USceneComponent *
-UANS_HitTrace::ResolveSocketOwner(USkeletalMeshComponent *MeshComp) const {
+// 소켓 소유 컴포넌트 찾기 (NotifyBegin 또는 컴포넌트가 사라졌을 때만 호출)
+FWeaponTraceSockets
+UANS_HitTrace::ResolveTraceSockets(USkeletalMeshComponent *MeshComp) const {
   if (!MeshComp)
-    return nullptr;
+    return FWeaponTraceSockets();
 
   // 1) 현재 메시에 소켓 둘 다 있으면 그대로 사용
-  if (MeshComp->DoesSocketExist(StartSocket) &&
-      MeshComp->DoesSocketExist(EndSocket)) {
-    return MeshComp;
-  }
-
-  if (!bAutoFindSocketOwnerOnOwner)
-    return nullptr;
+  FWeaponTraceSockets Resolved =
+      FWeaponTraceSockets::Resolve(MeshComp, StartSocket, EndSocket);
+  if (Resolved.IsValid() || !bAutoFindSocketOwnerOnOwner)
+    return Resolved;
 
   AActor *Owner = MeshComp->GetOwner();
   if (!Owner)
-    return nullptr;
+    return Resolved;
 
-  // [New] 장착된 무기 액터(Spawned Actor)가 있다면, 그 액터 내부의 컴포넌트들을
-  // 먼저 뒤진다.
+  // 2) 장착 무기: 장비 컴포넌트가 슬롯별로 캐시한 결과 사용 (메인 → 서브)
   if (ANonCharacterBase *NonChar = Cast<ANonCharacterBase>(Owner)) {
-    if (UEquipmentComponent *EqComp =
-            NonChar->FindComponentByClass<UEquipmentComponent>()) {
-      // 메인 무기 우선
-      if (AActor *MainWeapon =
-              EqComp->GetEquippedActor(EEquipmentSlot::WeaponMain)) {
-        TArray<USceneComponent *> WeaponComps;
-        MainWeapon->GetComponents<USceneComponent>(WeaponComps);
-        for (USceneComponent *C : WeaponComps) {
-          if (C && C->DoesSocketExist(StartSocket) &&
-              C->DoesSocketExist(EndSocket)) {
-            return C;
-          }
-        }
-      }
-      // 서브 무기도 체크
-      if (AActor *SubWeapon =
-              EqComp->GetEquippedActor(EEquipmentSlot::WeaponSub)) {
-        TArray<USceneComponent *> WeaponComps;
-        SubWeapon->GetComponents<USceneComponent>(WeaponComps);
-        for (USceneComponent *C : WeaponComps) {
-          if (C && C->DoesSocketExist(StartSocket) &&
-              C->DoesSocketExist(EndSocket)) {
-            return C;
-          }
+    if (UEquipmentComponent *EqComp = NonChar->GetEquipmentComponent()) {
+      for (const EEquipmentSlot Slot :
+           {EEquipmentSlot::WeaponMain, EEquipmentSlot::WeaponSub}) {
+        if (const FWeaponTraceSockets *Cached =
+                EqComp->FindTraceSockets(Slot, StartSocket, EndSocket)) {
+          return *Cached;
         }
       }
     }
   }
 
-  // Owner의 모든 SkeletalMeshComponent 탐색
+  // 3) Owner의 모든 SkeletalMeshComponent 탐색
   TArray<USkeletalMeshComponent *> SkelComps;
   Owner->GetComponents<USkeletalMeshComponent>(SkelComps);
 
   // (a) 태그 우선
   if (!PreferredComponentTag.IsNone()) {
     for (USkeletalMeshComponent *C : SkelComps) {
-      if (C && C->ComponentHasTag(PreferredComponentTag) &&
-          C->DoesSocketExist(StartSocket) && C->DoesSocketExist(EndSocket)) {
-        return C;
+      if (C && C->ComponentHasTag(PreferredComponentTag)) {
+        Resolved = FWeaponTraceSockets::Resolve(C, StartSocket, EndSocket);
+        if (Resolved.IsValid())
+          return Resolved;
       }
     }
   }
 
   // (b) 그 외 컴포넌트에서 소켓 둘 다 있는 것
   for (USkeletalMeshComponent *C : SkelComps) {
-    if (!C)
-      continue;
-    if (C->DoesSocketExist(StartSocket) && C->DoesSocketExist(EndSocket)) {
-      return C;
-    }
+    Resolved = FWeaponTraceSockets::Resolve(C, StartSocket, EndSocket);
+    if (Resolved.IsValid())
+      return Resolved;
   }
 
-  return nullptr;
+  return FWeaponTraceSockets();
 }
 
 void UANS_HitTrace::NotifyBegin(
     USkeletalMeshComponent *MeshComp, UAnimSequenceBase *Animation,
     float TotalDuration, const FAnimNotifyEventReference &EventReference) {
-  HitActors.Reset();
-  SocketOwnerComp = ResolveSocketOwner(MeshComp);
+  AActor *Owner = MeshComp ? MeshComp->GetOwner() : nullptr;
+  if (!Owner || (bServerOnly && !Owner->HasAuthority()))
+    return;
 
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-  if (!SocketOwnerComp.IsValid()) {
+  if (UWeaponTraceComponent *Trace = UWeaponTraceComponent::FindOrAdd(Owner)) {
+    Trace->BeginSwing(
+        UWeaponTraceComponent::MakeSwingKey(MeshComp, EventReference, this),
+        ResolveTraceSockets(MeshComp));
   }
-#endif
 }
 
 void UANS_HitTrace::NotifyEnd(USkeletalMeshComponent *MeshComp,
                               UAnimSequenceBase *Animation,
                               const FAnimNotifyEventReference &EventReference) {
-  HitActors.Reset();
-  SocketOwnerComp.Reset();
+  AActor *Owner = MeshComp ? MeshComp->GetOwner() : nullptr;
+  if (!Owner)
+    return;
+
+  if (UWeaponTraceComponent *Trace =
+          Owner->FindComponentByClass<UWeaponTraceComponent>()) {
+    Trace->EndSwing(
+        UWeaponTraceComponent::MakeSwingKey(MeshComp, EventReference, this));
+  }
 }
 
 void UANS_HitTrace::NotifyTick(
@@ -124,133 +112,110 @@ void UANS_HitTrace::NotifyTick(
     return;
   }
 
-  USceneComponent *Comp =
-      SocketOwnerComp.IsValid() ? SocketOwnerComp.Get() : MeshComp;
-  if (!Comp)
+  UWeaponTraceComponent *Trace = UWeaponTraceComponent::FindOrAdd(Owner);
+  if (!Trace)
     return;
 
-  if (!(Comp->DoesSocketExist(StartSocket) &&
-        Comp->DoesSocketExist(EndSocket))) {
-    USceneComponent *ReResolved = ResolveSocketOwner(MeshComp);
-    if (!ReResolved)
+  // 스윙별 상태 (Begin 을 놓친 경우 지금 시작)
+  const FWeaponSwingKey SwingKey =
+      UWeaponTraceComponent::MakeSwingKey(MeshComp, EventReference, this);
+  FWeaponSwingState *State = Trace->FindSwing(SwingKey);
+  if (!State) {
+    State = &Trace->BeginSwing(SwingKey, ResolveTraceSockets(MeshComp));
+  }
+
+  // 소켓 재검사는 소켓 소유 컴포넌트가 사라졌을 때만 (무기 교체 등)
+  // 이전 위치는 다른 무기 기준이므로 버림
+  if (!State->Sockets.IsValid()) {
+    State->Sockets = ResolveTraceSockets(MeshComp);
+    State->bHasPrev = false;
+    if (!State->Sockets.IsValid())
       return;
-    Comp = ReResolved;
-    SocketOwnerComp = ReResolved;
   }
 
-  const FVector Start = Comp->GetSocketLocation(StartSocket);
-  const FVector End = Comp->GetSocketLocation(EndSocket);
+  FWeaponSweepParams SweepParams;
+  SweepParams.Radius = Radius;
+  SweepParams.Channel = TraceChannel;
+  SweepParams.MaxSubSteps = MaxSubSteps;
+  SweepParams.bDrawDebug = DebugDrawType != EDrawDebugTrace::None;
+  SweepParams.DebugColor = DebugTraceColor.ToFColor(true);
+  SweepParams.DebugDrawTime = DebugDrawTime;
 
   // Trace
   TArray<FHitResult> Hits;
-  const ETraceTypeQuery TraceType =
-      UEngineTypes::ConvertToTraceType(TraceChannel);
+  Trace->SweepSwing(*State, SweepParams, Hits);
 
-  TArray<AActor *> Ignore;
-  Ignore.Add(Owner);
-
-  UKismetSystemLibrary::SphereTraceMulti(
-      World, Start, End, Radius, TraceType, false, Ignore, DebugDrawType, Hits,
-      true, DebugTraceColor, DebugHitColor, DebugDrawTime);
+  const FVector Start = State->PrevStart;
+  const FVector End = State->PrevEnd;
 
   APawn *InstigatorPawn = Cast<APawn>(Owner);
   bool bShookOnce = false;
 
-  for (const FHitResult &H : Hits) {
+  // 이번 틱에 맞을 대상을 먼저 확정해서 기록
+  // (데미지 처리 중 다른 스윙이 시작되어 상태 맵이 바뀌어도 State 를 다시 만지지 않도록)
+  Hits.RemoveAll([&](const FHitResult &H) {
     AActor *Other = H.GetActor();
-    if (!Other || Other == Owner)
-      continue;
-    if (!IsValidTarget(Other))
-      continue;
-    if (bSingleHitPerActor && HitActors.Contains(Other)) {
-      continue;
-    }
+    if (!Other || Other == Owner || !IsValidTarget(Other))
+      return true;
+    if (bSingleHitPerActor && State->HitActors.Contains(Other))
+      return true;
+    State->HitActors.Add(Other);
+    return false;
+  });
+
+  // 공격자 쪽 값은 스윙 중 변하지 않으므로 히트 루프 밖에서 한 번만 읽음
+  ANonCharacterBase *AttackerChar = Cast<ANonCharacterBase>(InstigatorPawn);
+  const float PowerScale =
+      AttackerChar ? Damage * AttackerChar->GetLastSkillDamageScale() : Damage;
+  const float EffectLevel =
+      AttackerChar ? static_cast<float>(AttackerChar->GetLastSkillLevel()) : 1.0f;
+  const float StunDuration =
+      AttackerChar ? AttackerChar->GetLastSkillStunDuration() : 0.0f;
+  AController *InstigatorController =
+      InstigatorPawn ? InstigatorPawn->GetController()
+                     : Owner->GetInstigatorController();
+  const FVector Dir = (End - Start).GetSafeNormal();
 
-    // 크리 여부 플래그 (히트마다 초기화)
-    bool bWasCritical = false;
+  for (const FHitResult &H : Hits) {
+    AActor *Other = H.GetActor();
 
     // 여기서 Owner가 플레이어면 전투 상태 진입
-    if (ANonCharacterBase *Player = Cast<ANonCharacterBase>(InstigatorPawn)) {
-      Player->EnterCombatState();
+    if (AttackerChar) {
+      AttackerChar->EnterCombatState();
     }
 
-    // ── 실제 데미지 수치 계산 ──
+    // ── 데미지 요청 ──
+    // 계산/적용은 전투 해석기가 프레임 끝에 일괄 처리
     // 여기서는 AnimNotify 의 Damage 를 "계수(PowerScale)"로 사용
-    float FinalDamage = Damage;
-
-    if (InstigatorPawn) {
-      float FinalScale = Damage;
-      if (ANonCharacterBase* AttackerChar = Cast<ANonCharacterBase>(InstigatorPawn)) {
-        FinalScale = Damage * AttackerChar->GetLastSkillDamageScale();
-      }
-
-      // 1) 공격자 기준 원 데미지 계산 (공격력/마력 + Min/Max 포함)
-      const float RawDamage = UNonDamageHelpers::ComputeDamageFromAttributes(
-          InstigatorPawn,
-          FinalScale, // 갱신된 최종 계수 (노티파이 Damage * 스킬 계수)
-          DamageStatType,
-          &bWasCritical); // Physical / Magical (에디터에서 설정)
-
-      // 2) 피격자 방어력/마저 적용
-      if (RawDamage > 0.f) {
-        FinalDamage = UNonDamageHelpers::ApplyDefenseReduction(
-            Other, // 지금 맞고 있는 대상
-            RawDamage, DamageStatType);
-      }
-    }
-
-    // ── 데미지 적용 ──
-    if (bUseGASDamage) {
-      if (AEnemyCharacter *Victim = Cast<AEnemyCharacter>(Other)) {
-        FVector HitLoc = Victim->GetActorLocation();
-        if (!H.ImpactPoint.IsNearlyZero()) {
-          HitLoc = H.ImpactPoint;
-        } else if (!H.Location.IsNearlyZero()) {
-          HitLoc = H.Location;
-        }
-
-        Victim->ApplyDamageAt(FinalDamage, Owner, HitLoc, bWasCritical, HitReactionTag);
-      } else {
-        const FVector Dir = (End - Start).GetSafeNormal();
-        UGameplayStatics::ApplyPointDamage(
-            Other, FinalDamage, Dir, H,
-            InstigatorPawn ? InstigatorPawn->GetController() : nullptr, Owner,
-            DamageType);
-      }
-    } else {
-      const FVector Dir = (End - Start).GetSafeNormal();
-      UGameplayStatics::ApplyPointDamage(Other, FinalDamage, Dir, H,
-                                         Owner->GetInstigatorController(),
-                                         Owner, DamageType);
+    // (공격자 스탯이 없으면 Damage 를 그대로 데미지로 사용)
+    FCombatHitRequest Request;
+    Request.Attacker = InstigatorPawn;
+    Request.DamageCauser = Owner;
+    Request.Target = Other;
+    Request.InstigatorController = InstigatorController;
+    Request.PowerScale = PowerScale;
+    Request.DamageType = DamageStatType;
+    Request.FallbackDamage = Damage;
+    Request.HitDirection = Dir;
+    Request.Hit = H;
+    Request.ReactionTag = HitReactionTag;
+    Request.DamageTypeClass = DamageType;
+
+    // GAS 경로는 적 대상만 (그 외는 일반 데미지 파이프)
+    Request.bApplyThroughGAS = bUseGASDamage && Cast<AEnemyCharacter>(Other);
+    Request.HitLocation = Other->GetActorLocation();
+    if (!H.ImpactPoint.IsNearlyZero()) {
+      Request.HitLocation = H.ImpactPoint;
+    } else if (!H.Location.IsNearlyZero()) {
+      Request.HitLocation = H.Location;
     }
 
     // [New] 매 타격 시마다 커스텀 스턴 등의 상태이상(GE) 강제 부여
-    if (AdditionalEffect) {
-      if (UAbilitySystemComponent *ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Other)) {
-        FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
-        Ctx.AddInstigator(InstigatorPawn, InstigatorPawn ? InstigatorPawn->GetController() : nullptr);
-        
-        // 무기를 휘두르는 주체(단순 폰이 아니라 내 캐릭터)에게서 데이터를 훔쳐옴!
-        float EffectLevel = 1.0f;
-        float StunDuration = 0.0f;
-        if (ANonCharacterBase* AttackerChar = Cast<ANonCharacterBase>(InstigatorPawn)) {
-            EffectLevel = static_cast<float>(AttackerChar->GetLastSkillLevel());
-            StunDuration = AttackerChar->GetLastSkillStunDuration();
-        }
+    Request.AdditionalEffect = AdditionalEffect;
+    Request.EffectLevel = EffectLevel;
+    Request.StunDuration = StunDuration;
 
-        // Spec을 만들어서 동적으로 시간(Duration)을 주입한 뒤 타겟에게 쏨!
-        FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(AdditionalEffect, EffectLevel, Ctx);
-        if (SpecHandle.IsValid())
-        {
-            // 데이터 에셋에 스턴 시간이 적혀 있을 때만 강제로 주입
-            if (StunDuration > 0.001f)
-            {
-                SpecHandle.Data->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(TEXT("Data.StunDuration"), false), StunDuration);
-            }
-            ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-        }
-      }
-    }
+    UCombatResolverSubsystem::Submit(World, MoveTemp(Request));
 
     // 카메라 셰이크(선택)
     if (CameraShakeClass && InstigatorPawn && !bShookOnce) {
@@ -261,7 +226,6 @@ void UANS_HitTrace::NotifyTick(
       }
     }
 
-    HitActors.Add(Other);
   }
 }
 
@@ -9,19 +9,33 @@
 
 UANS_WeaponTrail::UANS_WeaponTrail() { bIsNativeBranchingPoint = true; }
 
-UNiagaraComponent *
-UANS_WeaponTrail::FindTrailComponent(AActor *WeaponActor) const {
-  if (!WeaponActor)
-    return nullptr;
-
-  TArray<UNiagaraComponent *> Comps;
-  WeaponActor->GetComponents<UNiagaraComponent>(Comps);
-  for (UNiagaraComponent *Comp : Comps) {
-    if (Comp && Comp->ComponentTags.Contains(FName("WeaponTrail"))) {
-      return Comp;
+namespace {
+const FName TrailStartSocket(TEXT("TraceStart"));
+const FName TrailEndSocket(TEXT("TraceEnd"));
+
+UEquipmentComponent *GetEquipment(USkeletalMeshComponent *MeshComp) {
+  ANonCharacterBase *Char =
+      MeshComp ? Cast<ANonCharacterBase>(MeshComp->GetOwner()) : nullptr;
+  return Char ? Char->GetEquipmentComponent() : nullptr;
+}
+
+// 트레일 위치 갱신 (소켓은 장비 컴포넌트가 캐시한 본 인덱스로 조회)
+void UpdateTrailPositions(UEquipmentComponent *EqComp,
+                          UNiagaraComponent *Trail) {
+  if (const FWeaponTraceSockets *Sockets = EqComp->FindTraceSockets(
+          EEquipmentSlot::WeaponMain, TrailStartSocket, TrailEndSocket)) {
+    FVector Start, End;
+    if (Sockets->GetLocations(Start, End)) {
+      Trail->SetVariablePosition(TEXT("TraceStart"), Start);
+      Trail->SetVariablePosition(TEXT("TraceEnd"), End);
     }
   }
-  return nullptr;
+}
+} // namespace
+
+UNiagaraComponent *
+UANS_WeaponTrail::FindTrailComponent(UEquipmentComponent *EqComp) const {
+  return EqComp ? EqComp->GetActiveTrail(EEquipmentSlot::WeaponMain) : nullptr;
 }
 
 void UANS_WeaponTrail::NotifyBegin(
@@ -32,38 +46,30 @@ void UANS_WeaponTrail::NotifyBegin(
   if (!MeshComp || !TrailSystem)
     return;
 
-  ANonCharacterBase *Char = Cast<ANonCharacterBase>(MeshComp->GetOwner());
-  if (!Char)
-    return;
-
-  UEquipmentComponent *EqComp =
-      Char->FindComponentByClass<UEquipmentComponent>();
+  UEquipmentComponent *EqComp = GetEquipment(MeshComp);
   if (!EqComp)
     return;
 
-  if (AActor *SpawnedActor =
-          EqComp->GetEquippedActor(EEquipmentSlot::WeaponMain)) {
-    if (AWeaponBase *Weapon = Cast<AWeaponBase>(SpawnedActor)) {
-      if (Weapon->WeaponSkeletalMesh) {
-        // 기존 이펙트 제거
-        if (UNiagaraComponent *OldComp = FindTrailComponent(SpawnedActor)) {
-          OldComp->Deactivate();
-          OldComp->ComponentTags.Remove(FName("WeaponTrail"));
-        }
-
-        // 스켈레탈 메시의 `TraceStart` 뼈대(소켓) 기준으로 어태치
-        UNiagaraComponent *SpawnedTrailComponent =
-            UNiagaraFunctionLibrary::SpawnSystemAttached(
-                TrailSystem, Weapon->WeaponSkeletalMesh, FName("TraceStart"), FVector::ZeroVector,
-                FRotator::ZeroRotator, EAttachLocation::SnapToTarget, true);
-
-        if (SpawnedTrailComponent) {
-          SpawnedTrailComponent->ComponentTags.Add(FName("WeaponTrail"));
-          SpawnedTrailComponent->SetVariablePosition(
-              TEXT("TraceStart"), Weapon->WeaponSkeletalMesh->GetSocketLocation(FName("TraceStart")));
-          SpawnedTrailComponent->SetVariablePosition(
-              TEXT("TraceEnd"), Weapon->WeaponSkeletalMesh->GetSocketLocation(FName("TraceEnd")));
-        }
+  if (AWeaponBase *Weapon =
+          Cast<AWeaponBase>(EqComp->GetEquippedActor(EEquipmentSlot::WeaponMain))) {
+    if (Weapon->WeaponSkeletalMesh) {
+      // 기존 이펙트 제거
+      if (UNiagaraComponent *OldComp = FindTrailComponent(EqComp)) {
+        OldComp->Deactivate();
+        EqComp->SetActiveTrail(EEquipmentSlot::WeaponMain, nullptr);
+      }
+
+      // 스켈레탈 메시의 `TraceStart` 뼈대(소켓) 기준으로 어태치
+      UNiagaraComponent *SpawnedTrailComponent =
+          UNiagaraFunctionLibrary::SpawnSystemAttached(
+              TrailSystem, Weapon->WeaponSkeletalMesh, TrailStartSocket,
+              FVector::ZeroVector, FRotator::ZeroRotator,
+              EAttachLocation::SnapToTarget, true);
+
+      if (SpawnedTrailComponent) {
+        EqComp->SetActiveTrail(EEquipmentSlot::WeaponMain,
+                               SpawnedTrailComponent);
+        UpdateTrailPositions(EqComp, SpawnedTrailComponent);
       }
     }
   }
@@ -74,27 +80,12 @@ void UANS_WeaponTrail::NotifyTick(
     float FrameDeltaTime, const FAnimNotifyEventReference &EventReference) {
   Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
 
-  ANonCharacterBase *Char = Cast<ANonCharacterBase>(MeshComp->GetOwner());
-  if (!Char)
-    return;
-
-  UEquipmentComponent *EqComp =
-      Char->FindComponentByClass<UEquipmentComponent>();
+  UEquipmentComponent *EqComp = GetEquipment(MeshComp);
   if (!EqComp)
     return;
 
-  if (AActor *SpawnedActor =
-          EqComp->GetEquippedActor(EEquipmentSlot::WeaponMain)) {
-    if (AWeaponBase *Weapon = Cast<AWeaponBase>(SpawnedActor)) {
-      if (UNiagaraComponent *SpawnedTrailComponent = FindTrailComponent(SpawnedActor)) {
-        if (Weapon->WeaponSkeletalMesh) {
-          SpawnedTrailComponent->SetVariablePosition(
-              TEXT("TraceStart"), Weapon->WeaponSkeletalMesh->GetSocketLocation(FName("TraceStart")));
-          SpawnedTrailComponent->SetVariablePosition(
-              TEXT("TraceEnd"), Weapon->WeaponSkeletalMesh->GetSocketLocation(FName("TraceEnd")));
-        }
-      }
-    }
+  if (UNiagaraComponent *SpawnedTrailComponent = FindTrailComponent(EqComp)) {
+    UpdateTrailPositions(EqComp, SpawnedTrailComponent);
   }
 }
 
@@ -103,24 +94,15 @@ void UANS_WeaponTrail::NotifyEnd(
     const FAnimNotifyEventReference &EventReference) {
   Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-  ANonCharacterBase *Char = Cast<ANonCharacterBase>(MeshComp->GetOwner());
-  if (!Char)
-    return;
-
-  UEquipmentComponent *EqComp =
-      Char->FindComponentByClass<UEquipmentComponent>();
+  UEquipmentComponent *EqComp = GetEquipment(MeshComp);
   if (!EqComp)
     return;
 
-  if (AActor *SpawnedActor =
-          EqComp->GetEquippedActor(EEquipmentSlot::WeaponMain)) {
-    if (UNiagaraComponent *SpawnedTrailComponent =
-            FindTrailComponent(SpawnedActor)) {
-      // 나이아가라 렌더링 중지 요청 -> 이펙트 내부의 Lifetime에 맞게 서서히
-      // 죽음
-      SpawnedTrailComponent->Deactivate();
-      // 다음 타격에서 다시 찾히지 않게 태그만 먼저 뗀다
-      SpawnedTrailComponent->ComponentTags.Remove(FName("WeaponTrail"));
-    }
+  if (UNiagaraComponent *SpawnedTrailComponent = FindTrailComponent(EqComp)) {
+    // 나이아가라 렌더링 중지 요청 -> 이펙트 내부의 Lifetime에 맞게 서서히
+    // 죽음
+    SpawnedTrailComponent->Deactivate();
+    // 다음 타격에서 다시 찾히지 않게 캐시에서 먼저 뗀다
+    EqComp->SetActiveTrail(EEquipmentSlot::WeaponMain, nullptr);
   }
 }
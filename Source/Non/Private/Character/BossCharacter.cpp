@@ -6,11 +6,12 @@
 #include "UObject/UObjectIterator.h"
 #include "Data/BossDataAsset.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayEffectTypes.h"
 #include "GameplayAbilitySpec.h"
 #include "TimerManager.h"
-#include "Components/WidgetComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Effects/DamageNumberActor.h"
+#include "Effects/DamageNumberSubsystem.h"
 #include "GameplayEffect.h"
 #include "DrawDebugHelpers.h"
 
@@ -26,12 +27,8 @@ ABossCharacter::ABossCharacter()
     UIActivationZone->SetCollisionEnabled(ECollisionEnabled::QueryOnly); 
     UIActivationZone->SetCollisionProfileName(TEXT("Trigger"));
 
-    // 보스는 머리 위 HP바(Floating Widget)를 사용하지 않고 보스 전용 HUD UI를 사용하므로 컴포넌트를 제거합니다.
-    if (HPBarWidget)
-    {
-        HPBarWidget->DestroyComponent();
-        HPBarWidget = nullptr;
-    }
+    // 보스는 머리 위 HP바를 사용하지 않고 보스 전용 HUD UI를 사용합니다.
+    bUseOverheadHPBar = false;
 
     CurrentPhase = 1;
     bIsTransitioningPhase = false;
@@ -58,6 +55,13 @@ void ABossCharacter::BeginPlay()
         }
     }
 
+    // [New] 페이즈 판정은 서버에서 HP 변경 이벤트로만 수행 (HP바 갱신 빈도와 분리)
+    if (HasAuthority() && GetAbilitySystemComponent() && GetAttributeSet())
+    {
+        GetAbilitySystemComponent()->GetGameplayAttributeValueChangeDelegate(GetAttributeSet()->GetHPAttribute())
+            .AddUObject(this, &ABossCharacter::OnHealthChangedForPhase);
+    }
+
     // 블루프린트에서 수동으로 BossData를 넣었을 경우 동작하게끔 초기화
     if (BossData)
     {
@@ -84,8 +88,7 @@ void ABossCharacter::UpdateHPBar() const
             }
         }
 
-        // 2. 체력 변화에 따른 페이즈 검사
-        const_cast<ABossCharacter*>(this)->CheckPhaseTransition();
+        // [Changed] 페이즈 검사는 OnHealthChangedForPhase(서버)에서 처리
     }
 }
 
@@ -106,25 +109,49 @@ void ABossCharacter::InitBossData(const UBossDataAsset* InBossData)
     {
         InitFromDataAsset(InBossData); // 부모 클래스의 기본 초기화 (체력, 공격력 등)
         BossData = InBossData;
+        BuildPhaseBreakpoints();
         CurrentPhase = 1;
         ApplyPhase(1); // 1페이즈 스킬 즉시 지급
     }
 }
 
+void ABossCharacter::BuildPhaseBreakpoints()
+{
+    PhaseBreakpoints.Reset();
+    if (!BossData) return;
+
+    // 마지막 페이즈의 하한선은 쓰이지 않음. 뒤 페이즈 하한선이 앞보다 높게 잘못 들어가 있으면 앞 값으로 맞춤
+    float Previous = 1.f;
+    for (int32 i = 0; i + 1 < BossData->PhaseList.Num(); ++i)
+    {
+        Previous = FMath::Min(Previous, BossData->PhaseList[i].HealthThresholdPercent);
+        PhaseBreakpoints.Add(Previous);
+    }
+}
+
+void ABossCharacter::OnHealthChangedForPhase(const FOnAttributeChangeData& Data)
+{
+    // 회복으로는 페이즈가 되돌아가지 않음
+    if (Data.NewValue < Data.OldValue)
+    {
+        CheckPhaseTransition();
+    }
+}
+
 void ABossCharacter::CheckPhaseTransition()
 {
-    if (!GetAttributeSet() || bDied || bIsTransitioningPhase) return;
-    if (!BossData || BossData->PhaseList.Num() == 0) return;
-    
-    // 다음 페이즈가 있는지 확인
-    if (CurrentPhase >= BossData->PhaseList.Num()) return;
+    if (!HasAuthority() || !GetAttributeSet() || bDied || bIsTransitioningPhase) return;
 
-    float HealthPercent = GetAttributeSet()->GetHP() / FMath::Max(1.f, GetAttributeSet()->GetMaxHP());
+    // 다음 전환 지점 하나만 비교 (지나간 지점은 CurrentPhase 가 이미 넘어섰으므로 다시 발동하지 않음)
+    const int32 NextBreakpoint = CurrentPhase - 1;
+    if (!PhaseBreakpoints.IsValidIndex(NextBreakpoint)) return;
 
-    // 현재 페이즈 기준 하한선
-    float CurrentThreshold = BossData->PhaseList[CurrentPhase - 1].HealthThresholdPercent;
+    // 사망 처리(GA_Death)는 이후에 오므로 bDied 만으로는 막타를 거를 수 없음: 0 HP 에서는 전환하지 않음
+    const float CurHP = GetAttributeSet()->GetHP();
+    if (CurHP <= 0.f) return;
 
-    if (HealthPercent <= CurrentThreshold)
+    const float HealthPercent = CurHP / FMath::Max(1.f, GetAttributeSet()->GetMaxHP());
+    if (HealthPercent <= PhaseBreakpoints[NextBreakpoint])
     {
         ApplyPhase(CurrentPhase + 1);
     }
@@ -137,10 +164,13 @@ void ABossCharacter::ApplyPhase_Implementation(int32 TargetPhase)
     CurrentPhase = TargetPhase;
     bIsTransitioningPhase = true; // 무적 시작
     
-    // 1. 기존 페이즈 스킬들 제거
-    for (FGameplayAbilitySpecHandle Handle : PhaseAbilityHandles)
+    // 1. 기존 페이즈 스킬들 제거 (어빌리티 지급/해제는 서버에서만)
+    if (HasAuthority())
     {
-        GetAbilitySystemComponent()->ClearAbility(Handle);
+        for (FGameplayAbilitySpecHandle Handle : PhaseAbilityHandles)
+        {
+            GetAbilitySystemComponent()->ClearAbility(Handle);
+        }
     }
     PhaseAbilityHandles.Empty();
 
@@ -149,24 +179,21 @@ void ABossCharacter::ApplyPhase_Implementation(int32 TargetPhase)
     {
         const FBossPhaseData& PhaseData = BossData->PhaseList[CurrentPhase - 1];
 
-        // 2. 몽타주 재생 (포효 등)
-        if (PhaseData.TransitionMontage)
-        {
-            PlayAnimMontage(PhaseData.TransitionMontage);
-        }
-
-        // 3. 새 스킬 지급
-        for (TSubclassOf<UGameplayAbility> AbilityClass : PhaseData.GrantedSkills)
+        // 2. 새 스킬 지급 (어빌리티는 서버에서만)
+        if (HasAuthority())
         {
-            if (AbilityClass)
+            for (TSubclassOf<UGameplayAbility> AbilityClass : PhaseData.GrantedSkills)
             {
-                FGameplayAbilitySpec Spec(AbilityClass, 1, INDEX_NONE, this);
-                FGameplayAbilitySpecHandle Handle = GetAbilitySystemComponent()->GiveAbility(Spec);
-                PhaseAbilityHandles.Add(Handle);
+                if (AbilityClass)
+                {
+                    FGameplayAbilitySpec Spec(AbilityClass, 1, INDEX_NONE, this);
+                    FGameplayAbilitySpecHandle Handle = GetAbilitySystemComponent()->GiveAbility(Spec);
+                    PhaseAbilityHandles.Add(Handle);
+                }
             }
         }
 
-        // 4. 무적 지속시간 설정 후 해제 타이머 가동
+        // 3. 무적 지속시간 설정 후 해제 타이머 가동
         if (PhaseData.InvincibilityDuration > 0.0f)
         {
             FTimerHandle TempHandle;
@@ -185,12 +212,46 @@ void ABossCharacter::ApplyPhase_Implementation(int32 TargetPhase)
          EndPhaseTransition(); // 페이즈 데이터가 설정되지 않았어도 즉시 무적 해제
     }
 
-    OnBossPhaseChanged.Broadcast(CurrentPhase);
+    // 4. 몽타주(포효 등) + 이벤트: 서버는 전 클라이언트에 전파
+    if (HasAuthority())
+    {
+        Multicast_PhaseChanged(CurrentPhase);
+    }
+    else
+    {
+        HandlePhaseChanged(CurrentPhase);
+    }
 }
 
 void ABossCharacter::EndPhaseTransition()
 {
     bIsTransitioningPhase = false; // 무적 해제, 정상 전투 시작
+
+    // 무적 중(DoT 등)에 다음 하한선을 이미 넘었다면 이어서 전환 (ApplyPhase 안에서 재귀 호출되지 않도록 다음 틱)
+    if (HasAuthority())
+    {
+        GetWorldTimerManager().SetTimerForNextTick(this, &ABossCharacter::CheckPhaseTransition);
+    }
+}
+
+void ABossCharacter::Multicast_PhaseChanged_Implementation(int32 NewPhase)
+{
+    HandlePhaseChanged(NewPhase);
+}
+
+void ABossCharacter::HandlePhaseChanged(int32 NewPhase)
+{
+    CurrentPhase = NewPhase;
+
+    if (BossData && BossData->PhaseList.IsValidIndex(NewPhase - 1))
+    {
+        if (UAnimMontage* Montage = BossData->PhaseList[NewPhase - 1].TransitionMontage)
+        {
+            PlayAnimMontage(Montage);
+        }
+    }
+
+    OnBossPhaseChanged.Broadcast(NewPhase);
 }
 
 void ABossCharacter::OnUIZoneOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, 
@@ -252,15 +313,7 @@ void ABossCharacter::Multicast_SpawnDamageNumber_Implementation(float Amount, FV
         }
     }
 
-    FActorSpawnParameters SP;
-    SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-    SP.Owner = this;
-
     // [Final] 이제 UIActivationZone이 공격을 막지 않으므로, 정확한 타격 지점(WorldLocation)을 그대로 사용합니다.
-    FVector SpawnLoc = WorldLocation;
-
-    if (ADamageNumberActor* A = GetWorld()->SpawnActor<ADamageNumberActor>(SpawnClass, SpawnLoc, FRotator::ZeroRotator, SP))
-    {
-        A->InitWithFlags(Amount, bIsCritical);
-    }
+    UDamageNumberSubsystem::ShowNumber(this, SpawnClass, WorldLocation, Amount,
+        bIsCritical ? ENonDamageNumberCategory::Critical : ENonDamageNumberCategory::Normal);
 }
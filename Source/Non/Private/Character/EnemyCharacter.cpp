@@ -4,6 +4,7 @@
 #include "Ability/NonAbilitySystemComponent.h"
 #include "Ability/NonAttributeSet.h"
 #include "Ability/NonAttributeSet.h"
+#include "Ability/NonGameplayTags.h"
 #include "AbilitySystemComponent.h"
 #include "Abilities/GameplayAbility.h" // [Fix] Required for accessing UGameplayAbility class
 #include "GameplayEffect.h"
@@ -13,12 +14,15 @@
 
 #include "Animation/AnimMontage.h"
 
+#include "UI/EnemyHPBarSubsystem.h"
 #include "UI/EnemyHPBarWidget.h"
-#include "Components/WidgetComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "UObject/ObjectKey.h"
 #include "Character/NonCharacterBase.h"
+#include "Character/EnemyPartBoneTableSubsystem.h"
 #include "Inventory/InventoryComponent.h"
 
 #include "Blueprint/AIBlueprintHelperLibrary.h"
@@ -30,16 +34,25 @@
 #include "AIController.h"
 #include "AI/NonAIController.h"
 #include "Effects/DamageNumberActor.h"
+#include "Effects/DamageNumberSubsystem.h"
 #include "BrainComponent.h"
 #include "Components/SphereComponent.h"
-#include "Materials/MaterialInstanceDynamic.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
 #include "Data/EnemyDataAsset.h"
 #include "Combat/NonDamageHelpers.h" 
+#include "Combat/CombatResolverSubsystem.h"
+#include "Combat/CombatEventSubsystem.h"
+#include "System/LootSubsystem.h"
+#include "AI/EnemySpawner.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "Animation/AnimInstance.h"
 
 AEnemyCharacter::AEnemyCharacter()
 {
+    // 페이드는 머티리얼이 커스텀 프리미티브 데이터로 계산하므로 네이티브 Tick 은 없음
+    // (틱 자체는 켜 둠: 보스/BP 적의 Event Tick 이 계속 동작해야 함)
     PrimaryActorTick.bCanEverTick = true;
 
     AbilitySystemComponent = CreateDefaultSubobject<UNonAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
@@ -48,21 +61,6 @@ AEnemyCharacter::AEnemyCharacter()
 
     AttributeSet = CreateDefaultSubobject<UNonAttributeSet>(TEXT("AttributeSet"));
 
-    // HP Bar
-    HPBarWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("HPBar"));
-    if (HPBarWidget)
-    {
-        HPBarWidget->SetupAttachment(GetMesh());
-        HPBarWidget->SetRelativeLocation(FVector(0, 0, 120.f));
-        HPBarWidget->SetDrawAtDesiredSize(true);
-        HPBarWidget->SetWidgetSpace(EWidgetSpace::Screen);
-        HPBarWidget->SetTwoSided(false);
-        HPBarWidget->SetPivot(FVector2D(0.5f, 0.5f));
-        HPBarWidget->SetDrawSize(FIntPoint(120, 14));
-        HPBarWidget->SetVisibility(false);
-        HPBarWidget->SetWidgetClass(UEnemyHPBarWidget::StaticClass());
-    }
-
     // 이동
     bUseControllerRotationYaw = false;
     if (auto* Move = GetCharacterMovement())
@@ -78,7 +76,6 @@ AEnemyCharacter::AEnemyCharacter()
     //Fade
     SpawnFadeDuration = 0.6f;
     bUseSpawnFadeIn = true;
-    FadeParamName = TEXT("Fade");
 
     InteractCollision = CreateDefaultSubobject<USphereComponent>(TEXT("InteractCollision"));
     InteractCollision->SetupAttachment(GetRootComponent());
@@ -98,6 +95,15 @@ void AEnemyCharacter::InitFromDataAsset(const UEnemyDataAsset* InData)
     BaseAttack = InData->Attack;
     BaseDefense = InData->Defense;
     ExpReward = InData->ExpReward;
+
+    // [New] 드롭 테이블은 스폰 시점에 미리 컴파일 (처치 순간에는 굴림만)
+    if (HasAuthority())
+    {
+        if (ULootSubsystem* Loot = ULootSubsystem::Get(this))
+        {
+            Loot->Precompile(InData);
+        }
+    }
     // DataAsset에서 지정한 스탯들을 AttributeSet(GAS)에 직접 강제 주입
     if (AttributeSet)
     {
@@ -129,26 +135,24 @@ void AEnemyCharacter::BeginPlay()
 
     SpawnLocation = GetActorLocation();
 
-    if (AbilitySystemComponent)
+    // [Pool] 재사용 시 되돌릴 기본 상태 기록
+    if (USkeletalMeshComponent* Skel = GetMesh())
     {
-        AbilitySystemComponent->InitAbilityActorInfo(this, this);
+        DefaultMeshRelativeTransform = Skel->GetRelativeTransform();
+        DefaultMeshCollisionProfile = Skel->GetCollisionProfileName();
     }
-    BindAttributeDelegates();
+    DefaultCapsuleResponses = GetCapsuleComponent()->GetCollisionResponseToChannels();
 
-    if (HPBarWidget)
+    if (AbilitySystemComponent)
     {
-        HPBarWidget->InitWidget();
-        UpdateHPBar();
-        HPBarWidget->SetVisibility(false);
+        AbilitySystemComponent->InitAbilityActorInfo(this, this);
     }
+    BindAttributeDelegates();
 
     // [Legacy Removed] AnimSet assignments (GAS uses GA_Death/GA_Hit)
 
-    if (bUseSpawnFadeIn)
-    {
-        InitSpawnFadeMIDs();
-        PlaySpawnFadeIn(SpawnFadeDuration);
-    }
+    // 페이드를 쓰지 않아도 타임라인(시작 0, 길이 ~0)은 써 둬야 머티리얼이 0/0 으로 나누지 않음
+    PlaySpawnFadeIn(bUseSpawnFadeIn ? SpawnFadeDuration : 0.f);
 
     if (InteractCollision)
     {
@@ -177,13 +181,6 @@ void AEnemyCharacter::BeginPlay()
     UpdateHPBarVisibility();
 }
 
-void AEnemyCharacter::Tick(float DeltaSeconds)
-{
-    Super::Tick(DeltaSeconds);
-
-    TickSpawnFade();
-}
-
 // [Removed] GetLifetimeReplicatedProps (Reverted Replication) -> Restored for EnemyData
 void AEnemyCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
@@ -248,8 +245,9 @@ void AEnemyCharacter::InitializeAttributes()
     }
 
     // [New] 기본 어빌리티 부여 (GA_HitReaction 등) - Server Only
-    if (HasAuthority() && AbilitySystemComponent)
+    if (HasAuthority() && AbilitySystemComponent && !bDefaultAbilitiesGranted)
     {
+        bDefaultAbilitiesGranted = true;
         for (const TSubclassOf<UGameplayAbility>& AbilityClass : DefaultAbilities)
         {
             if (AbilityClass)
@@ -283,18 +281,23 @@ void AEnemyCharacter::BindAttributeDelegates()
 
 void AEnemyCharacter::UpdateHPBar() const
 {
-    if (!HPBarWidget) return;
+    if (!bUseOverheadHPBar) return;
 
-    if (UEnemyHPBarWidget* W = Cast<UEnemyHPBarWidget>(HPBarWidget->GetUserWidgetObject()))
-    {
-        const float Cur = AttributeSet ? AttributeSet->GetHP() : 0.f;
-        const float Max = AttributeSet ? AttributeSet->GetMaxHP() : 1.f;
-        W->SetHP(Cur, Max);
-    }
-    else
-    {
+    // 표시 중인 바만 갱신됨 (오버레이는 값이 바뀐 프레임에만 다시 그림)
+    const float Cur = AttributeSet ? AttributeSet->GetHP() : 0.f;
+    const float Max = AttributeSet ? AttributeSet->GetMaxHP() : 1.f;
+    UEnemyHPBarSubsystem::SetBarRatio(this, Cur / FMath::Max(1.f, Max));
+}
 
-    }
+FVector AEnemyCharacter::GetHPBarWorldLocation() const
+{
+    const USceneComponent* Anchor = GetMesh() ? static_cast<const USceneComponent*>(GetMesh()) : GetRootComponent();
+    return Anchor->GetComponentLocation() + FVector(0.f, 0.f, HPBarHeight);
+}
+
+const UEnemyHPBarWidget* AEnemyCharacter::GetHPBarStyle() const
+{
+    return HPBarStyleClass ? HPBarStyleClass->GetDefaultObject<UEnemyHPBarWidget>() : GetDefault<UEnemyHPBarWidget>();
 }
 
 bool AEnemyCharacter::IsDead() const
@@ -311,10 +314,7 @@ void AEnemyCharacter::StartDeathSequence()
     bDied = true;
     
     // 죽자마자 바로 HP바 끄기
-    if (HPBarWidget)
-    {
-        HPBarWidget->SetVisibility(false);
-    }
+    UEnemyHPBarSubsystem::SetBarVisible(this, false, 0.f);
 
     OnEnemyDied.Broadcast(this);
 
@@ -326,6 +326,15 @@ void AEnemyCharacter::StartDeathSequence()
             LastDamageInstigator->GainExp(ExpReward);
         }
     }
+
+    // [New] 드롭: 픽업 액터를 스폰하지 않고 처치자 인벤토리에 한 번에 지급
+    if (HasAuthority() && EnemyData && LastDamageInstigator.IsValid())
+    {
+        if (ULootSubsystem* Loot = ULootSubsystem::Get(this))
+        {
+            Loot->GrantLoot(EnemyData, LastDamageInstigator->GetInventoryComponent());
+        }
+    }
     
     if (UCharacterMovementComponent* Move = GetCharacterMovement())
     {
@@ -346,6 +355,8 @@ void AEnemyCharacter::StartDeathSequence()
         AIC->StopMovement();
         
         // 뇌(컨트롤러)와 몸통(캐릭터)의 연결을 아예 끊어버립니다.
+        // (풀 모드에서는 재사용 시 같은 컨트롤러로 다시 빙의)
+        PooledController = AIC;
         AIC->UnPossess();
     }
 
@@ -430,7 +441,7 @@ UAnimMontage* AEnemyCharacter::GetHitMontage(FGameplayTag HitTag) const
     }
 
     // 2. 정확한 태그를 못 찾았으면 디폴트(Light)로 떨어짐
-    FGameplayTag DefaultTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Hit.Light"), false);
+    FGameplayTag DefaultTag = NonGameplayTags::Effect_Hit_Light;
     if (UAnimMontage* const* DefaultMontage = HitMontages.Find(DefaultTag))
     {
         return *DefaultMontage;
@@ -520,13 +531,13 @@ void AEnemyCharacter::ApplyDamageAt(float Amount, AActor* DamageInstigator, cons
         FGameplayEffectSpecHandle Spec = AbilitySystemComponent->MakeOutgoingSpec(GE_Damage, 1.f, Ctx);
         if (Spec.IsValid())
         {
-            const FGameplayTag Tag_Damage = FGameplayTag::RequestGameplayTag(TEXT("Data.Damage"), false);
+            const FGameplayTag Tag_Damage = NonGameplayTags::Data_Damage;
             Spec.Data->SetSetByCallerMagnitude(Tag_Damage, -Amount);
 
                 // [New] Critical 정보 전달 (AttributeSet에서 확인용)
             if (bIsCritical)
             {
-                Spec.Data->AddDynamicAssetTag(FGameplayTag::RequestGameplayTag(TEXT("Effect.Damage.Critical"), false));
+                Spec.Data->AddDynamicAssetTag(NonGameplayTags::Effect_Damage_Critical);
             }
 
             // [New] Hit Reaction 정보 전달 (AttributeSet에서 Event trigger용)
@@ -570,21 +581,12 @@ void AEnemyCharacter::ApplyDamageAt(float Amount, AActor* DamageInstigator, cons
     // 전투 상태 진입(HP바 표시 등 - 서버 로직)
     EnterCombat();
 
-    // [New] 때린 플레이어에게 "체력바 띄워라" 알림 (Client RPC)
-    if (DamageInstigator)
+    // [New] 때린 플레이어에게 "체력바 띄워라" 알림 (프레임 단위 전투 이벤트로 묶어서 전송)
+    if (ANonCharacterBase* Player = Cast<ANonCharacterBase>(DamageInstigator))
     {
-
-        
-        if (ANonCharacterBase* Player = Cast<ANonCharacterBase>(DamageInstigator))
-        {
-            Player->ClientOnAttackHitEnemy(this);
-        }
-        else if (APawn* InstPawn = Cast<APawn>(DamageInstigator))
+        if (APlayerController* PC = Cast<APlayerController>(Player->GetController()))
         {
-            if (ANonCharacterBase* PlayerFromPawn = Cast<ANonCharacterBase>(InstPawn->GetController()->GetPawn())) // Controller Pawn check
-            {
-               PlayerFromPawn->ClientOnAttackHitEnemy(this);
-            }
+            UCombatEventSubsystem::Post(this, ECombatEventType::HitConfirm, this, WorldLocation, 0.f, PC);
         }
     }
 }
@@ -600,17 +602,8 @@ void AEnemyCharacter::Multicast_SpawnDamageNumber_Implementation(float Amount, F
 {
     if (!GetWorld()) return;
 
-    TSubclassOf<ADamageNumberActor> SpawnClass = DamageNumberActorClass;
-    if (!SpawnClass) SpawnClass = ADamageNumberActor::StaticClass();
-
-    FActorSpawnParameters SP;
-    SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-    SP.Owner = this;
-
-     if (ADamageNumberActor* A = GetWorld()->SpawnActor<ADamageNumberActor>(SpawnClass, WorldLocation + FVector(0,0,30), FRotator::ZeroRotator, SP))
-    {
-        A->InitWithFlags(Amount, bIsCritical);
-    }
+    UDamageNumberSubsystem::ShowNumber(this, DamageNumberActorClass, WorldLocation + FVector(0,0,30), Amount,
+        bIsCritical ? ENonDamageNumberCategory::Critical : ENonDamageNumberCategory::Normal);
 }
 
 void AEnemyCharacter::EnterCombat()
@@ -632,11 +625,11 @@ void AEnemyCharacter::LeaveCombat()
 
 void AEnemyCharacter::UpdateHPBarVisibility()
 {
-    if (!HPBarWidget) return;
+    if (!bUseOverheadHPBar) return;
 
     if (IsDead())
     {
-        HPBarWidget->SetVisibility(false);
+        UEnemyHPBarSubsystem::SetBarVisible(this, false, 0.f);
         return;
     }
 
@@ -644,12 +637,10 @@ void AEnemyCharacter::UpdateHPBarVisibility()
     // 이전의 bInCombat, bAggro, Cur < Max 로직은 모두 제거됨 (로컬 전용)
     const bool bShouldShow = bClientHPBarVisible;
 
-    HPBarWidget->SetVisibility(bShouldShow);
-
-    if (bShouldShow)
-    {
-         UpdateHPBar(); // 값이 최신인지 확인하기 위해 강제 갱신
-    }
+    // 표시할 때 현재 값도 함께 넘김
+    const float Cur = AttributeSet ? AttributeSet->GetHP() : 0.f;
+    const float Max = AttributeSet ? AttributeSet->GetMaxHP() : 1.f;
+    UEnemyHPBarSubsystem::SetBarVisible(this, bShouldShow, Cur / FMath::Max(1.f, Max));
 }
 
 void AEnemyCharacter::ShowLocalHPBar(float Duration)
@@ -693,7 +684,7 @@ void AEnemyCharacter::TryStartAttack()
     if (AbilitySystemComponent)
     {
         // GAS 기반 공격 시도
-        const FGameplayTag AttackTag = FGameplayTag::RequestGameplayTag(TEXT("Ability.Attack"), false);
+        const FGameplayTag AttackTag = NonGameplayTags::Ability_Attack;
         if (AttackTag.IsValid())
         {
             FGameplayTagContainer ActivateTags; 
@@ -785,58 +776,42 @@ void AEnemyCharacter::OnAttackHitBegin(UPrimitiveComponent* Overlapped, AActor*
                 }
             }
         }
-        // 3) 데미지 계산: 적 스탯 → 원 데미지 → 플레이어 방어/마저 반영
-        const float RawDamage = UNonDamageHelpers::ComputeDamageFromAttributes(
-            this,               // 공격자: 적
-            AttackPowerScale,   // 스킬 계수 (BP에서 튜닝)
-            AttackDamageType);  // 물리/마법
-
-        if (RawDamage > 0.f)
-        {
-            const float FinalDamage = UNonDamageHelpers::ApplyDefenseReduction(
-                Player, RawDamage, AttackDamageType
-            );
-
-            if (FinalDamage > 0.f)
-            {
-                Player->ApplyDamageAt(FinalDamage, this, HitLoc);
-            }
-        }
+        // 3) 데미지 요청: 적 스탯 → 원 데미지 → 플레이어 방어/마저 반영
+        //    (계산/적용은 전투 해석기가 프레임 끝에 일괄 처리)
+        FCombatHitRequest Request;
+        Request.Attacker = this;               // 공격자: 적
+        Request.DamageCauser = this;
+        Request.Target = Player;
+        Request.InstigatorController = GetController();
+        Request.PowerScale = AttackPowerScale; // 스킬 계수 (BP에서 튜닝)
+        Request.DamageType = AttackDamageType; // 물리/마법
+        Request.HitLocation = HitLoc;
+        UCombatResolverSubsystem::Submit(this, MoveTemp(Request));
     }
 }
 
 // ── Fade Functions ──
-void AEnemyCharacter::InitSpawnFadeMIDs()
+void AEnemyCharacter::SetFadeTimeline(float StartTime, float SignedDuration)
 {
-    SpawnFadeMIDs.Reset();
-    if (!GetMesh()) return;
-
-    const int32 NumMats = GetMesh()->GetNumMaterials();
-    for (int32 i = 0; i < NumMats; ++i)
+    // 머티리얼: Fade = saturate((Time - Start) / abs(Duration)), Duration < 0 이면 1 - Fade
+    if (USkeletalMeshComponent* Skel = GetMesh())
     {
-        UMaterialInterface* Mat = GetMesh()->GetMaterial(i);
-        if (Mat)
-        {
-            UMaterialInstanceDynamic* MID = GetMesh()->CreateDynamicMaterialInstance(i, Mat);
-            if (MID)
-            {
-                SpawnFadeMIDs.Add(MID);
-            }
-        }
+        Skel->SetCustomPrimitiveDataFloat(FadeCustomDataIndex, StartTime);
+        Skel->SetCustomPrimitiveDataFloat(FadeCustomDataIndex + 1, SignedDuration);
     }
 }
 
 void AEnemyCharacter::PlaySpawnFadeIn(float Duration)
 {
     bIsFadingOut = false; // FadeIn 모드
+    GetWorldTimerManager().ClearTimer(SpawnFadeTimer);
+
     if (Duration < 0.f) Duration = SpawnFadeDuration;
     if (Duration <= 0.01f)
     {
-        // 즉시 완료
-        for (auto& MID : SpawnFadeMIDs)
-        {
-            if (MID) MID->SetScalarParameterValue(FadeParamName, 1.f); // 1=보임
-        }
+        // 즉시 완료 (시작 시각 0, 길이 ~0 → 항상 1=보임)
+        bSpawnFadeActive = false;
+        SetFadeTimeline(0.f, KINDA_SMALL_NUMBER);
         return;
     }
 
@@ -844,6 +819,10 @@ void AEnemyCharacter::PlaySpawnFadeIn(float Duration)
     SpawnFadeStartTime = GetWorld()->GetTimeSeconds();
     bSpawnFadeActive = true;
 
+    // 진행은 머티리얼이 계산하고, 게임 쪽은 끝나는 시점만 타이머로 받음
+    SetFadeTimeline(SpawnFadeStartTime, Duration);
+    GetWorldTimerManager().SetTimer(SpawnFadeTimer, this, &AEnemyCharacter::OnFadeTimelineFinished, Duration, false);
+
     // AI/이동 정지
     if (bPauseAIWhileFading)
     {
@@ -858,60 +837,41 @@ void AEnemyCharacter::PlaySpawnFadeIn(float Duration)
             Move->MaxWalkSpeed = 0.f;  // 혹은 DisableMovement
         }
     }
-
-    // 초기값 세팅 (0.0 = 투명에서 시작한다고 가정)
-    for (auto& MID : SpawnFadeMIDs)
-    {
-        if (MID) MID->SetScalarParameterValue(FadeParamName, 0.f);
-    }
 }
 
-void AEnemyCharacter::TickSpawnFade()
+void AEnemyCharacter::OnFadeTimelineFinished()
 {
     if (!bSpawnFadeActive) return;
+    bSpawnFadeActive = false;
 
-    float Now = GetWorld()->GetTimeSeconds();
-    float Elapsed = Now - SpawnFadeStartTime;
-    float Alpha = FMath::Clamp(Elapsed / SpawnFadeLen, 0.f, 1.f);
-
-    // FadeIn(0->1), FadeOut(1->0)
-    float Val = bIsFadingOut ? (1.f - Alpha) : Alpha;
-
-    for (auto& MID : SpawnFadeMIDs)
-    {
-        if (MID) MID->SetScalarParameterValue(FadeParamName, Val);
-    }
-
-    if (Alpha >= 1.f)
+    if (bIsFadingOut)
     {
-        bSpawnFadeActive = false;
-        
-        if (bIsFadingOut)
+        // [Pool] 풀 모드 스포너가 받아주면 삭제하지 않고 보관
+        AEnemySpawner* Spawner = OwningSpawner.Get();
+        if (!(HasAuthority() && Spawner && Spawner->ReleaseToPool(this)))
         {
             Destroy(); // 페이드 아웃 끝나면 삭제
         }
-        else
-        {
-            OnSpawnFadeFinished(); // 페이드 인 끝나면 AI 시작
-        }
+    }
+    else
+    {
+        OnSpawnFadeFinished(); // 페이드 인 끝나면 AI 시작
     }
 }
 
 void AEnemyCharacter::PlaySpawnFadeOut_Implementation(float Duration)
 {
     if (Duration <= 0.f) Duration = 1.0f;
-    
-    // 만약 클라이언트에서 MID가 아직 없다면 생성 시도 (안전장치)
-    if (SpawnFadeMIDs.Num() == 0)
-    {
-        InitSpawnFadeMIDs();
-    }
 
     SpawnFadeLen = Duration;
     SpawnFadeStartTime = GetWorld()->GetTimeSeconds();
     bSpawnFadeActive = true;
     bIsFadingOut = true;
 
+    // 음수 길이 = 1 → 0 페이드 아웃
+    SetFadeTimeline(SpawnFadeStartTime, -Duration);
+    GetWorldTimerManager().SetTimer(SpawnFadeTimer, this, &AEnemyCharacter::OnFadeTimelineFinished, Duration, false);
+
     // 아웃라인도 끄기
     SetInteractionOutline(false);
 }
@@ -936,6 +896,147 @@ void AEnemyCharacter::OnSpawnFadeFinished()
     }
 }
 
+// ── Pooling ──
+void AEnemyCharacter::DeactivateForPool()
+{
+    bInPool = true;
+
+    GetWorldTimerManager().ClearAllTimersForObject(this);
+
+    if (AAIController* AIC = Cast<AAIController>(GetController()))
+    {
+        PooledController = AIC;
+        AIC->UnPossess();
+    }
+
+    if (UCharacterMovementComponent* Move = GetCharacterMovement())
+    {
+        Move->StopMovementImmediately();
+        Move->DisableMovement();
+        Move->SetComponentTickEnabled(false);
+    }
+
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    SetActorTickEnabled(false);
+}
+
+void AEnemyCharacter::ActivateFromPool(const FVector& Location, const FRotator& Rotation)
+{
+    bInPool = false;
+
+    SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+    SpawnLocation = Location;
+
+    // 1) GAS: 사망 어빌리티/효과/태그 정리 후 데이터에셋 기본값으로
+    if (AbilitySystemComponent)
+    {
+        AbilitySystemComponent->CancelAllAbilities();
+
+        for (const FActiveGameplayEffectHandle& Handle : AbilitySystemComponent->GetActiveEffects(FGameplayEffectQuery()))
+        {
+            AbilitySystemComponent->RemoveActiveGameplayEffect(Handle);
+        }
+
+        const FGameplayTag DeadTag = FGameplayTag::RequestGameplayTag(DeadTagName, false);
+        if (DeadTag.IsValid())
+        {
+            AbilitySystemComponent->SetLooseGameplayTagCount(DeadTag, 0);
+        }
+    }
+    InitFromDataAsset(EnemyData);
+    InitializeAttributes();
+
+    // 2) 전투/어그로 상태
+    bAggro = false;
+    bAggroByHit = false;
+    LastAggroByHitTime = -1000.f;
+    LastDamageInstigator.Reset();
+    NextAttackAllowedTime = 0.f;
+    EnterRangeTime = -1.f;
+    HitOnce.Reset();
+    ResetPartDamage();
+
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+    SetActorTickEnabled(PrimaryActorTick.bStartWithTickEnabled);
+
+    if (UCharacterMovementComponent* Move = GetCharacterMovement())
+    {
+        Move->SetComponentTickEnabled(true);
+        Move->SetMovementMode(MOVE_Walking);
+    }
+
+    // 3) 컨트롤러 재사용 (블랙보드는 초기값으로)
+    if (AAIController* AIC = PooledController.Get())
+    {
+        if (UBlackboardComponent* BB = AIC->GetBlackboardComponent())
+        {
+            if (UBlackboardData* BBAsset = BB->GetBlackboardAsset())
+            {
+                BB->InitializeBlackboard(*BBAsset);
+            }
+        }
+        AIC->Possess(this);
+    }
+    if (!GetController())
+    {
+        SpawnDefaultController();
+    }
+
+    // 4) 시체/래그돌/페이드 상태 복원 (클라이언트 포함)
+    Multicast_ResetForReuse();
+}
+
+void AEnemyCharacter::Multicast_ResetForReuse_Implementation()
+{
+    GetWorldTimerManager().ClearTimer(CorpseRemoveTimerHandle);
+    GetWorldTimerManager().ClearTimer(CombatTimeoutTimer);
+    GetWorldTimerManager().ClearTimer(ClientHPBarTimer);
+
+    bDied = false;
+    bLootAvailable = false;
+    bLooted = false;
+    bInCombat = false;
+    bClientHPBarVisible = false;
+
+    if (USkeletalMeshComponent* Skel = GetMesh())
+    {
+        Skel->SetAllBodiesSimulatePhysics(false);
+        Skel->SetSimulatePhysics(false);
+        Skel->SetCollisionProfileName(DefaultMeshCollisionProfile);
+        if (Skel->GetAttachParent() != GetCapsuleComponent())
+        {
+            Skel->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+        }
+        Skel->SetRelativeTransform(DefaultMeshRelativeTransform);
+        Skel->bPauseAnims = false;
+        Skel->SetComponentTickEnabled(true);
+
+        if (UAnimInstance* Anim = Skel->GetAnimInstance())
+        {
+            Anim->StopAllMontages(0.f);
+        }
+    }
+
+    GetCapsuleComponent()->SetCollisionResponseToChannels(DefaultCapsuleResponses);
+
+    // FreezeDeathPose 에서 분리한 상호작용 콜리전을 다시 루트에 부착
+    if (InteractCollision)
+    {
+        InteractCollision->AttachToComponent(GetRootComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+        InteractCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    }
+    SetInteractionOutline(false);
+
+    UpdateHPBar();
+    UpdateHPBarVisibility();
+
+    // 커스텀 프리미티브 데이터만 다시 써서 페이드 인 (MID 할당 없음)
+    bSpawnFadeActive = false;
+    PlaySpawnFadeIn(bUseSpawnFadeIn ? SpawnFadeDuration : 0.f);
+}
+
 // ── Interaction ──
 void AEnemyCharacter::EnableCorpseInteraction()
 {
@@ -954,15 +1055,8 @@ void AEnemyCharacter::Interact_Implementation(ANonCharacterBase* Interactor)
 {
     if (!bLootAvailable || bLooted) return;
 
-    if (Interactor)
-    {
-        // 예: 아이템 드랍
-        // ... (Drop Logic) ...
-
-        
-        // 인벤토리에 아이템 추가 로직 등등 호출
-        // Interactor->GetInventory()->Add...
-    }
+    // 드롭 아이템은 처치 시점에 ULootSubsystem 이 처치자 인벤토리로 바로 지급함
+    // 여기서는 시체 정리만 처리
 
     bLooted = true;
     bLootAvailable = false;
@@ -1076,29 +1170,23 @@ void AEnemyCharacter::ProcessPartDamage(FName BoneName, float Damage)
     USkeletalMeshComponent* MeshComp = GetMesh();
     if (!MeshComp) return;
 
-    // 1. 맞은 뼈부터 부모를 타고 올라가며 에디터에 등록된 '파괴 가능 부위'인지 찾습니다.
-    FName CurrentBone = BoneName;
-    FName TargetPartBone = NAME_None;
+    if (!EnsurePartBoneTable()) return;
 
-    while (CurrentBone != NAME_None)
-    {
-        if (PartHealthMap.Contains(CurrentBone))
-        {
-            TargetPartBone = CurrentBone;
-            break;
-        }
-        CurrentBone = MeshComp->GetParentBone(CurrentBone);
-    }
+    // 1. 맞은 뼈가 속한 '파괴 가능 부위' (부모 뼈 탐색은 표를 만들 때 이미 끝남)
+    const int32 BoneIndex = MeshComp->GetBoneIndex(BoneName);
+    const int32 Slot = PartBoneTable->BoneToPart.IsValidIndex(BoneIndex) ? PartBoneTable->BoneToPart[BoneIndex] : INDEX_NONE;
 
     // 2. 등록된 부위를 찾았고, 아직 파괴되지 않았다면 데미지 적용
-    if (TargetPartBone != NAME_None && !BrokenParts.Contains(TargetPartBone))
+    if (Slot != INDEX_NONE && !BrokenPartSlots[Slot])
     {
-        float& CurrentHealth = PartHealthMap[TargetPartBone];
+        const FName TargetPartBone = PartBoneTable->PartBones[Slot];
+        float& CurrentHealth = PartHealth[Slot];
         CurrentHealth -= Damage;
 
         // 3. 부위 파괴 판정
         if (CurrentHealth <= 0.f)
         {
+            BrokenPartSlots[Slot] = true;
             BrokenParts.Add(TargetPartBone);
             
             // 블루프린트 이벤트 호출 (이펙트, 메쉬 숨기기 등을 여기서 처리하세요!)
@@ -1113,7 +1201,7 @@ void AEnemyCharacter::ProcessPartDamage(FName BoneName, float Damage)
 
                     // ── [추가] AI 일시 정지를 위한 태그 부여 ──
                     // 보스에게 '피격 상태' 태그를 부여합니다.
-                    const FGameplayTag StunTag = FGameplayTag::RequestGameplayTag(TEXT("State.HitReacting"));
+                    const FGameplayTag StunTag = NonGameplayTags::State_HitReacting;
                     AbilitySystemComponent->AddLooseGameplayTag(StunTag);
 
                     // 2초 뒤에 태그를 다시 제거하는 타이머 (이 시간 동안 AI가 멈춥니다)
@@ -1145,3 +1233,56 @@ void AEnemyCharacter::ProcessPartDamage(FName BoneName, float Damage)
         }
     }
 }
+
+bool AEnemyCharacter::EnsurePartBoneTable()
+{
+    const USkeletalMeshComponent* MeshComp = GetMesh();
+    const USkeletalMesh* Mesh = MeshComp ? MeshComp->GetSkeletalMeshAsset() : nullptr;
+    if (!Mesh) return false;
+
+    if (PartBoneTable.IsValid() && PartBoneTable->Mesh == TObjectKey<USkeletalMesh>(Mesh))
+    {
+        return true;
+    }
+
+    TArray<FName> PartBones;
+    PartHealthMap.GenerateKeyArray(PartBones);
+    PartBones.Sort(FNameLexicalLess());
+
+    PartBoneTable = UEnemyPartBoneTableSubsystem::Resolve(this, Mesh, PartBones);
+
+    // 메시가 바뀐 경우라도 부위 구성은 같으므로 진행 중인 체력은 유지
+    if (PartHealth.Num() != PartBones.Num())
+    {
+        PartHealth.SetNumUninitialized(PartBones.Num());
+        for (int32 Slot = 0; Slot < PartBones.Num(); ++Slot)
+        {
+            PartHealth[Slot] = PartHealthMap.FindChecked(PartBones[Slot]);
+        }
+        BrokenPartSlots.Init(false, PartBones.Num());
+    }
+    return true;
+}
+
+void AEnemyCharacter::ResetPartDamage()
+{
+    // 파괴로 부여한 영구 태그도 함께 회수
+    if (AbilitySystemComponent)
+    {
+        for (const FName& Part : BrokenParts)
+        {
+            if (const FGameplayTag* Tag = PartBreakTags.Find(Part))
+            {
+                if (Tag->IsValid())
+                {
+                    AbilitySystemComponent->SetLooseGameplayTagCount(*Tag, 0);
+                }
+            }
+        }
+    }
+
+    PartBoneTable.Reset();
+    PartHealth.Reset();
+    BrokenPartSlots.Reset();
+    BrokenParts.Reset();
+}
@@ -0,0 +1,103 @@
+#include "Character/EnemyPartBoneTableSubsystem.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+
+void UEnemyPartBoneTableSubsystem::Deinitialize()
+{
+    Tables.Reset();
+    Super::Deinitialize();
+}
+
+UEnemyPartBoneTableSubsystem* UEnemyPartBoneTableSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UEnemyPartBoneTableSubsystem>() : nullptr;
+}
+
+TSharedPtr<const FEnemyPartBoneTable> UEnemyPartBoneTableSubsystem::Resolve(const UObject* WorldContextObject, const USkeletalMesh* Mesh, const TArray<FName>& PartBones)
+{
+    if (!Mesh) return nullptr;
+
+    if (UEnemyPartBoneTableSubsystem* Subsystem = Get(WorldContextObject))
+    {
+        return Subsystem->FindOrBuild(Mesh, PartBones);
+    }
+    return BuildTable(Mesh, PartBones);
+}
+
+TSharedPtr<const FEnemyPartBoneTable> UEnemyPartBoneTableSubsystem::FindOrBuild(const USkeletalMesh* Mesh, const TArray<FName>& PartBones)
+{
+    if (!Mesh) return nullptr;
+
+    const int32 NumBones = Mesh->GetRefSkeleton().GetNum();
+
+    if (TArray<TSharedPtr<const FEnemyPartBoneTable>>* MeshTables = Tables.Find(Mesh))
+    {
+        for (int32 i = MeshTables->Num() - 1; i >= 0; --i)
+        {
+            // 리임포트로 뼈 구성이 바뀐 표는 버림
+            if ((*MeshTables)[i]->BoneToPart.Num() != NumBones)
+            {
+                MeshTables->RemoveAtSwap(i);
+            }
+            else if ((*MeshTables)[i]->PartBones == PartBones)
+            {
+                return (*MeshTables)[i];
+            }
+        }
+    }
+    else
+    {
+        // 새 메시가 들어올 때만 훑음 (메시 종류 수만큼)
+        PruneUnloadedMeshes();
+    }
+
+    TSharedRef<FEnemyPartBoneTable> Table = BuildTable(Mesh, PartBones);
+    Tables.FindOrAdd(Mesh).Add(Table);
+    return Table;
+}
+
+TSharedRef<FEnemyPartBoneTable> UEnemyPartBoneTableSubsystem::BuildTable(const USkeletalMesh* Mesh, const TArray<FName>& PartBones)
+{
+    const FReferenceSkeleton& RefSkeleton = Mesh->GetRefSkeleton();
+    const int32 NumBones = RefSkeleton.GetNum();
+
+    TSharedRef<FEnemyPartBoneTable> Table = MakeShared<FEnemyPartBoneTable>();
+    Table->Mesh = Mesh;
+    Table->PartBones = PartBones;
+    Table->BoneToPart.Init(INDEX_NONE, NumBones);
+
+    // 부모 뼈가 항상 자식보다 앞에 있으므로 한 번 훑으면 "가장 가까운 부위 조상"이 정해짐
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        int32 Slot = PartBones.IndexOfByKey(RefSkeleton.GetBoneName(BoneIndex));
+        if (Slot == INDEX_NONE)
+        {
+            const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+            Slot = ParentIndex != INDEX_NONE ? Table->BoneToPart[ParentIndex] : INDEX_NONE;
+        }
+        Table->BoneToPart[BoneIndex] = Slot;
+    }
+    return Table;
+}
+
+int32 UEnemyPartBoneTableSubsystem::GetNumCachedTables() const
+{
+    int32 Num = 0;
+    for (const TPair<TObjectKey<USkeletalMesh>, TArray<TSharedPtr<const FEnemyPartBoneTable>>>& Pair : Tables)
+    {
+        Num += Pair.Value.Num();
+    }
+    return Num;
+}
+
+void UEnemyPartBoneTableSubsystem::PruneUnloadedMeshes()
+{
+    for (auto It = Tables.CreateIterator(); It; ++It)
+    {
+        if (!It->Key.ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include "Ability/GA_ComboBase.h"
 #include "Ability/NonAbilitySystemComponent.h"
 #include "Ability/NonAttributeSet.h"
+#include "Ability/NonGameplayTags.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayAbilitySpec.h"
 #include "GameplayEffect.h"
@@ -27,6 +28,8 @@
 #include "Camera/CameraActor.h"
 #include "Data/LevelData.h"
 #include "Effects/DamageNumberActor.h"
+#include "Effects/DamageNumberSubsystem.h"
+#include "Combat/CombatEventSubsystem.h"
 #include "Equipment/EquipmentComponent.h"
 #include "Inventory/InventoryComponent.h" // [Fix] Moved to global scope
 #include "Inventory/InventoryItem.h"
@@ -187,6 +190,7 @@ void ANonCharacterBase::BeginPlay() {
     WalkSpeed_Default = Move->MaxWalkSpeed;
   }
   RefreshWeaponStance();
+  BindLocomotionStateEvents();
   UpdateStrafeYawFollowBySpeed();
 
   // ── GAS Attribute 변경 델리게이트: UI 업데이트 + 사망 체크를 한 번에 처리 ──
@@ -308,6 +312,8 @@ void ANonCharacterBase::BeginPlay() {
 }
 
 void ANonCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  UnbindTargetHUDEvents();
+
   Super::EndPlay(EndPlayReason);
 
   // [New] 캐릭터 소멸 시(맵 이동, 종료 등) 자동 저장
@@ -390,7 +396,7 @@ void ANonCharacterBase::MoveInput(const FInputActionValue &Value) {
   }
 
   // [New] 피격 상태(State.HitReacting)이거나 사망 상태면 이동 입력 무시
-  if (AbilitySystemComponent && AbilitySystemComponent->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(TEXT("State.HitReacting"), false))) {
+  if (AbilitySystemComponent && AbilitySystemComponent->HasMatchingGameplayTag(NonGameplayTags::State_HitReacting)) {
       return;
   }
 
@@ -420,6 +426,8 @@ void ANonCharacterBase::SetStrafeMode(bool bEnable) {
 }
 
 void ANonCharacterBase::OnRep_StrafeMode() {
+  MarkLocomotionDirty();
+
   UCharacterMovementComponent *Move = GetCharacterMovement();
   if (!Move)
     return;
@@ -444,48 +452,69 @@ void ANonCharacterBase::Tick(float DeltaSeconds) {
   Super::Tick(DeltaSeconds);
 
 
-  // 1) 공격 시작 정렬(카메라 방향으로 RInterpTo)
-  UpdateAttackAlign(DeltaSeconds);
+  // 1) 공격 시작 정렬(카메라 방향으로 RInterpTo) - 정렬 중일 때만
+  if (bAttackAlignActive)
+    UpdateAttackAlign(DeltaSeconds);
 
-  // [Changed] TIP 로직 삭제/비활성화 -> 항상 스트레이프 업데이트 호출
-  UpdateStrafeYawFollowBySpeed();
+  // [Changed] 회전/속도 갱신은 상태가 바뀌었거나 입력 중일 때만 수행
+  // (리모트 프록시는 입력이 없으므로 상태 변경 프레임에만 한 번)
+  const bool bHasInput = HasLocomotionInput();
+  if (bHasInput != bHadLocomotionInput) {
+    bHadLocomotionInput = bHasInput;
+    bLocomotionDirty = true;
+  }
 
-  UpdateDirectionalSpeed();
-  UpdateGuardDirAndSpeed();
+  if (bLocomotionDirty || bAlignYawAfterRotationLock) {
+    UpdateStrafeYawFollowBySpeed();
+  }
 
-  // [New] 타겟 프레임 업데이트
-  if (IsLocallyControlled()) // [Fix] HasAuthority() 체크 삭제
-                             // (싱글플레이/리슨서버 호스트 위해)
-  {
-    // 타겟이 유효한지(죽지 않았는지) 확인
-    if (CurrentTarget) {
-      // 거리 체크 (너무 멀어지면 해제) - 예: 20m
-      const float Dist = GetDistanceTo(CurrentTarget);
-      if (Dist > 2000.f || CurrentTarget->IsDead()) {
-        SetCombatTarget(nullptr);
-      } else if (UIManagerComponent) {
-        FString EnemyName =
-            CurrentTarget
-                ->GetEnemyName(); // [Fix] ProcessName -> GetEnemyName()
-
-        float CurHP = 0.f;
-        float MaxHP = 100.f;
-
-        // [Fix] GetAttributeSet() 사용
-        if (UNonAttributeSet *EnemyAS = CurrentTarget->GetAttributeSet()) {
-          CurHP = EnemyAS->GetHP();
-          MaxHP = EnemyAS->GetMaxHP();
-        }
+  // 백페달/가드 방향은 입력 방향과 카메라 Yaw 로 정해지므로 입력 중에는 매 프레임
+  if (bLocomotionDirty || bHasInput) {
+    UpdateDirectionalSpeed();
+    UpdateGuardDirAndSpeed();
+  }
 
-        UIManagerComponent->UpdateTargetHUD(CurrentTarget, EnemyName, CurHP, MaxHP,
-                                       Dist);
-      }
-    } else {
-      // 타겟 없음 -> 숨김
-      if (UIManagerComponent) {
-        UIManagerComponent->UpdateTargetHUD(nullptr, TEXT(""), 0, 0, 0);
-      }
-    }
+  bLocomotionDirty = false;
+}
+
+bool ANonCharacterBase::HasLocomotionInput() const {
+  if (GetLastMovementInputVector().SizeSquared() > KINDA_SMALL_NUMBER)
+    return true;
+
+  // [Fix] 서버에서는 InputVector가 0일 수 있으므로(타이밍 이슈), 속도가
+  // 있으면 입력 중으로 간주
+  return HasAuthority() && GetVelocity().SizeSquared2D() > 10.f;
+}
+
+void ANonCharacterBase::BindLocomotionStateEvents() {
+  if (bLocomotionEventsBound || !AbilitySystemComponent)
+    return;
+
+  bLocomotionEventsBound = true;
+
+  // 하위 태그 변화도 부모 태그 카운트 이벤트로 들어옴
+  for (const FGameplayTag &Tag : NonGameplayTags::GetRotationLockTags()) {
+    AbilitySystemComponent
+        ->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved)
+        .AddUObject(this, &ANonCharacterBase::OnRotationLockTagChanged);
+  }
+
+  bRotationLockTagActive = AbilitySystemComponent->HasAnyMatchingGameplayTags(
+      NonGameplayTags::GetRotationLockTags());
+  MarkLocomotionDirty();
+}
+
+void ANonCharacterBase::OnRotationLockTagChanged(const FGameplayTag Tag,
+                                                 int32 NewCount) {
+  // 여러 태그가 겹칠 수 있으므로 카운트 대신 컨테이너 전체로 다시 판정
+  const bool bLocked =
+      AbilitySystemComponent &&
+      AbilitySystemComponent->HasAnyMatchingGameplayTags(
+          NonGameplayTags::GetRotationLockTags());
+
+  if (bLocked != bRotationLockTagActive) {
+    bRotationLockTagActive = bLocked;
+    MarkLocomotionDirty();
   }
 }
 
@@ -507,10 +536,86 @@ void ANonCharacterBase::SetCombatTarget(AEnemyCharacter *NewTarget) {
 
   // 타겟 변경 즉시 UI 갱신 시도
   if (IsLocallyControlled()) {
-    if (!CurrentTarget && UIManagerComponent) {
+    BindTargetHUDEvents();
+    RefreshTargetHUD();
+  }
+}
+
+void ANonCharacterBase::BindTargetHUDEvents() {
+  UnbindTargetHUDEvents();
+
+  if (!CurrentTarget)
+    return;
+
+  if (UAbilitySystemComponent *TargetASC = CurrentTarget->GetAbilitySystemComponent()) {
+    BoundTargetASC = TargetASC;
+    TargetHPChangedHandle =
+        TargetASC->GetGameplayAttributeValueChangeDelegate(UNonAttributeSet::GetHPAttribute())
+            .AddWeakLambda(this, [this](const FOnAttributeChangeData &) {
+              RefreshTargetHUD();
+            });
+    TargetMaxHPChangedHandle =
+        TargetASC->GetGameplayAttributeValueChangeDelegate(UNonAttributeSet::GetMaxHPAttribute())
+            .AddWeakLambda(this, [this](const FOnAttributeChangeData &) {
+              RefreshTargetHUD();
+            });
+  }
+
+  // 거리 표시/이탈 체크는 HP 이벤트가 없으므로 짧은 주기로
+  GetWorldTimerManager().SetTimer(TargetRangeTimerHandle, this,
+                                  &ANonCharacterBase::RefreshTargetHUD,
+                                  TargetRangeCheckInterval, true);
+}
+
+void ANonCharacterBase::UnbindTargetHUDEvents() {
+  GetWorldTimerManager().ClearTimer(TargetRangeTimerHandle);
+
+  if (UAbilitySystemComponent *OldASC = BoundTargetASC.Get()) {
+    OldASC->GetGameplayAttributeValueChangeDelegate(UNonAttributeSet::GetHPAttribute())
+        .Remove(TargetHPChangedHandle);
+    OldASC->GetGameplayAttributeValueChangeDelegate(UNonAttributeSet::GetMaxHPAttribute())
+        .Remove(TargetMaxHPChangedHandle);
+  }
+
+  BoundTargetASC.Reset();
+  TargetHPChangedHandle.Reset();
+  TargetMaxHPChangedHandle.Reset();
+}
+
+void ANonCharacterBase::RefreshTargetHUD() {
+  if (!IsLocallyControlled())
+    return;
+
+  if (!CurrentTarget) {
+    // 타겟 없음 -> 숨김
+    UnbindTargetHUDEvents();
+    if (UIManagerComponent) {
       UIManagerComponent->UpdateTargetHUD(nullptr, TEXT(""), 0, 0, 0);
     }
+    return;
+  }
+
+  // 거리 체크 (너무 멀어지면 해제) / 죽은 타겟 해제
+  const float Dist = GetDistanceTo(CurrentTarget);
+  if (Dist > TargetMaxDistance || CurrentTarget->IsDead()) {
+    SetCombatTarget(nullptr);
+    return;
   }
+
+  if (!UIManagerComponent)
+    return;
+
+  float CurHP = 0.f;
+  float MaxHP = 100.f;
+
+  // [Fix] GetAttributeSet() 사용
+  if (UNonAttributeSet *EnemyAS = CurrentTarget->GetAttributeSet()) {
+    CurHP = EnemyAS->GetHP();
+    MaxHP = EnemyAS->GetMaxHP();
+  }
+
+  UIManagerComponent->UpdateTargetHUD(CurrentTarget, CurrentTarget->GetEnemyName(),
+                                      CurHP, MaxHP, Dist);
 }
 
 void ANonCharacterBase::UpdateDirectionalSpeed() {
@@ -593,6 +698,7 @@ void ANonCharacterBase::UpdateDirectionalSpeed() {
 void ANonCharacterBase::ServerSetBackpedaling_Implementation(
     bool bNewBackpedaling) {
   bIsBackpedaling = bNewBackpedaling;
+  MarkLocomotionDirty();
 
   // 서버에서도 속도 적용 (Physics Authority)
   if (UCharacterMovementComponent *Move = GetCharacterMovement()) {
@@ -609,6 +715,8 @@ void ANonCharacterBase::ServerSetBackpedaling_Implementation(
 }
 
 void ANonCharacterBase::OnRep_IsBackpedaling() {
+  MarkLocomotionDirty();
+
   // 리모트 클라이언트(다른 플레이어)가 보는 나의 속도 적용
   if (UCharacterMovementComponent *Move = GetCharacterMovement()) {
     if (bIsBackpedaling) {
@@ -626,57 +734,8 @@ void ANonCharacterBase::UpdateStrafeYawFollowBySpeed() {
     return;
 
   // 1. 태그 확인 (스킬, 공격, 회피 등)
-  bool bHasLockTag = false;
-  if (AbilitySystemComponent) {
-    const FGameplayTag DodgeTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Dodge"), false);
-    const FGameplayTag AttackTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Attack"), false);
-    const FGameplayTag AttackingTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Attacking"), false);
-    const FGameplayTag ComboTag =
-        FGameplayTag::RequestGameplayTag(TEXT("Ability.Combo"), false);
-    const FGameplayTag Combo1Tag =
-        FGameplayTag::RequestGameplayTag(TEXT("Ability.Combo1"), false);
-    const FGameplayTag Combo2Tag =
-        FGameplayTag::RequestGameplayTag(TEXT("Ability.Combo2"), false);
-    const FGameplayTag Combo3Tag =
-        FGameplayTag::RequestGameplayTag(TEXT("Ability.Combo3"), false);
-    const FGameplayTag SkillTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Skill"), false);
-    const FGameplayTag HitReactTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.HitReacting"), false);
-    const FGameplayTag StunTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Stunned"), false);
-    const FGameplayTag DeadTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Dead"), false);
-    const FGameplayTag ToggleWeaponRootTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.ToggleWeapon.Root"), false);
-
-    const bool bDodge =
-        AbilitySystemComponent->HasMatchingGameplayTag(DodgeTag);
-    const bool bAttack =
-        AbilitySystemComponent->HasMatchingGameplayTag(AttackTag) ||
-        AbilitySystemComponent->HasMatchingGameplayTag(AttackingTag);
-    const bool bCombo =
-        AbilitySystemComponent->HasMatchingGameplayTag(ComboTag) ||
-        AbilitySystemComponent->HasMatchingGameplayTag(Combo1Tag) ||
-        AbilitySystemComponent->HasMatchingGameplayTag(Combo2Tag) ||
-        AbilitySystemComponent->HasMatchingGameplayTag(Combo3Tag);
-    const bool bSkill =
-        AbilitySystemComponent->HasMatchingGameplayTag(SkillTag);
-    
-    // [Fix] 피격, 스턴, 사망 시에도 회전 잠금 처리
-    const bool bStunned = 
-        AbilitySystemComponent->HasMatchingGameplayTag(HitReactTag) ||
-        AbilitySystemComponent->HasMatchingGameplayTag(StunTag) ||
-        AbilitySystemComponent->HasMatchingGameplayTag(DeadTag);
-
-    const bool bToggleWeapon =
-        AbilitySystemComponent->HasMatchingGameplayTag(ToggleWeaponRootTag);
-
-    bHasLockTag = (bDodge || bAttack || bCombo || bSkill || bStunned || bToggleWeapon);
-  }
+  // [Fix] 피격, 스턴, 사망, 무기 전환 포함. 태그 카운트 이벤트로 캐시된 값 사용
+  const bool bHasLockTag = bRotationLockTagActive;
 
 
   // 2. [1순위] 어빌리티 사용 중(공격/회피/피격 등): 가드 상태보다 우선하여 무조건 회전 잠금
@@ -948,15 +1007,13 @@ void ANonCharacterBase::TryActivateCombo() {
   }
 
   // 이미 콤보 어빌리티(Ability.Combo)가 돌고 있으면 새로 시작하지 않음
-  const FGameplayTag ActiveComboTag =
-      FGameplayTag::RequestGameplayTag(FName("Ability.Combo"), false);
+  const FGameplayTag ActiveComboTag = NonGameplayTags::Ability_Combo;
   if (AbilitySystemComponent->HasMatchingGameplayTag(ActiveComboTag)) {
     return;
   }
 
   // Ability.Combo1 태그를 가진 GA를 찾아서 실행
-  const FGameplayTag Combo1Tag =
-      FGameplayTag::RequestGameplayTag(FName("Ability.Combo1"), false);
+  const FGameplayTag Combo1Tag = NonGameplayTags::Ability_Combo1;
 
   FGameplayTagContainer TagContainer;
   TagContainer.AddTag(Combo1Tag);
@@ -999,11 +1056,11 @@ void ANonCharacterBase::LevelUp() {
       AbilitySystemComponent->MakeOutgoingSpec(GE_LevelUp, 1.f, Context);
   if (Spec.IsValid()) {
     Spec.Data->SetSetByCallerMagnitude(
-        FGameplayTag::RequestGameplayTag(FName("Data.MaxHP"), false), NewData->MaxHP);
+        NonGameplayTags::Data_MaxHP, NewData->MaxHP);
     Spec.Data->SetSetByCallerMagnitude(
-        FGameplayTag::RequestGameplayTag(FName("Data.MaxMP"), false), NewData->MaxMP);
+        NonGameplayTags::Data_MaxMP, NewData->MaxMP);
     Spec.Data->SetSetByCallerMagnitude(
-        FGameplayTag::RequestGameplayTag(FName("Data.ExpToNextLevel"), false),
+        NonGameplayTags::Data_ExpToNextLevel,
         NewData->ExpToNextLevel);
 
     AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
@@ -1027,9 +1084,10 @@ void ANonCharacterBase::LevelUp() {
     // (생략: DataAccess를 통해 포인트 지급 로직 추가 가능)
 
     // [New] 레벨업 직후 자동 저장 (로비 싱크용)
+    // 전투 중 히치 방지를 위해 비동기 저장 사용
     if (USaveGameSubsystem *SaveSys =
             GetGameInstance()->GetSubsystem<USaveGameSubsystem>()) {
-      SaveSys->SaveGame();
+      SaveSys->SaveGameAsync();
     }
     float CurrentStat = AttributeSet->GetStatPoint();
     float CurrentSkill = AttributeSet->GetSkillPoint();
@@ -1217,7 +1275,7 @@ void ANonCharacterBase::RefreshWeaponStance() {
 
   if (Main) {
     // 메인 무기가 있을 때만 스탠스 변경
-    const bool bIsStaff = (Main->CachedRow.WeaponType == EWeaponType::Staff);
+    const bool bIsStaff = (Main->GetRow().WeaponType == EWeaponType::Staff);
     const bool bIsTwoHand = Main->IsTwoHandedWeapon() || bIsStaff;
 
     if (bIsStaff)
@@ -1254,8 +1312,7 @@ void ANonCharacterBase::GuardPressed() {
     return;
 
   if (CurrentComboAbility.IsValid()) {
-    const FGameplayTag Tag_Combo3 =
-        FGameplayTag::RequestGameplayTag(FName("Ability.Combo3"), false);
+    const FGameplayTag Tag_Combo3 = NonGameplayTags::Ability_Combo3;
     if (CurrentComboAbility->GetAssetTags().HasTagExact(Tag_Combo3)) {
       return;
     }
@@ -1272,8 +1329,7 @@ void ANonCharacterBase::Jump() {
   Super::Jump();
 
   if (AbilitySystemComponent) {
-    static const FGameplayTag JumpTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Jump"), false);
+    static const FGameplayTag JumpTag = NonGameplayTags::State_Jump;
 
     AbilitySystemComponent->AddLooseGameplayTag(JumpTag);
   }
@@ -1283,8 +1339,7 @@ void ANonCharacterBase::Landed(const FHitResult &Hit) {
   Super::Landed(Hit);
 
   if (AbilitySystemComponent) {
-    static const FGameplayTag JumpTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Jump"), false);
+    static const FGameplayTag JumpTag = NonGameplayTags::State_Jump;
 
     AbilitySystemComponent->RemoveLooseGameplayTag(JumpTag);
   }
@@ -1306,6 +1361,7 @@ void ANonCharacterBase::StartGuard() {
 
   // 2. 로컬(서버 or 클라) 상태 적용
   bGuarding = true;
+  MarkLocomotionDirty();
 
   // 로직 수행 (속도 감소, 애니메이션 정지 등)
   if (USkeletalMeshComponent *SkelComp = GetMesh()) {
@@ -1329,6 +1385,7 @@ void ANonCharacterBase::StopGuard() {
   }
 
   bGuarding = false;
+  MarkLocomotionDirty();
 
   // 속도 복원
   if (UCharacterMovementComponent *Move = GetCharacterMovement()) {
@@ -1349,6 +1406,8 @@ void ANonCharacterBase::ServerSetGuarding_Implementation(bool bEnable) {
 }
 
 void ANonCharacterBase::OnRep_IsGuarding() {
+  MarkLocomotionDirty();
+
   // 리모트 클라이언트에서 변수 변경 감지 시 로직 수행
   if (bGuarding) {
     // StartGuard 로직 일부 수동 호출 (애니메이션, 속도 등)
@@ -1432,19 +1491,18 @@ void ANonCharacterBase::ApplyDamageAt(float Amount, AActor *DamageInstigator,
 
   // ── 0) I-Frame 또는 무적(Invincible) 우선 ─────────────────────────────────────────
   if (AbilitySystemComponent) {
-    static const FGameplayTag Tag_IFrame = FGameplayTag::RequestGameplayTag(TEXT("State.IFrame"), false);
-    static const FGameplayTag Tag_Invincible = FGameplayTag::RequestGameplayTag(TEXT("State.Invincible"), false);
+    static const FGameplayTag Tag_IFrame = NonGameplayTags::State_IFrame;
+    static const FGameplayTag Tag_Invincible = NonGameplayTags::State_Invincible;
     
     const bool bIFrame = AbilitySystemComponent->HasMatchingGameplayTag(Tag_IFrame);
     const bool bInvincible = AbilitySystemComponent->HasMatchingGameplayTag(Tag_Invincible);
 
     if (bIFrame || bInvincible) {
       if (HasAuthority()) {
-        if (bInvincible) {
-            Multicast_SpawnImmuneText(WorldLocation);
-        } else {
-            Multicast_SpawnDodgeText(WorldLocation);
-        }
+        UCombatEventSubsystem::Post(
+            this,
+            bInvincible ? ECombatEventType::Immune : ECombatEventType::Dodge,
+            this, WorldLocation);
       }
       return; // 데미지 처리 중단!
     }
@@ -1471,8 +1529,7 @@ void ANonCharacterBase::ApplyDamageAt(float Amount, AActor *DamageInstigator,
     FGameplayEffectSpecHandle Spec =
         AbilitySystemComponent->MakeOutgoingSpec(GE_Damage, 1.f, Ctx);
     if (Spec.IsValid()) {
-      static const FGameplayTag Tag_DataDamage =
-          FGameplayTag::RequestGameplayTag(TEXT("Data.Damage"), false);
+      static const FGameplayTag Tag_DataDamage = NonGameplayTags::Data_Damage;
       Spec.Data->SetSetByCallerMagnitude(Tag_DataDamage, -Amount);
       AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
     }
@@ -1552,7 +1609,7 @@ void ANonCharacterBase::EquipStartingItemsForJob(EJobClass Job) {
     if (ItemClass) {
       UInventoryItem *NewItem = NewObject<UInventoryItem>(this, ItemClass);
       if (NewItem) {
-        // [Critical Fix] 서버에서도 Init을 호출하여 CachedRow를 DT에서 확실하게
+        // [Critical Fix] 서버에서도 Init을 호출하여 Definition 핸들을 DT에서 확실하게
         // 로드해야 함 (BP 기본값(CDO)이 유효하지 않거나 오래되었을 경우 대비)
         if (DT) {
           NewItem->Init(NewItem->ItemId, 1, DT);
@@ -1605,83 +1662,37 @@ void ANonCharacterBase::Multicast_SpawnDamageNumber_Implementation(
     }
   }
 
-  TSubclassOf<ADamageNumberActor> SpawnClass = DamageNumberClass;
-  if (!SpawnClass)
-    SpawnClass = ADamageNumberActor::StaticClass();
-
-  FActorSpawnParameters SP;
-  SP.SpawnCollisionHandlingOverride =
-      ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-  SP.Owner = this;
-
-  if (ADamageNumberActor *A = GetWorld()->SpawnActor<ADamageNumberActor>(
-          SpawnClass, WorldLocation, FRotator::ZeroRotator, SP)) {
-    A->InitWithFlags(Amount, bIsCritical);
-  }
+  UDamageNumberSubsystem::ShowNumber(
+      this, DamageNumberClass, WorldLocation, Amount,
+      bIsCritical ? ENonDamageNumberCategory::Critical
+                  : ENonDamageNumberCategory::Normal);
 }
 
 void ANonCharacterBase::Multicast_SpawnPlayerDamageNumber_Implementation(float Amount, FVector WorldLocation)
 {
   if (Amount <= 0.f || !GetWorld()) return;
 
-  TSubclassOf<ADamageNumberActor> SpawnClass = DamageNumberClass;
-  if (!SpawnClass) SpawnClass = ADamageNumberActor::StaticClass();
-
-  FActorSpawnParameters SP;
-  SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-  SP.Owner = this;
-
-  if (ADamageNumberActor* A = GetWorld()->SpawnActor<ADamageNumberActor>(SpawnClass, WorldLocation, FRotator::ZeroRotator, SP))
-  {
-    A->Init(Amount, ENonDamageNumberCategory::PlayerDamage);
-    A->SetOwner(this);
-  }
+  UDamageNumberSubsystem::ShowNumber(this, DamageNumberClass, WorldLocation, Amount, ENonDamageNumberCategory::PlayerDamage);
 }
 
 void ANonCharacterBase::Multicast_SpawnDodgeText_Implementation(
     FVector WorldLocation) {
-  if (!DamageNumberClass)
-    return;
-  UWorld *W = GetWorld();
-  if (!W)
+  if (!DamageNumberClass || !GetWorld())
     return;
 
-  const FActorSpawnParameters P = [] {
-    FActorSpawnParameters S;
-    S.SpawnCollisionHandlingOverride =
-        ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-    return S;
-  }();
-
-  ADamageNumberActor *A = W->SpawnActor<ADamageNumberActor>(
-      DamageNumberClass, WorldLocation, FRotator::ZeroRotator, P);
-  if (A) {
-    A->SetupAsDodge();
-    A->SetOwner(this);
-  }
+  UDamageNumberSubsystem::ShowLabel(this, DamageNumberClass, WorldLocation,
+                                    FText::FromString(TEXT("Dodge")),
+                                    ENonDamageNumberCategory::Dodge);
 }
 
 void ANonCharacterBase::Multicast_SpawnImmuneText_Implementation(
     FVector WorldLocation) {
-  if (!DamageNumberClass)
+  if (!DamageNumberClass || !GetWorld())
     return;
-  UWorld *W = GetWorld();
-  if (!W)
-    return;
-
-  const FActorSpawnParameters P = [] {
-    FActorSpawnParameters S;
-    S.SpawnCollisionHandlingOverride =
-        ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-    return S;
-  }();
 
-  ADamageNumberActor *A = W->SpawnActor<ADamageNumberActor>(
-      DamageNumberClass, WorldLocation, FRotator::ZeroRotator, P);
-  if (A) {
-    A->InitAsLabel(FText::FromString(TEXT("IMMUNE")), ENonDamageNumberCategory::Special, 30);
-    A->SetOwner(this);
-  }
+  UDamageNumberSubsystem::ShowLabel(this, DamageNumberClass, WorldLocation,
+                                    FText::FromString(TEXT("IMMUNE")),
+                                    ENonDamageNumberCategory::Special, 30);
 }
 
 void ANonCharacterBase::OnGotHit(float Damage, AActor *InstigatorActor,
@@ -1806,7 +1817,7 @@ void ANonCharacterBase::Revive(bool bInPlace)
         AbilitySystemComponent->SetNumericAttributeBase(AttributeSet->GetHPAttribute(), AttributeSet->GetMaxHP());
         AbilitySystemComponent->SetNumericAttributeBase(AttributeSet->GetMPAttribute(), AttributeSet->GetMaxMP());
         // Dead 태그 강제 제거 (느슨한 태그일 경우 대비)
-        AbilitySystemComponent->RemoveLooseGameplayTag(FGameplayTag::RequestGameplayTag("State.Dead", false));
+        AbilitySystemComponent->RemoveLooseGameplayTag(NonGameplayTags::State_Dead);
     }
 
     // 포즈 정지 해제 및 잔여 사망 몽타주 강제 종료 (점프 애니 멈춤 현상 해결)
@@ -1821,6 +1832,9 @@ void ANonCharacterBase::Revive(bool bInPlace)
     // 콜리전 완벽 복구 (기본 폰 프로필로 되돌려서 쓸데없는 모든 채널 Block 버그 해결)
     GetCapsuleComponent()->SetCollisionProfileName(FName(TEXT("Pawn")));
 
+    // 회전/속도 설정 다시 계산 (사망 중 틀어진 이동 설정 복구)
+    MarkLocomotionDirty();
+
     // 컨트롤러 입력 복원
     if (AController* C = GetController()) {
         C->SetIgnoreMoveInput(false);
@@ -1835,7 +1849,7 @@ void ANonCharacterBase::Revive(bool bInPlace)
     // [New] 부활 이벤트 발송 (GA_PlayerRevive 등 재생)
     if (AbilitySystemComponent) {
         FGameplayEventData Payload;
-        Payload.EventTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Revive"), false);
+        Payload.EventTag = NonGameplayTags::Effect_Revive;
         Payload.Target = this;
         Payload.Instigator = this;
         // [New] 부활 방식 Magnitude 전달 (1.0f=제자리, 0.0f=근처)
@@ -1844,7 +1858,7 @@ void ANonCharacterBase::Revive(bool bInPlace)
         UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(this, Payload.EventTag, Payload);
 
         // [Fix] 몽타주 재생 중 및 종료 후 무적을 위해 State.Invincible 부여 (해제는 GA_Revive에서 몽타주 끝난 뒤 3초 후 수행)
-        FGameplayTag ImmuneTag = FGameplayTag::RequestGameplayTag(TEXT("State.Invincible"), false);
+        FGameplayTag ImmuneTag = NonGameplayTags::State_Invincible;
         AbilitySystemComponent->AddLooseGameplayTag(ImmuneTag);
     }
 
@@ -1874,7 +1888,7 @@ UAnimMontage* ANonCharacterBase::GetHitMontage(FGameplayTag HitTag) const
         }
 
         // 3. 만약 정확한 태그를 못 찾았고 기본을 원한다면 디폴트(Light)로 떨어짐
-        FGameplayTag DefaultTag = FGameplayTag::RequestGameplayTag(TEXT("Effect.Hit.Light"), false);
+        FGameplayTag DefaultTag = NonGameplayTags::Effect_Hit_Light;
         if (UAnimMontage* const* DefaultMontage = StanceMap->Montages.Find(DefaultTag))
         {
             return *DefaultMontage;
@@ -1888,7 +1902,7 @@ ANonCharacterBase::ComputeStanceFromItem(const UInventoryItem *Item) const {
   if (!Item)
     return EWeaponStance::Unarmed;
 
-  const bool bIsStaff = (Item->CachedRow.WeaponType == EWeaponType::Staff);
+  const bool bIsStaff = (Item->GetRow().WeaponType == EWeaponType::Staff);
   const bool bTwoHand = Item->IsTwoHandedWeapon() || bIsStaff;
 
   if (bIsStaff)
@@ -1986,8 +2000,7 @@ void ANonCharacterBase::TryDodge() {
   ServerActivateDodge(DirIndex, CurrentYaw);
 
   // 3. 로컬 발동 (Prediction)
-  static const FGameplayTag DodgeAbilityTag =
-      FGameplayTag::RequestGameplayTag(TEXT("Ability.Dodge"), false);
+  static const FGameplayTag DodgeAbilityTag = NonGameplayTags::Ability_Dodge;
   FGameplayTagContainer DodgeTagContainer;
   DodgeTagContainer.AddTag(DodgeAbilityTag);
   AbilitySystemComponent->TryActivateAbilitiesByTag(DodgeTagContainer);
@@ -2005,8 +2018,7 @@ void ANonCharacterBase::ServerActivateDodge_Implementation(int32 DirIndex,
   SetActorRotation(NewRot);
 
   // 서버측 발동
-  static const FGameplayTag DodgeAbilityTag =
-      FGameplayTag::RequestGameplayTag(TEXT("Ability.Dodge"), false);
+  static const FGameplayTag DodgeAbilityTag = NonGameplayTags::Ability_Dodge;
   if (AbilitySystemComponent) {
     FGameplayTagContainer DodgeTagContainer;
     DodgeTagContainer.AddTag(DodgeAbilityTag);
@@ -2072,8 +2084,7 @@ void ANonCharacterBase::EnterCombatState() {
   if (!HasAuthority() || !AbilitySystemComponent)
     return;
 
-  const FGameplayTag CombatTag =
-      FGameplayTag::RequestGameplayTag(TEXT("State.Combat"), false);
+  const FGameplayTag CombatTag = NonGameplayTags::State_Combat;
 
   if (!AbilitySystemComponent->HasMatchingGameplayTag(CombatTag)) {
     AbilitySystemComponent->AddLooseGameplayTag(CombatTag);
@@ -2089,8 +2100,7 @@ void ANonCharacterBase::LeaveCombatState() {
   if (!HasAuthority() || !AbilitySystemComponent)
     return;
 
-  const FGameplayTag CombatTag =
-      FGameplayTag::RequestGameplayTag(TEXT("State.Combat"), false);
+  const FGameplayTag CombatTag = NonGameplayTags::State_Combat;
   AbilitySystemComponent->RemoveLooseGameplayTag(CombatTag);
 
   GetWorldTimerManager().ClearTimer(CombatStateTimerHandle);
@@ -2100,7 +2110,7 @@ bool ANonCharacterBase::IsInCombat() const {
   if (!AbilitySystemComponent)
     return false;
   return AbilitySystemComponent->HasMatchingGameplayTag(
-      FGameplayTag::RequestGameplayTag(TEXT("State.Combat"), false));
+      NonGameplayTags::State_Combat);
 }
 
 void ANonCharacterBase::SaveGameTest() {
@@ -0,0 +1,191 @@
+#include "Combat/AOEOverlapSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+
+TStatId UAOEOverlapSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAOEOverlapSubsystem, STATGROUP_Tickables);
+}
+
+void UAOEOverlapSubsystem::RegisterAOE(ADamageAOE* AOE, float Interval)
+{
+    if (!AOE) return;
+
+    UnregisterAOE(AOE);
+
+    FAOEEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.AOE = AOE;
+    Entry.NextHitTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+    Entry.Interval = Interval;
+}
+
+void UAOEOverlapSubsystem::UnregisterAOE(ADamageAOE* AOE)
+{
+    Entries.RemoveAllSwap([AOE](const FAOEEntry& Entry)
+    {
+        return Entry.AOE.Get() == AOE;
+    });
+}
+
+void UAOEOverlapSubsystem::BuildSnapshot(const FBox& QueryBounds)
+{
+    Snapshot.Reset();
+
+    UWorld* World = GetWorld();
+    if (!World || !QueryBounds.IsValid) return;
+
+    static const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+
+    TArray<FOverlapResult> Overlaps;
+    World->OverlapMultiByObjectType(Overlaps, QueryBounds.GetCenter(), FQuat::Identity, ObjectParams,
+        FCollisionShape::MakeBox(QueryBounds.GetExtent()), FCollisionQueryParams(SCENE_QUERY_STAT(AOEOverlapSnapshot), false));
+    ++LastBroadphaseQueries;
+
+    Snapshot.Reserve(Overlaps.Num());
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        UPrimitiveComponent* Comp = Overlap.GetComponent();
+        AActor* Actor = Overlap.GetActor();
+        if (!Comp || !Actor) continue;
+
+        FPawnSnapshot& Entry = Snapshot.AddDefaulted_GetRef();
+        Entry.Actor = Actor;
+        Entry.Component = Comp;
+        Entry.Bounds = Comp->Bounds.GetBox();
+        Entry.Team = ADamageAOE::GetTargetTeam(Actor);
+    }
+    LastSnapshotSize += Snapshot.Num();
+}
+
+void UAOEOverlapSubsystem::ResolveQuery(const FDueQuery& Query)
+{
+    ADamageAOE* AOE = Query.AOE;
+
+    // 앞선 AOE 의 데미지 처리 중 파괴되었을 수 있음
+    if (!IsValid(AOE)) return;
+
+    TArray<AActor*, TInlineAllocator<16>> Targets;
+    const AActor* Owner = AOE->GetOwner();
+
+    for (const FPawnSnapshot& Entry : Snapshot)
+    {
+        if (Entry.Actor == AOE || Entry.Actor == Owner) continue;
+        if (!AOE->CanHitTeam(Entry.Team)) continue;
+        if (!Entry.Bounds.Intersect(Query.Bounds)) continue;
+        if (Targets.Contains(Entry.Actor)) continue;
+        if (!IsValid(Entry.Component)) continue;
+
+        if (Entry.Component->OverlapComponent(Query.Center, FQuat::Identity, Query.Shape))
+        {
+            Targets.Add(Entry.Actor);
+        }
+    }
+
+    for (int32 HitIndex = 0; HitIndex < Query.NumHits; ++HitIndex)
+    {
+        AOE->ApplyOverlapResults(Targets);
+    }
+}
+
+void UAOEOverlapSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    LastQueriedAOEs = 0;
+    LastBroadphaseQueries = 0;
+    LastSnapshotSize = 0;
+    if (Entries.Num() == 0) return;
+
+    UWorld* World = GetWorld();
+    if (!World) return;
+    const double Now = World->GetTimeSeconds();
+
+    // ── 1) 이번 프레임 판정할 AOE 수집 ──
+    TArray<FDueQuery> Due;
+
+    for (int32 i = Entries.Num() - 1; i >= 0; --i)
+    {
+        FAOEEntry& Entry = Entries[i];
+        ADamageAOE* AOE = Entry.AOE.Get();
+        if (!AOE)
+        {
+            Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+            continue;
+        }
+        if (Now < Entry.NextHitTime) continue;
+
+        FDueQuery& Query = Due.AddDefaulted_GetRef();
+        Query.AOE = AOE;
+        AOE->GetOverlapQuery(Query.Center, Query.Shape);
+        Query.Bounds = FBox::BuildAABB(Query.Center, Query.Shape.GetExtent());
+
+        if (Entry.Interval <= 0.f)
+        {
+            // 단발 AOE: 한 번 판정 후 해제
+            Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+            continue;
+        }
+
+        // 타이머처럼 밀린 횟수만큼 적용
+        Query.NumHits = 0;
+        while (Entry.NextHitTime <= Now)
+        {
+            Entry.NextHitTime += Entry.Interval;
+            ++Query.NumHits;
+        }
+    }
+
+    if (Due.Num() == 0) return;
+
+    LastQueriedAOEs = Due.Num();
+
+    // ── 2) 묶기: 중심이 같은 거친 격자 칸에 있는 AOE 끼리 ──
+    //    전체 합집합 하나로 쿼리하면 멀리 떨어진 AOE 두 개만 있어도 그 사이 폰을 전부 훑게 됨
+    TMap<FIntVector, int32> ClusterByCell;
+    TArray<FQueryCluster> Clusters;
+    const double InvCellSize = 1.0 / FMath::Max(ClusterCellSize, 1.f);
+
+    for (int32 QueryIndex = 0; QueryIndex < Due.Num(); ++QueryIndex)
+    {
+        const FDueQuery& Query = Due[QueryIndex];
+        const FIntVector Cell(
+            FMath::FloorToInt(Query.Center.X * InvCellSize),
+            FMath::FloorToInt(Query.Center.Y * InvCellSize),
+            FMath::FloorToInt(Query.Center.Z * InvCellSize));
+
+        int32& ClusterIndex = ClusterByCell.FindOrAdd(Cell, INDEX_NONE);
+        if (ClusterIndex == INDEX_NONE)
+        {
+            ClusterIndex = Clusters.AddDefaulted();
+        }
+
+        FQueryCluster& Cluster = Clusters[ClusterIndex];
+        Cluster.Bounds += Query.Bounds;
+        Cluster.SumVolume += Query.Bounds.GetVolume();
+        Cluster.Members.Add(QueryIndex);
+    }
+
+    // ── 3) 묶음별 브로드페이즈 (Pawn 채널 쿼리 하나) → AOE 별 정밀 판정 (스냅샷 컴포넌트만) ──
+    for (const FQueryCluster& Cluster : Clusters)
+    {
+        // 칸 안에서도 흩어져 있어 합집합이 대부분 빈 공간이면 AOE 별 쿼리가 더 쌈
+        if (Cluster.Members.Num() > 1 && Cluster.Bounds.GetVolume() > Cluster.SumVolume * MaxUnionVolumeRatio)
+        {
+            for (const int32 QueryIndex : Cluster.Members)
+            {
+                BuildSnapshot(Due[QueryIndex].Bounds);
+                ResolveQuery(Due[QueryIndex]);
+            }
+            continue;
+        }
+
+        BuildSnapshot(Cluster.Bounds);
+        for (const int32 QueryIndex : Cluster.Members)
+        {
+            ResolveQuery(Due[QueryIndex]);
+        }
+    }
+
+    Snapshot.Reset();
+}
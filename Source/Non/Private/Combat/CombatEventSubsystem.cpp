@@ -0,0 +1,251 @@
+#include "Combat/CombatEventSubsystem.h"
+#include "Core/NonPlayerController.h"
+#include "Character/NonCharacterBase.h"
+#include "Character/EnemyCharacter.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/CoreNet.h"
+#include "Engine/World.h"
+
+bool FCombatEventBundle::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    if (!Map)
+    {
+        bOutSuccess = false;
+        return false;
+    }
+
+    uint32 Num = Events.Num();
+    Ar.SerializeIntPacked(Num);
+
+    if (Num > MaxEvents)
+    {
+        Ar.SetError();
+        bOutSuccess = false;
+        return false;
+    }
+
+    if (Ar.IsLoading())
+    {
+        Events.SetNum(Num);
+    }
+
+    bOutSuccess = true;
+    for (FCombatEvent& Event : Events)
+    {
+        uint8 TypeBits = static_cast<uint8>(Event.Type);
+        Ar.SerializeBits(&TypeBits, 3);
+        if (Ar.IsLoading())
+        {
+            if (TypeBits >= static_cast<uint8>(ECombatEventType::Num))
+            {
+                Ar.SetError();
+                bOutSuccess = false;
+                return false;
+            }
+            Event.Type = static_cast<ECombatEventType>(TypeBits);
+        }
+
+        UObject* TargetObj = Event.Target.Get();
+        bOutSuccess &= Map->SerializeObject(Ar, AActor::StaticClass(), TargetObj);
+        Event.Target = Cast<AActor>(TargetObj);
+
+        if (Event.HasLocation())
+        {
+            FVector_NetQuantize Location(Event.Location);
+            bool bLocSuccess = true;
+            Location.NetSerialize(Ar, Map, bLocSuccess);
+            bOutSuccess &= bLocSuccess;
+            Event.Location = Location;
+        }
+
+        if (Event.HasAmount())
+        {
+            // 표시 값은 정수로 반올림되므로 정수로 보냄
+            uint32 Amount = static_cast<uint32>(FMath::Max(0, FMath::RoundToInt(Event.Amount)));
+            Ar.SerializeIntPacked(Amount);
+            Event.Amount = static_cast<float>(Amount);
+        }
+    }
+
+    return true;
+}
+
+TStatId UCombatEventSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatEventSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatEventSubsystem::Post(const UObject* WorldContextObject, ECombatEventType Type, AActor* Target,
+    const FVector& Location, float Amount, APlayerController* Recipient)
+{
+    if (!Target) return;
+
+    UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    if (!World) return;
+
+    FCombatEvent Event;
+    Event.Type = Type;
+    Event.Target = Target;
+    Event.Location = Location;
+    Event.Amount = Amount;
+
+    UCombatEventSubsystem* Channel = World->GetSubsystem<UCombatEventSubsystem>();
+    if (!Channel || World->GetNetMode() == NM_Client)
+    {
+        // 받는 쪽이 지정됐다면 그 컨트롤러가 로컬일 때만
+        if (!Recipient || Recipient->IsLocalController())
+        {
+            DispatchLocal(Event, Recipient ? Recipient : World->GetFirstPlayerController());
+        }
+        return;
+    }
+
+    // HP바 알림은 같은 프레임 같은 대상/수신자면 한 번만
+    if (Type == ECombatEventType::HitConfirm)
+    {
+        for (const FPendingEvent& Existing : Channel->Pending)
+        {
+            if (Existing.Event.Type == Type && Existing.Event.Target == Event.Target && Existing.Recipient == Recipient)
+            {
+                return;
+            }
+        }
+    }
+
+    FPendingEvent& Entry = Channel->Pending.AddDefaulted_GetRef();
+    Entry.Event = MoveTemp(Event);
+    Entry.Recipient = Recipient;
+}
+
+void UCombatEventSubsystem::BuildBundles(TConstArrayView<FCombatEvent> Events, TArray<FCombatEventBundle>& OutBundles)
+{
+    OutBundles.Reset();
+
+    // 1회차: 적중 확인(HitConfirm), 2회차: 나머지
+    for (int32 Pass = 0; Pass < 2; ++Pass)
+    {
+        for (const FCombatEvent& Event : Events)
+        {
+            const bool bHitConfirm = Event.Type == ECombatEventType::HitConfirm;
+            if (bHitConfirm != (Pass == 0)) continue;
+
+            if (OutBundles.Num() == 0 || OutBundles.Last().Events.Num() >= FCombatEventBundle::MaxEvents)
+            {
+                OutBundles.AddDefaulted_GetRef().Events.Reserve(FMath::Min(Events.Num(), FCombatEventBundle::MaxEvents));
+            }
+            OutBundles.Last().Events.Add(Event);
+        }
+    }
+}
+
+void UCombatEventSubsystem::DispatchLocal(const FCombatEvent& Event, APlayerController* LocalController)
+{
+    AActor* Target = Event.Target.Get();
+    if (!Target) return;
+
+    ANonCharacterBase* Char = Cast<ANonCharacterBase>(Target);
+    AEnemyCharacter* Enemy = Char ? nullptr : Cast<AEnemyCharacter>(Target);
+
+    switch (Event.Type)
+    {
+    case ECombatEventType::Damage:
+    case ECombatEventType::CriticalDamage:
+    {
+        const bool bIsCritical = (Event.Type == ECombatEventType::CriticalDamage);
+        if (Char)
+        {
+            Char->Multicast_SpawnDamageNumber_Implementation(Event.Amount, Event.Location, bIsCritical);
+        }
+        else if (Enemy)
+        {
+            Enemy->Multicast_SpawnDamageNumber_Implementation(Event.Amount, Event.Location, bIsCritical);
+        }
+        break;
+    }
+    case ECombatEventType::PlayerDamage:
+        if (Char) Char->Multicast_SpawnPlayerDamageNumber_Implementation(Event.Amount, Event.Location);
+        break;
+
+    case ECombatEventType::Dodge:
+        if (Char) Char->Multicast_SpawnDodgeText_Implementation(Event.Location);
+        break;
+
+    case ECombatEventType::Immune:
+        if (Char) Char->Multicast_SpawnImmuneText_Implementation(Event.Location);
+        break;
+
+    case ECombatEventType::HitConfirm:
+        if (Enemy && LocalController)
+        {
+            if (ANonCharacterBase* Player = Cast<ANonCharacterBase>(LocalController->GetPawn()))
+            {
+                Player->ClientOnAttackHitEnemy_Implementation(Enemy);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+void UCombatEventSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    LastBundlesSent = 0;
+    LastEventsSent = 0;
+    if (Pending.Num() == 0) return;
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        Pending.Reset();
+        return;
+    }
+
+    const float CullDistSq = FMath::Square(CullDistance);
+
+    TArray<FCombatEvent> Selected;
+    TArray<FCombatEventBundle> Bundles;
+    Selected.Reserve(Pending.Num());
+
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        ANonPlayerController* PC = Cast<ANonPlayerController>(It->Get());
+        if (!PC) continue;
+
+        const APawn* OwnPawn = PC->GetPawn();
+        const AActor* ViewActor = OwnPawn ? static_cast<const AActor*>(OwnPawn) : PC->GetViewTarget();
+        const FVector ViewLoc = ViewActor ? ViewActor->GetActorLocation() : FVector::ZeroVector;
+
+        Selected.Reset();
+        for (const FPendingEvent& Entry : Pending)
+        {
+            const AActor* Target = Entry.Event.Target.Get();
+            if (!Target) continue;
+
+            if (Entry.Recipient.IsValid() || Entry.Event.Type == ECombatEventType::HitConfirm)
+            {
+                if (Entry.Recipient.Get() != PC) continue;
+            }
+            else if (Target != OwnPawn && (!ViewActor || FVector::DistSquared(ViewLoc, Entry.Event.Location) > CullDistSq))
+            {
+                continue;
+            }
+
+            Selected.Add(Entry.Event);
+        }
+
+        // 묶음이 가득 차면 나머지는 다음 묶음으로 (대규모 광역기에서도 이벤트 유실 없음)
+        BuildBundles(Selected, Bundles);
+        for (const FCombatEventBundle& Bundle : Bundles)
+        {
+            PC->ClientReceiveCombatEvents(Bundle);
+            ++LastBundlesSent;
+            LastEventsSent += Bundle.Events.Num();
+        }
+    }
+
+    Pending.Reset();
+}
@@ -0,0 +1,155 @@
+#include "Combat/CombatResolverSubsystem.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "Ability/NonGameplayTags.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/DamageType.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "Character/EnemyCharacter.h"
+#include "Character/NonCharacterBase.h"
+
+TStatId UCombatResolverSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatResolverSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatResolverSubsystem::Submit(const UObject* WorldContextObject, FCombatHitRequest&& Request)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    if (UCombatResolverSubsystem* Resolver = World ? World->GetSubsystem<UCombatResolverSubsystem>() : nullptr)
+    {
+        Resolver->QueueHit(MoveTemp(Request));
+        return;
+    }
+
+    FResolveContext Context;
+    ResolveHit(Request, Context);
+}
+
+void UCombatResolverSubsystem::QueueHit(FCombatHitRequest&& Request)
+{
+    if (!Request.Target.IsValid()) return;
+    Pending.Add(MoveTemp(Request));
+}
+
+void UCombatResolverSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (Pending.Num() == 0) return;
+
+    // 처리 중 새로 들어오는 요청(사망 → 폭발 AOE 등)은 다음 프레임으로
+    Swap(Pending, Resolving);
+
+    FResolveContext Context;
+    ResolveBatch(Resolving, Context);
+
+    LastResolvedHits = Resolving.Num();
+    LastSnapshotCount = Context.Attackers.Num() + Context.Defenders.Num();
+    Resolving.Reset();
+}
+
+void UCombatResolverSubsystem::ResolveBatch(TArrayView<FCombatHitRequest> Batch, FResolveContext& Context)
+{
+    for (const FCombatHitRequest& Request : Batch)
+    {
+        ResolveHit(Request, Context);
+    }
+}
+
+void UCombatResolverSubsystem::ResolveHit(const FCombatHitRequest& Request, FResolveContext& Context)
+{
+    AActor* Target = Request.Target.Get();
+    if (!Target) return;
+
+    AActor* Attacker = Request.Attacker.Get();
+    AActor* Causer = Request.DamageCauser.Get();
+    AController* InstigatorController = Request.InstigatorController.Get();
+
+    // ── 1) 수치 계산 (스탯은 패스 내 첫 조회 때만 읽음) ──
+    bool bWasCritical = false;
+    float FinalDamage = 0.f;
+
+    if (Attacker)
+    {
+        const FNonAttackerStats* AttackerStats = Context.Attackers.Find(Attacker);
+        if (!AttackerStats)
+        {
+            AttackerStats = &Context.Attackers.Add(Attacker, FNonAttackerStats::Capture(Attacker));
+        }
+
+        const float RawDamage = UNonDamageHelpers::ComputeDamageFromStats(*AttackerStats, Request.PowerScale, Request.DamageType, &bWasCritical);
+        if (RawDamage > 0.f)
+        {
+            const FNonDefenderStats* DefenderStats = Context.Defenders.Find(Target);
+            if (!DefenderStats)
+            {
+                DefenderStats = &Context.Defenders.Add(Target, FNonDefenderStats::Capture(Target));
+            }
+            FinalDamage = UNonDamageHelpers::ApplyDefenseFromStats(*DefenderStats, RawDamage, Request.DamageType);
+        }
+    }
+
+    if (FinalDamage <= 0.f)
+    {
+        FinalDamage = Request.FallbackDamage;
+    }
+
+    // ── 2) 데미지 적용 ──
+    if (FinalDamage > 0.f)
+    {
+        AEnemyCharacter* Enemy = Request.bApplyThroughGAS ? Cast<AEnemyCharacter>(Target) : nullptr;
+        ANonCharacterBase* Player = (Request.bApplyThroughGAS && !Enemy) ? Cast<ANonCharacterBase>(Target) : nullptr;
+
+        if (Enemy)
+        {
+            Enemy->ApplyDamageAt(FinalDamage, Causer, Request.HitLocation, bWasCritical, Request.ReactionTag);
+        }
+        else if (Player)
+        {
+            Player->ApplyDamageAt(FinalDamage, Causer, Request.HitLocation, Request.ReactionTag);
+        }
+        else
+        {
+            TSubclassOf<UDamageType> DamageTypeClass = Request.DamageTypeClass;
+            if (!DamageTypeClass)
+            {
+                DamageTypeClass = UDamageType::StaticClass();
+            }
+            UGameplayStatics::ApplyPointDamage(Target, FinalDamage, Request.HitDirection, Request.Hit, InstigatorController, Causer, DamageTypeClass);
+        }
+    }
+    else if (Request.bEffectRequiresDamage)
+    {
+        return;
+    }
+
+    // ── 3) 상태이상 GE: 같은 공격자/GE/레벨이면 Spec 을 공유 ──
+    if (!Request.AdditionalEffect) return;
+
+    UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target);
+    if (!TargetASC) return;
+
+    const TTuple<TObjectKey<AActor>, const UClass*, float, float> SpecKey(Attacker, Request.AdditionalEffect.Get(), Request.EffectLevel, Request.StunDuration);
+    FGameplayEffectSpecHandle* SpecHandle = Context.EffectSpecs.Find(SpecKey);
+    if (!SpecHandle)
+    {
+        // Spec 내용은 Instigator 기준이라 처음 맞은 대상의 ASC 로 만들어도 모든 대상에 동일
+        FGameplayEffectContextHandle Ctx = TargetASC->MakeEffectContext();
+        Ctx.AddInstigator(Attacker, InstigatorController);
+
+        FGameplayEffectSpecHandle NewSpec = TargetASC->MakeOutgoingSpec(Request.AdditionalEffect, Request.EffectLevel, Ctx);
+        if (NewSpec.IsValid() && Request.StunDuration > 0.001f)
+        {
+            NewSpec.Data->SetSetByCallerMagnitude(NonGameplayTags::Data_StunDuration, Request.StunDuration);
+        }
+        SpecHandle = &Context.EffectSpecs.Add(SpecKey, NewSpec);
+    }
+
+    if (SpecHandle->IsValid())
+    {
+        TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle->Data.Get());
+    }
+}
@@ -1,14 +1,14 @@
 #include "Combat/DamageAOE.h"
-#include "Kismet/KismetSystemLibrary.h"
-#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
 #include "Components/SceneComponent.h"
 #include "Character/EnemyCharacter.h"
 #include "Character/NonCharacterBase.h"
-#include "AbilitySystemBlueprintLibrary.h"
-#include "AbilitySystemComponent.h"
+#include "Combat/CombatResolverSubsystem.h"
+#include "Combat/AOEOverlapSubsystem.h"
 
 ADamageAOE::ADamageAOE()
 {
@@ -83,19 +83,40 @@ void ADamageAOE::BeginPlay()
         }
     }
 
-    // 첫 타격 실행
-    DoHit();
-
-    // 반복 실행 설정
-    if (TickInterval > 0.001f)
+    // 판정은 공용 오버랩 처리기에 등록 (첫 타격은 이번 프레임)
+    if (UAOEOverlapSubsystem* Overlaps = GetWorld()->GetSubsystem<UAOEOverlapSubsystem>())
     {
-        GetWorldTimerManager().SetTimer(TickTimer, this, &ADamageAOE::DoHit, TickInterval, true);
+        Overlaps->RegisterAOE(this, TickInterval > 0.001f ? TickInterval : 0.f);
+    }
+    else
+    {
+        // 첫 타격 실행
+        DoHit();
+
+        // 반복 실행 설정
+        if (TickInterval > 0.001f)
+        {
+            GetWorldTimerManager().SetTimer(TickTimer, this, &ADamageAOE::DoHit, TickInterval, true);
+        }
     }
     
     // 수명 설정
     SetLifeSpan(Duration);
 }
 
+void ADamageAOE::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        if (UAOEOverlapSubsystem* Overlaps = World->GetSubsystem<UAOEOverlapSubsystem>())
+        {
+            Overlaps->UnregisterAOE(this);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 FTransform ADamageAOE::ResolveTransform() const
 {
     if (FollowComp.IsValid())
@@ -121,22 +142,25 @@ FTransform ADamageAOE::ResolveTransform() const
     }
 }
 
-bool ADamageAOE::IsValidTarget(AActor* Other) const
+ETeamSideAOE ADamageAOE::GetTargetTeam(const AActor* Actor)
 {
-    if (!Other || Other == this || Other == GetOwner()) return false;
+    if (Cast<ANonCharacterBase>(Actor)) return ETeamSideAOE::Player;
+    if (Cast<AEnemyCharacter>(Actor)) return ETeamSideAOE::Enemy;
+    return ETeamSideAOE::Neutral;
+}
 
+bool ADamageAOE::CanHitTeam(ETeamSideAOE TargetTeam) const
+{
     switch (Team)
     {
     case ETeamSideAOE::Enemy:
         // 적군이 쏜 것 -> 타겟은 플레이어
-        if (Cast<ANonCharacterBase>(Other)) return true;
-        break;
-        
+        return TargetTeam == ETeamSideAOE::Player;
+
     case ETeamSideAOE::Player:
         // 플레이어가 쏜 것 -> 타겟은 Enemy
-        if (Cast<AEnemyCharacter>(Other)) return true;
-        break;
-        
+        return TargetTeam == ETeamSideAOE::Enemy;
+
     case ETeamSideAOE::Neutral:
         return true;
     }
@@ -144,146 +168,126 @@ bool ADamageAOE::IsValidTarget(AActor* Other) const
     return false;
 }
 
+bool ADamageAOE::IsValidTarget(AActor* Other) const
+{
+    if (!Other || Other == this || Other == GetOwner()) return false;
+    return CanHitTeam(GetTargetTeam(Other));
+}
+
 void ADamageAOE::ApplyDamageTo(AActor* Other, const FVector& HitPoint)
 {
     if (!Other) return;
 
     AActor* Caster = GetOwner() ? GetOwner() : this;
-    bool bWasCritical = false;
-
-    // 1. 데미지 계산
-    const float RawDamage = UNonDamageHelpers::ComputeDamageFromAttributes(
-        Caster,
-        Damage, 
-        DamageStatType,
-        &bWasCritical
-    );
-
-    if (RawDamage <= 0.f) return;
-
-    // 2. 방어력 적용
-    const float FinalDamage = UNonDamageHelpers::ApplyDefenseReduction(Other, RawDamage, DamageStatType);
-    if (FinalDamage <= 0.f) return;
-
-    // Debug
 
-
-    // 3. 실제 적용
-    if (ANonCharacterBase* Player = Cast<ANonCharacterBase>(Other))
-    {
-        Player->ApplyDamageAt(FinalDamage, Caster, HitPoint, HitReactionTag);
-    }
-    else if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Other))
-    {
-        Enemy->ApplyDamageAt(FinalDamage, Caster, HitPoint, bWasCritical, HitReactionTag);
-    }
-    else
-    {
-        const FVector Dir = (HitPoint - GetActorLocation()).GetSafeNormal();
-        UGameplayStatics::ApplyPointDamage(
-             Other, FinalDamage, Dir, FHitResult(), 
-             Caster->GetInstigatorController(), Caster, UDamageType::StaticClass()
-        );
-    }
+    // 계산/적용은 전투 해석기가 프레임 끝에 일괄 처리
+    // (한 번의 DoHit 에서 맞은 모든 대상이 같은 공격자 스탯 스냅샷을 공유)
+    FCombatHitRequest Request;
+    Request.Attacker = Caster;
+    Request.DamageCauser = Caster;
+    Request.Target = Other;
+    Request.InstigatorController = Caster->GetInstigatorController();
+    Request.PowerScale = Damage;
+    Request.DamageType = DamageStatType;
+    Request.HitLocation = HitPoint;
+    Request.HitDirection = (HitPoint - GetActorLocation()).GetSafeNormal();
+    Request.ReactionTag = HitReactionTag;
+
+    // 데미지가 0 이면 상태이상도 부여하지 않음
+    Request.bEffectRequiresDamage = true;
 
     // --- [New] 상태이상(GE) 적용 (ANS_HitTrace와 완벽히 동일한 로직) ---
     if (AdditionalEffect)
     {
-        if (UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Other))
+        Request.AdditionalEffect = AdditionalEffect;
+        if (ANonCharacterBase* AttackerChar = Cast<ANonCharacterBase>(Caster))
         {
-            FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
-            Ctx.AddInstigator(Caster, Caster ? Caster->GetInstigatorController() : nullptr);
-
-            float EffectLevel = 1.0f;
-            float StunDuration = 0.0f;
-            if (ANonCharacterBase* AttackerChar = Cast<ANonCharacterBase>(Caster)) {
-                EffectLevel = static_cast<float>(AttackerChar->GetLastSkillLevel());
-                StunDuration = AttackerChar->GetLastSkillStunDuration();
-            }
-
-            FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(AdditionalEffect, EffectLevel, Ctx);
-            if (SpecHandle.IsValid())
-            {
-                if (StunDuration > 0.001f)
-                {
-                    SpecHandle.Data->SetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(TEXT("Data.StunDuration"), false), StunDuration);
-                }
-                ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-            }
+            Request.EffectLevel = static_cast<float>(AttackerChar->GetLastSkillLevel());
+            Request.StunDuration = AttackerChar->GetLastSkillStunDuration();
         }
     }
-    // -----------------------------------------------------
+
+    UCombatResolverSubsystem::Submit(this, MoveTemp(Request));
 }
 
-void ADamageAOE::DoHit()
+void ADamageAOE::GetOverlapQuery(FVector& OutCenter, FCollisionShape& OutShape) const
 {
-    UWorld* World = GetWorld();
-    if (!World) return;
-
     const FTransform Trans = ResolveTransform();
-    const FVector Center = Trans.GetLocation();
-    const FQuat Quat = Trans.GetRotation();
-
-    TArray<AActor*> OverlappedActors;
-    TArray<AActor*> IgnoreActors;
-    IgnoreActors.Add(this);
-    if (GetOwner()) IgnoreActors.Add(GetOwner());
+    OutCenter = Trans.GetLocation();
 
-    // 오브젝트 타입 설정 (Pawn 중심)
-    TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
-    // 필요시 PhysicsBody, WorldDynamic 추가 가능
-
-    bool bHit = false;
+    // 판정은 기존 Kismet 오버랩과 동일하게 축 정렬 (회전은 디버그 표시에만 사용)
+    switch (Shape)
+    {
+    case EAOEShape::Sphere:  OutShape = FCollisionShape::MakeSphere(Radius); break;
+    case EAOEShape::Capsule: OutShape = FCollisionShape::MakeCapsule(Radius, CapsuleHalfHeight); break;
+    default:                 OutShape = FCollisionShape::MakeBox(BoxExtent); break;
+    }
 
-    // ── 형태별 판정 ──
-    if (Shape == EAOEShape::Box)
+    if (bDebugDraw)
     {
-        bHit = UKismetSystemLibrary::BoxOverlapActors(
-            World, Center, BoxExtent, ObjectTypes, AActor::StaticClass(), IgnoreActors, OverlappedActors
-        );
-        
-        if (bDebugDraw)
+        UWorld* World = GetWorld();
+        const FQuat Quat = Trans.GetRotation();
+        if (Shape == EAOEShape::Box)
         {
-            DrawDebugBox(World, Center, BoxExtent, Quat, FColor::Red, false, DebugDrawTime);
+            DrawDebugBox(World, OutCenter, BoxExtent, Quat, FColor::Red, false, DebugDrawTime);
         }
-    }
-    else if (Shape == EAOEShape::Sphere)
-    {
-        bHit = UKismetSystemLibrary::SphereOverlapActors(
-            World, Center, Radius, ObjectTypes, AActor::StaticClass(), IgnoreActors, OverlappedActors
-        );
-
-        if (bDebugDraw)
+        else if (Shape == EAOEShape::Sphere)
         {
-            DrawDebugSphere(World, Center, Radius, 16, FColor::Red, false, DebugDrawTime);
+            DrawDebugSphere(World, OutCenter, Radius, 16, FColor::Red, false, DebugDrawTime);
         }
-    }
-    else if (Shape == EAOEShape::Capsule)
-    {
-        bHit = UKismetSystemLibrary::CapsuleOverlapActors(
-            World, Center, Radius, CapsuleHalfHeight, ObjectTypes, AActor::StaticClass(), IgnoreActors, OverlappedActors
-        );
-
-        if (bDebugDraw)
+        else if (Shape == EAOEShape::Capsule)
         {
-            DrawDebugCapsule(World, Center, CapsuleHalfHeight, Radius, Quat, FColor::Red, false, DebugDrawTime);
+            DrawDebugCapsule(World, OutCenter, CapsuleHalfHeight, Radius, Quat, FColor::Red, false, DebugDrawTime);
         }
     }
+}
 
-    // ── 결과 처리 ──
-    for (AActor* HitActor : OverlappedActors)
+void ADamageAOE::ApplyOverlapResults(TConstArrayView<AActor*> Targets)
+{
+    for (AActor* HitActor : Targets)
     {
-        if (!IsValidTarget(HitActor)) continue;
-        
+        if (!HitActor) continue;
+
         // 싱글 히트 옵션이고 이미 맞았다면 패스
-        if (bSingleHitPerActor && HitActors.Contains(HitActor)) continue;
+        if (bSingleHitPerActor)
+        {
+            bool bAlreadyHit = false;
+            HitActors.Add(HitActor, &bAlreadyHit);
+            if (bAlreadyHit) continue;
+        }
 
         ApplyDamageTo(HitActor, HitActor->GetActorLocation());
+    }
+}
 
-        if (bSingleHitPerActor)
+void ADamageAOE::DoHit()
+{
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    // 공용 처리기가 없는 월드에서만 사용하는 단독 판정
+    FVector Center;
+    FCollisionShape QueryShape;
+    GetOverlapQuery(Center, QueryShape);
+
+    // 오브젝트 타입 설정 (Pawn 중심)
+    static const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(DamageAOE), false, this);
+    if (GetOwner()) Params.AddIgnoredActor(GetOwner());
+
+    TArray<FOverlapResult> Overlaps;
+    World->OverlapMultiByObjectType(Overlaps, Center, FQuat::Identity, ObjectParams, QueryShape, Params);
+
+    // ── 결과 처리 ──
+    TArray<AActor*, TInlineAllocator<16>> Targets;
+    for (const FOverlapResult& Overlap : Overlaps)
+    {
+        AActor* HitActor = Overlap.GetActor();
+        if (IsValidTarget(HitActor))
         {
-            HitActors.Add(HitActor);
+            Targets.AddUnique(HitActor);
         }
     }
+    ApplyOverlapResults(Targets);
 }
@@ -7,59 +7,80 @@
 static constexpr float ArmorConstant = 20.f;   // 튜닝값
 static constexpr float MinDamageRatio = 0.1f;
 
-float UNonDamageHelpers::ComputeDamageFromAttributes(AActor* SourceActor, float PowerScale, ENonDamageType DamageType, bool* bOutWasCritical)
+// 실제 ASC/AttributeSet을 갖고 있는 Pawn의 AttributeSet (투사체 등은 Instigator 기준)
+static const UNonAttributeSet* FindPawnAttributeSet(AActor* Actor)
 {
-    if (!SourceActor || PowerScale <= 0.f)
+    if (!Actor)
     {
-        return 0.f;
+        return nullptr;
     }
 
-    // 실제 ASC/AttributeSet을 갖고 있는 Pawn 찾기
-    APawn* Pawn = Cast<APawn>(SourceActor);
+    APawn* Pawn = Cast<APawn>(Actor);
     if (!Pawn)
     {
-        Pawn = Cast<APawn>(SourceActor->GetInstigator());
+        Pawn = Cast<APawn>(Actor->GetInstigator());
     }
 
-    if (!Pawn)
+    if (IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(Pawn))
     {
-        return 0.f;
+        if (UAbilitySystemComponent* ASC = ASI->GetAbilitySystemComponent())
+        {
+            return ASC->GetSet<UNonAttributeSet>();
+        }
     }
+    return nullptr;
+}
 
-    float BaseStat = 0.f;
-    float MinStat = 0.f;
-    float MaxStat = 0.f;
+FNonAttackerStats FNonAttackerStats::Capture(AActor* SourceActor)
+{
+    FNonAttackerStats Stats;
+    if (const UNonAttributeSet* Attr = FindPawnAttributeSet(SourceActor))
+    {
+        Stats.AttackPower = Attr->GetAttackPower();
+        Stats.MinAttackPower = Attr->GetMinAttackPower();
+        Stats.MaxAttackPower = Attr->GetMaxAttackPower();
+        Stats.MagicPower = Attr->GetMagicPower();
+        Stats.MinMagicPower = Attr->GetMinMagicPower();
+        Stats.MaxMagicPower = Attr->GetMaxMagicPower();
+        Stats.CriticalRate = Attr->GetCriticalRate();
+        Stats.CriticalDamage = Attr->GetCriticalDamage();
+    }
+    return Stats;
+}
 
-    // 크리티컬 관련
-    float CriticalRate = 0.f; // 확률(0~100)
-    float CriticalDamage = 0.f; // 배율(1.0 이상)
+FNonDefenderStats FNonDefenderStats::Capture(AActor* TargetActor)
+{
+    FNonDefenderStats Stats;
+    if (const UNonAttributeSet* Attr = FindPawnAttributeSet(TargetActor))
+    {
+        Stats.Defense = Attr->GetDefense();
+        Stats.MagicResist = Attr->GetMagicResist();
+    }
+    return Stats;
+}
 
-    if (IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(Pawn))
+float UNonDamageHelpers::ComputeDamageFromAttributes(AActor* SourceActor, float PowerScale, ENonDamageType DamageType, bool* bOutWasCritical)
+{
+    if (!SourceActor || PowerScale <= 0.f)
     {
-        if (UAbilitySystemComponent* ASC = ASI->GetAbilitySystemComponent())
-        {
-            if (const UNonAttributeSet* Attr = ASC->GetSet<UNonAttributeSet>())
-            {
-                if (DamageType == ENonDamageType::Physical)
-                {
-                    BaseStat = Attr->GetAttackPower();
-                    MinStat = Attr->GetMinAttackPower();
-                    MaxStat = Attr->GetMaxAttackPower();
-                }
-                else // Magical
-                {
-                    BaseStat = Attr->GetMagicPower();
-                    MinStat = Attr->GetMinMagicPower();
-                    MaxStat = Attr->GetMaxMagicPower();
-                }
-
-                // 여기서 크리티컬 값도 같이 읽어온다
-                CriticalRate = Attr->GetCriticalRate();
-                CriticalDamage = Attr->GetCriticalDamage();
-            }
-        }
+        return 0.f;
     }
 
+    return ComputeDamageFromStats(FNonAttackerStats::Capture(SourceActor), PowerScale, DamageType, bOutWasCritical);
+}
+
+float UNonDamageHelpers::ComputeDamageFromStats(const FNonAttackerStats& Stats, float PowerScale, ENonDamageType DamageType, bool* bOutWasCritical)
+{
+    if (PowerScale <= 0.f)
+    {
+        return 0.f;
+    }
+
+    const bool bPhysical = (DamageType == ENonDamageType::Physical);
+    const float BaseStat = bPhysical ? Stats.AttackPower : Stats.MagicPower;
+    const float MinStat = bPhysical ? Stats.MinAttackPower : Stats.MinMagicPower;
+    const float MaxStat = bPhysical ? Stats.MaxAttackPower : Stats.MaxMagicPower;
+
     // 사용할 스탯 결정 (Min/Max 있으면 랜덤, 아니면 Base)
     float UsedStat = BaseStat;
 
@@ -80,19 +101,16 @@ float UNonDamageHelpers::ComputeDamageFromAttributes(AActor* SourceActor, float
     bool bCritThisHit = false;
 
     // 크리티컬 적용 (방어 들어가기 "전" 단계)
-    if (CriticalRate > 0.f && CriticalDamage > 1.f)
+    if (Stats.CriticalRate > 0.f && Stats.CriticalDamage > 1.f)
     {
         const float Roll = FMath::FRandRange(0.f, 100.f); // 0~100
-        if (Roll < CriticalRate)
+        if (Roll < Stats.CriticalRate)
         {
             bCritThisHit = true;
-            Damage *= CriticalDamage;
-
-            // 나중에 크리티컬 이펙트 / 데미지 텍스트 색 바꾸고 싶으면
-            // 여기에서 "크리티컬이었다"는 플래그를 외부로 넘기는 구조(Out 파라미터)로 확장하면 됨.
+            Damage *= Stats.CriticalDamage;
         }
     }
-    // 여기 추가
+
     if (bOutWasCritical)
     {
         *bOutWasCritical = bCritThisHit;
@@ -107,37 +125,18 @@ float UNonDamageHelpers::ApplyDefenseReduction(AActor* TargetActor, float RawDam
         return 0.f;
     }
 
-    APawn* Pawn = Cast<APawn>(TargetActor);
-    if (!Pawn)
-    {
-        Pawn = Cast<APawn>(TargetActor->GetInstigator());
-    }
+    // 타겟이 Pawn/ASC 없으면 방어력 0 → 그대로
+    return ApplyDefenseFromStats(FNonDefenderStats::Capture(TargetActor), RawDamage, DamageType);
+}
 
-    if (!Pawn)
+float UNonDamageHelpers::ApplyDefenseFromStats(const FNonDefenderStats& Stats, float RawDamage, ENonDamageType DamageType)
+{
+    if (RawDamage <= 0.f)
     {
-        // 타겟이 Pawn/ASC 없으면 방어력 없이 그대로
-        return RawDamage;
+        return 0.f;
     }
 
-    float DefenseValue = 0.f;
-
-    if (IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(Pawn))
-    {
-        if (UAbilitySystemComponent* ASC = ASI->GetAbilitySystemComponent())
-        {
-            if (const UNonAttributeSet* Attr = ASC->GetSet<UNonAttributeSet>())
-            {
-                if (DamageType == ENonDamageType::Physical)
-                {
-                    DefenseValue = Attr->GetDefense();
-                }
-                else
-                {
-                    DefenseValue = Attr->GetMagicResist();
-                }
-            }
-        }
-    }
+    const float DefenseValue = (DamageType == ENonDamageType::Physical) ? Stats.Defense : Stats.MagicResist;
 
     if (DefenseValue <= 0.f)
     {
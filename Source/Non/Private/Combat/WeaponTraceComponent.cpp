@@ -0,0 +1,214 @@
+#include "Combat/WeaponTraceComponent.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimNotifyEndDataContext.h"
+#include "Animation/AnimNotifyQueue.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+UWeaponTraceComponent::UWeaponTraceComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+UWeaponTraceComponent* UWeaponTraceComponent::FindOrAdd(AActor* Owner)
+{
+    if (!Owner) return nullptr;
+
+    if (UWeaponTraceComponent* Existing = Owner->FindComponentByClass<UWeaponTraceComponent>())
+    {
+        return Existing;
+    }
+
+    UWeaponTraceComponent* Comp = NewObject<UWeaponTraceComponent>(Owner, TEXT("WeaponTrace"));
+    Comp->RegisterComponent();
+    return Comp;
+}
+
+FWeaponSwingKey UWeaponTraceComponent::MakeSwingKey(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference, const UAnimNotifyState* Notify)
+{
+    FWeaponSwingKey Key;
+    Key.Mesh = MeshComp;
+    Key.Notify = Notify;
+
+    // 같은 몽타주를 다시 재생하거나 블렌드 아웃이 겹쳐도, 이전 인스턴스의 Tick/End 는 이전 스윙을 가리킴
+    if (const UE::Anim::FAnimNotifyMontageInstanceContext* Context = EventReference.GetContextData<UE::Anim::FAnimNotifyMontageInstanceContext>())
+    {
+        Key.MontageInstanceId = Context->MontageInstanceID;
+    }
+    return Key;
+}
+
+FWeaponTraceSockets FWeaponTraceSockets::Resolve(USceneComponent* Comp, FName InStartSocket, FName InEndSocket)
+{
+    FWeaponTraceSockets Result;
+    if (!Comp || !Comp->DoesSocketExist(InStartSocket) || !Comp->DoesSocketExist(InEndSocket)) return Result;
+
+    Result.Component = Comp;
+    Result.StartSocket = InStartSocket;
+    Result.EndSocket = InEndSocket;
+
+    if (const USkeletalMeshComponent* Skel = Cast<USkeletalMeshComponent>(Comp))
+    {
+        auto ResolveBone = [Skel](FName Name, int32& OutBone, FTransform& OutLocal)
+        {
+            // 소켓이면 부모 본 + 로컬 오프셋, 본 이름이면 본 그대로
+            if (const USkeletalMeshSocket* Socket = Skel->GetSocketByName(Name))
+            {
+                OutBone = Skel->GetBoneIndex(Socket->BoneName);
+                OutLocal = Socket->GetSocketLocalTransform();
+            }
+            else
+            {
+                OutBone = Skel->GetBoneIndex(Name);
+                OutLocal = FTransform::Identity;
+            }
+        };
+        ResolveBone(InStartSocket, Result.StartBoneIndex, Result.StartLocal);
+        ResolveBone(InEndSocket, Result.EndBoneIndex, Result.EndLocal);
+    }
+    return Result;
+}
+
+bool FWeaponTraceSockets::GetLocations(FVector& OutStart, FVector& OutEnd) const
+{
+    USceneComponent* Comp = Component.Get();
+    if (!Comp) return false;
+
+    if (StartBoneIndex != INDEX_NONE && EndBoneIndex != INDEX_NONE)
+    {
+        if (const USkeletalMeshComponent* Skel = Cast<USkeletalMeshComponent>(Comp))
+        {
+            OutStart = (StartLocal * Skel->GetBoneTransform(StartBoneIndex)).GetLocation();
+            OutEnd = (EndLocal * Skel->GetBoneTransform(EndBoneIndex)).GetLocation();
+            return true;
+        }
+    }
+
+    OutStart = Comp->GetSocketLocation(StartSocket);
+    OutEnd = Comp->GetSocketLocation(EndSocket);
+    return true;
+}
+
+FWeaponSwingState& UWeaponTraceComponent::BeginSwing(const FWeaponSwingKey& Key, const FWeaponTraceSockets& Sockets)
+{
+    // 끝 이벤트를 못 받은 채 메시가 사라졌거나 몽타주 인스턴스가 끝난 스윙 정리
+    for (auto It = Swings.CreateIterator(); It; ++It)
+    {
+        const USkeletalMeshComponent* Mesh = It->Key.Mesh.Get();
+        if (!Mesh)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        if (It->Key.MontageInstanceId != INDEX_NONE)
+        {
+            // 블렌드 아웃 중인 인스턴스는 아직 노티파이를 보낼 수 있으므로 인스턴스가 사라졌을 때만 정리
+            UAnimInstance* AnimInstance = Mesh->GetAnimInstance();
+            if (!AnimInstance || !AnimInstance->GetMontageInstanceForID(It->Key.MontageInstanceId))
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    FWeaponSwingState& State = Swings.FindOrAdd(Key);
+    State = FWeaponSwingState();
+    State.Sockets = Sockets;
+    return State;
+}
+
+void UWeaponTraceComponent::EndSwing(const FWeaponSwingKey& Key)
+{
+    Swings.Remove(Key);
+}
+
+void UWeaponTraceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Swings.Reset();
+    Super::EndPlay(EndPlayReason);
+}
+
+void UWeaponTraceComponent::SweepSwing(FWeaponSwingState& State, const FWeaponSweepParams& Params, TArray<FHitResult>& OutHits) const
+{
+    AActor* Owner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!Owner || !World) return;
+
+    FVector CurStart, CurEnd;
+    if (!State.Sockets.GetLocations(CurStart, CurEnd)) return;
+
+    // 첫 판정은 현재 자세 한 번만 (이동량 0 → 서브스텝 1)
+    const FVector PrevStart = State.bHasPrev ? State.PrevStart : CurStart;
+    const FVector PrevEnd = State.bHasPrev ? State.PrevEnd : CurEnd;
+
+    State.PrevStart = CurStart;
+    State.PrevEnd = CurEnd;
+    State.bHasPrev = true;
+
+    SweepPoses(World, Owner, PrevStart, PrevEnd, CurStart, CurEnd, Params, OutHits);
+}
+
+int32 UWeaponTraceComponent::ComputeNumSubSteps(const FVector& PrevStart, const FVector& PrevEnd, const FVector& CurStart, const FVector& CurEnd, float Radius, int32 MaxSubSteps)
+{
+    const float MaxMove = FMath::Max(FVector::Dist(PrevStart, CurStart), FVector::Dist(PrevEnd, CurEnd));
+    const int32 Steps = FMath::CeilToInt(MaxMove / FMath::Max(Radius, 1.f));
+    return FMath::Clamp(Steps, 1, FMath::Max(1, MaxSubSteps));
+}
+
+void UWeaponTraceComponent::SweepPoses(UWorld* World, const AActor* IgnoreActor, const FVector& PrevStart, const FVector& PrevEnd, const FVector& CurStart, const FVector& CurEnd, const FWeaponSweepParams& Params, TArray<FHitResult>& OutHits)
+{
+    if (!World) return;
+
+    const int32 NumSteps = ComputeNumSubSteps(PrevStart, PrevEnd, CurStart, CurEnd, Params.Radius, Params.MaxSubSteps);
+
+    // 칼날 자세 = 중심 + 방향 + 길이. 끝점을 직선 보간하면 회전 중간에 칼날이 짧아지므로 방향은 구면 보간
+    const FVector PrevCenter = (PrevStart + PrevEnd) * 0.5f;
+    const FVector CurCenter = (CurStart + CurEnd) * 0.5f;
+    const FVector PrevAxis = PrevEnd - PrevStart;
+    const FVector CurAxis = CurEnd - CurStart;
+    const float PrevLen = PrevAxis.Size();
+    const float CurLen = CurAxis.Size();
+    const FQuat PrevRot = FRotationMatrix::MakeFromZ(PrevLen > KINDA_SMALL_NUMBER ? PrevAxis : FVector::UpVector).ToQuat();
+    const FQuat CurRot = FRotationMatrix::MakeFromZ(CurLen > KINDA_SMALL_NUMBER ? CurAxis : FVector::UpVector).ToQuat();
+
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(WeaponSweep), false, IgnoreActor);
+    QueryParams.bReturnPhysicalMaterial = false;
+
+    TMap<const AActor*, int32> HitIndexByActor;
+    TArray<FHitResult> StepHits;
+
+    FVector StepFrom = PrevCenter;
+    for (int32 Step = 1; Step <= NumSteps; ++Step)
+    {
+        const float Alpha = static_cast<float>(Step) / NumSteps;
+        const FVector StepTo = FMath::Lerp(PrevCenter, CurCenter, Alpha);
+        const FQuat StepRot = FQuat::Slerp(PrevRot, CurRot, Alpha);
+        const float HalfLen = FMath::Lerp(PrevLen, CurLen, Alpha) * 0.5f;
+
+        const FCollisionShape Capsule = FCollisionShape::MakeCapsule(Params.Radius, HalfLen + Params.Radius);
+
+        StepHits.Reset();
+        World->SweepMultiByChannel(StepHits, StepFrom, StepTo, StepRot, Params.Channel, Capsule, QueryParams);
+
+        for (const FHitResult& Hit : StepHits)
+        {
+            AActor* HitActor = Hit.GetActor();
+            if (!HitActor || HitActor == IgnoreActor || HitIndexByActor.Contains(HitActor)) continue;
+
+            HitIndexByActor.Add(HitActor, OutHits.Add(Hit));
+        }
+
+#if ENABLE_DRAW_DEBUG
+        if (Params.bDrawDebug)
+        {
+            DrawDebugCapsule(World, StepTo, HalfLen + Params.Radius, Params.Radius, StepRot, Params.DebugColor, false, Params.DebugDrawTime);
+        }
+#endif
+        StepFrom = StepTo;
+    }
+}
@@ -29,6 +29,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
 #include "GameplayTagContainer.h"
+#include "Ability/NonGameplayTags.h"
 
 #include "Components/CapsuleComponent.h"
 #include "DrawDebugHelpers.h"
@@ -446,30 +447,8 @@ void ANonPlayerController::OnJumpStart(const FInputActionValue & /*Value*/) {
   }
 
   // 태그 있으면 점프 막기
-  if (ASC) {
-    static const FGameplayTag DodgeTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Dodge"));
-
-    static const FGameplayTag AttackTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Attack"));
-
-    static const FGameplayTag ComboActiveTag =
-        FGameplayTag::RequestGameplayTag(TEXT("Ability.Combo"));
-
-    // ⬇ 새로 추가
-    static const FGameplayTag SkillTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Skill"));
-
-    static const FGameplayTag GuardTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Guard"));
-
-    if (ASC->HasMatchingGameplayTag(DodgeTag) ||
-        ASC->HasMatchingGameplayTag(AttackTag) ||
-        ASC->HasMatchingGameplayTag(ComboActiveTag) ||
-        ASC->HasMatchingGameplayTag(SkillTag) ||
-        ASC->HasMatchingGameplayTag(GuardTag)) {
-      return; // 점프 안 함
-    }
+  if (ASC && ASC->HasAnyMatchingGameplayTags(NonGameplayTags::GetActionBusyTags())) {
+    return; // 점프 안 함
   }
 
   // 점프 막는중 아니면 평소처럼 점프
@@ -493,26 +472,9 @@ void ANonPlayerController::OnInteract(
     ASC = ASI->GetAbilitySystemComponent();
   }
 
-  if (ASC) {
-    static const FGameplayTag DodgeTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Dodge"));
-    static const FGameplayTag AttackTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Attack"));
-    static const FGameplayTag SkillTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Skill"));
-    static const FGameplayTag GuardTag =
-        FGameplayTag::RequestGameplayTag(TEXT("State.Guard"));
-    static const FGameplayTag ComboTag =
-        FGameplayTag::RequestGameplayTag(TEXT("Ability.Combo"));
-
-    if (ASC->HasMatchingGameplayTag(DodgeTag) ||
-        ASC->HasMatchingGameplayTag(AttackTag) ||
-        ASC->HasMatchingGameplayTag(SkillTag) ||
-        ASC->HasMatchingGameplayTag(GuardTag) ||
-        ASC->HasMatchingGameplayTag(ComboTag)) {
-      // 전투 중이면 상호작용 무시
-      return;
-    }
+  if (ASC && ASC->HasAnyMatchingGameplayTags(NonGameplayTags::GetActionBusyTags())) {
+    // 전투 중이면 상호작용 무시
+    return;
   }
 
   // ==== 여기부터 캡슐 스윕 대신 포커스 타겟 사용 ====
@@ -625,8 +587,7 @@ void ANonPlayerController::OnToggleArmed(const FInputActionValue & /*Value*/) {
   if (!ASC)
     return;
 
-  static const FGameplayTag ToggleTag =
-      FGameplayTag::RequestGameplayTag(TEXT("Ability.ToggleWeapon"));
+  static const FGameplayTag ToggleTag = NonGameplayTags::Ability_ToggleWeapon;
 
   FGameplayTagContainer TagContainer;
   TagContainer.AddTag(ToggleTag);
@@ -717,8 +678,7 @@ void ANonPlayerController::OnGuardPressed(
   if (!ASC)
     return;
 
-  static const FGameplayTag GuardTag =
-      FGameplayTag::RequestGameplayTag(TEXT("Ability.Guard"));
+  static const FGameplayTag GuardTag = NonGameplayTags::Ability_Guard;
 
   FGameplayTagContainer GuardTags;
   GuardTags.AddTag(GuardTag);
@@ -739,8 +699,7 @@ void ANonPlayerController::OnGuardReleased(
   if (!ASC)
     return;
 
-  static const FGameplayTag GuardTag =
-      FGameplayTag::RequestGameplayTag(TEXT("Ability.Guard"));
+  static const FGameplayTag GuardTag = NonGameplayTags::Ability_Guard;
 
   FGameplayTagContainer GuardTags;
   GuardTags.AddTag(GuardTag);
@@ -1117,6 +1076,13 @@ void ANonPlayerController::ServerStartGame_Implementation(
   }
 }
 
+void ANonPlayerController::ClientReceiveCombatEvents_Implementation(
+    const FCombatEventBundle &Bundle) {
+  for (const FCombatEvent &Event : Bundle.Events) {
+    UCombatEventSubsystem::DispatchLocal(Event, this);
+  }
+}
+
 void ANonPlayerController::ShowGameOverUI_Implementation() {
   if (!GameOverWidgetClass) return;
 
@@ -1231,7 +1197,7 @@ void ANonPlayerController::Server_AcceptDuel_Implementation(ANonPlayerController
   CurrentDuelOpponent = Requester;
   Requester->CurrentDuelOpponent = this;
   
-  FGameplayTag DuelTag = FGameplayTag::RequestGameplayTag(TEXT("State.Combat.Dueling"));
+  FGameplayTag DuelTag = NonGameplayTags::State_Combat_Dueling;
   if (MyChar->GetAbilitySystemComponent()) {
     MyChar->GetAbilitySystemComponent()->AddLooseGameplayTag(DuelTag);
   }
@@ -1268,7 +1234,7 @@ void ANonPlayerController::Client_DeclineDuelNotification_Implementation(const F
 void ANonPlayerController::Multicast_EndDuel_Implementation(ANonPlayerController* Winner, ANonPlayerController* Loser, bool bDraw) {
   ANonCharacterBase* MyChar = Cast<ANonCharacterBase>(GetPawn());
   if (MyChar && MyChar->GetAbilitySystemComponent()) {
-    FGameplayTag DuelTag = FGameplayTag::RequestGameplayTag(TEXT("State.Combat.Dueling"));
+    FGameplayTag DuelTag = NonGameplayTags::State_Combat_Dueling;
     MyChar->GetAbilitySystemComponent()->RemoveLooseGameplayTag(DuelTag);
   }
   
@@ -95,6 +95,11 @@ void ADamageNumberActor::SetupAsDodge()
     }
 }
 
+TSubclassOf<UUserWidget> ADamageNumberActor::GetWidgetClass() const
+{
+    return WidgetComp ? WidgetComp->GetWidgetClass() : nullptr;
+}
+
 void ADamageNumberActor::BeginPlay()
 {
     Super::BeginPlay();
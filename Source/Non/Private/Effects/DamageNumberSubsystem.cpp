@@ -0,0 +1,199 @@
+#include "Effects/DamageNumberSubsystem.h"
+#include "Effects/DamageNumberActor.h"
+#include "UI/DamageNumberWidget.h"
+#include "Blueprint/UserWidget.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+
+namespace
+{
+    // HUD(ZOrder 0) 아래에 그림
+    constexpr int32 DamageNumberZOrder = -1;
+}
+
+bool UDamageNumberSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UDamageNumberSubsystem::Deinitialize()
+{
+    for (UDamageNumberWidget* Widget : AllWidgets)
+    {
+        if (Widget)
+        {
+            Widget->RemoveFromParent();
+        }
+    }
+    AllWidgets.Reset();
+    FreeWidgets.Reset();
+    Head = 0;
+    Count = 0;
+    NumActive = 0;
+
+    Super::Deinitialize();
+}
+
+TStatId UDamageNumberSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UDamageNumberSubsystem, STATGROUP_Tickables);
+}
+
+APlayerController* UDamageNumberSubsystem::GetLocalController() const
+{
+    return UGameplayStatics::GetPlayerController(this, 0);
+}
+
+void UDamageNumberSubsystem::ShowNumber(const UObject* WorldContextObject, TSubclassOf<ADamageNumberActor> StyleClass,
+    const FVector& WorldLocation, float Amount, ENonDamageNumberCategory Category, int32 FontSize)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    UDamageNumberSubsystem* Numbers = World ? World->GetSubsystem<UDamageNumberSubsystem>() : nullptr;
+    if (!Numbers) return;
+
+    if (UDamageNumberWidget* Widget = Numbers->Acquire(StyleClass, WorldLocation))
+    {
+        Widget->SetupNumber(Amount, Category, FontSize);
+    }
+}
+
+void UDamageNumberSubsystem::ShowLabel(const UObject* WorldContextObject, TSubclassOf<ADamageNumberActor> StyleClass,
+    const FVector& WorldLocation, const FText& Label, ENonDamageNumberCategory Category, int32 FontSize)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    UDamageNumberSubsystem* Numbers = World ? World->GetSubsystem<UDamageNumberSubsystem>() : nullptr;
+    if (!Numbers) return;
+
+    if (UDamageNumberWidget* Widget = Numbers->Acquire(StyleClass, WorldLocation))
+    {
+        Widget->SetupLabel(Label, Category, FontSize);
+    }
+}
+
+UDamageNumberWidget* UDamageNumberSubsystem::Acquire(TSubclassOf<ADamageNumberActor> StyleClass, const FVector& WorldLocation)
+{
+    APlayerController* PC = GetLocalController();
+    UWorld* World = GetWorld();
+    if (!PC || !World) return nullptr;
+
+    // 스타일: 액터 블루프린트의 위젯 클래스/수명
+    const ADamageNumberActor* Style = StyleClass ? GetDefault<ADamageNumberActor>(StyleClass) : GetDefault<ADamageNumberActor>();
+    TSubclassOf<UUserWidget> StyleWidget = Style->GetWidgetClass();
+    UClass* WidgetClass = (StyleWidget && StyleWidget->IsChildOf(UDamageNumberWidget::StaticClass()))
+        ? StyleWidget.Get() : UDamageNumberWidget::StaticClass();
+
+    // 링 버퍼가 가득 차면 가장 오래된 숫자를 먼저 반납
+    if (Count == MaxOnScreen)
+    {
+        Release(Ring[Head]);
+        Head = (Head + 1) % MaxOnScreen;
+        --Count;
+    }
+
+    UDamageNumberWidget* Widget = nullptr;
+    TArray<UDamageNumberWidget*>& Free = FreeWidgets.FindOrAdd(WidgetClass);
+    while (!Widget && Free.Num() > 0)
+    {
+        Widget = Free.Pop(EAllowShrinking::No);
+        if (IsValid(Widget) && Widget->GetOwningPlayer() != PC)
+        {
+            // 컨트롤러가 바뀐 경우 이전 위젯은 버림
+            Widget->RemoveFromParent();
+            AllWidgets.Remove(Widget);
+            Widget = nullptr;
+        }
+        else if (!IsValid(Widget))
+        {
+            Widget = nullptr;
+        }
+    }
+
+    if (!Widget)
+    {
+        Widget = CreateWidget<UDamageNumberWidget>(PC, WidgetClass);
+        if (!Widget) return nullptr;
+
+        AllWidgets.Add(Widget);
+        Widget->SetAlignmentInViewport(FVector2D(0.5f, 0.5f));
+        Widget->AddToPlayerScreen(DamageNumberZOrder);
+    }
+
+    FActiveNumber& Entry = Ring[(Head + Count) % MaxOnScreen];
+    Entry.Widget = Widget;
+    Entry.WorldLocation = WorldLocation;
+    Entry.ExpireTime = World->GetTimeSeconds() + Style->GetLifeTime();
+    ++Count;
+    ++NumActive;
+
+    // 첫 프레임 위치를 바로 잡아서 (0,0) 에 한 프레임 보이는 일이 없도록
+    FVector2D ScreenPos;
+    if (PC->ProjectWorldLocationToScreen(WorldLocation, ScreenPos, true))
+    {
+        Widget->SetPositionInViewport(ScreenPos, true);
+        Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+    }
+    else
+    {
+        Widget->SetVisibility(ESlateVisibility::Collapsed);
+    }
+
+    return Widget;
+}
+
+void UDamageNumberSubsystem::Release(FActiveNumber& Entry)
+{
+    if (!Entry.Widget) return;
+
+    UDamageNumberWidget* Widget = Entry.Widget;
+    Entry.Widget = nullptr;
+    --NumActive;
+
+    if (IsValid(Widget))
+    {
+        Widget->SetVisibility(ESlateVisibility::Collapsed);
+        FreeWidgets.FindOrAdd(Widget->GetClass()).Add(Widget);
+    }
+}
+
+void UDamageNumberSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (Count == 0) return;
+
+    APlayerController* PC = GetLocalController();
+    UWorld* World = GetWorld();
+    const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        FActiveNumber& Entry = Ring[(Head + i) % MaxOnScreen];
+        if (!Entry.Widget) continue;
+
+        if (!PC || Now >= Entry.ExpireTime || !IsValid(Entry.Widget))
+        {
+            Release(Entry);
+            continue;
+        }
+
+        // 카메라 뒤로 넘어가면 숨김
+        FVector2D ScreenPos;
+        if (PC->ProjectWorldLocationToScreen(Entry.WorldLocation, ScreenPos, true))
+        {
+            Entry.Widget->SetPositionInViewport(ScreenPos, true);
+            Entry.Widget->SetVisibility(ESlateVisibility::HitTestInvisible);
+        }
+        else
+        {
+            Entry.Widget->SetVisibility(ESlateVisibility::Collapsed);
+        }
+    }
+
+    // 앞쪽의 빈 칸 정리
+    while (Count > 0 && !Ring[Head].Widget)
+    {
+        Head = (Head + 1) % MaxOnScreen;
+        --Count;
+    }
+}
@@ -19,6 +19,7 @@
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
 #include "Equipment/WeaponBase.h"
+#include "NiagaraComponent.h"
 #include "GameFramework/Character.h"
 #include "Net/UnrealNetwork.h"                             // [Multiplayer]
 #include "Ability/NonAttributeSet.h"
@@ -97,7 +98,7 @@ bool UEquipmentComponent::EquipFromInventory(UInventoryComponent *Inv,
   if (!Item)
     return false;
 
-  const FItemRow &Row = Item->CachedRow;
+  const FItemRow &Row = Item->GetRow();
   const EEquipmentSlot Target =
       (OptionalTarget != EEquipmentSlot::None) ? OptionalTarget : Row.EquipSlot;
 
@@ -139,7 +140,7 @@ bool UEquipmentComponent::EquipItem(UInventoryItem *Item,
                                     EEquipmentSlot OptionalTarget) {
   if (!Item)
     return false;
-  const FItemRow &Row = Item->CachedRow;
+  const FItemRow &Row = Item->GetRow();
   const EEquipmentSlot Target =
       (OptionalTarget != EEquipmentSlot::None) ? OptionalTarget : Row.EquipSlot;
 
@@ -230,6 +231,7 @@ bool UEquipmentComponent::ReattachSlotToSocket(EEquipmentSlot Slot,
   }
 
   if (bAttachedSomething) {
+    InvalidateTraceCache(Slot);
 
     if (FEquipmentVisual *VS = VisualSlots.Find(Slot)) {
       VS->Socket = NewSocket;
@@ -264,7 +266,7 @@ bool UEquipmentComponent::CanEquip(const UInventoryItem *Item,
     return false;
   }
 
-  const FItemRow &Row = Item->CachedRow;
+  const FItemRow &Row = Item->GetRow();
 
   // 반드시 장비 타입이어야 함
   if (Row.ItemType != EItemType::Equipment) {
@@ -300,7 +302,7 @@ bool UEquipmentComponent::EquipInternal(UInventoryItem *Item,
   if (TObjectPtr<UInventoryItem> *FoundPtr = Equipped.Find(TargetSlot)) {
     Replaced = FoundPtr->Get();
     if (Replaced) {
-      RemoveEquipmentEffects(Replaced->CachedRow);
+      RemoveEquipmentEffects(Replaced->GetRow());
     }
     RemoveVisual(TargetSlot);
 
@@ -343,7 +345,7 @@ bool UEquipmentComponent::EquipInternal(UInventoryItem *Item,
   // ===================
   auto IsTwoHandOrStaff = [](const UInventoryItem *It) -> bool {
     return It && (It->IsTwoHandedWeapon() ||
-                  It->CachedRow.WeaponType ==
+                  It->GetRow().WeaponType ==
                       EWeaponType::Staff); // 프로젝트에 맞게 Staff 판정 보강
   };
 
@@ -382,10 +384,10 @@ bool UEquipmentComponent::EquipInternal(UInventoryItem *Item,
   const bool bStillEquippedHere = (GetEquippedItemBySlot(TargetSlot) == Item);
   if (bStillEquippedHere) {
     // 비주얼 생성/부착
-    ApplyVisual(TargetSlot, Item->CachedRow);
+    ApplyVisual(TargetSlot, Item->GetRow());
 
     // 효과 적용/세트 보너스 갱신
-    ApplyEquipmentEffects(Item->CachedRow);
+    ApplyEquipmentEffects(Item->GetRow());
     RecomputeSetBonuses();
 
     // 홈소켓 캐시 재계산
@@ -398,12 +400,12 @@ bool UEquipmentComponent::EquipInternal(UInventoryItem *Item,
       if (ANonCharacterBase *Char = Cast<ANonCharacterBase>(GetOwner())) {
         if (UAbilitySystemComponent *ASC = Char->GetAbilitySystemComponent()) {
           // 1) 개별 아이템 지정 (GrantedAbilities)
-          if (Item->CachedRow.GrantedAbilities.Num() > 0) {
+          if (Item->GetRow().GrantedAbilities.Num() > 0) {
             FGrantedAbilityHandles &HandleEntry =
                 GrantedAbilityHandles.FindOrAdd(TargetSlot);
 
             for (const TSubclassOf<UGameplayAbility> &AbilityClass :
-                 Item->CachedRow.GrantedAbilities) {
+                 Item->GetRow().GrantedAbilities) {
               if (AbilityClass) {
                 FGameplayAbilitySpec Spec(AbilityClass, 1, INDEX_NONE, Char);
                 FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(Spec);
@@ -414,7 +416,7 @@ bool UEquipmentComponent::EquipInternal(UInventoryItem *Item,
 
           // 2) [New] 무기 타입별 자동 지정 (WeaponTypeDefaultAbilities)
           if (const FWeaponDefaultAbilities *FoundSet =
-                  WeaponTypeDefaultAbilities.Find(Item->CachedRow.WeaponType)) {
+                  WeaponTypeDefaultAbilities.Find(Item->GetRow().WeaponType)) {
             for (const TSubclassOf<UGameplayAbility> &AbilityClass :
                  FoundSet->Abilities) {
               if (AbilityClass) {
@@ -476,14 +478,14 @@ bool UEquipmentComponent::EquipInternal(UInventoryItem *Item,
       if (!bReturned) {
         // 되돌리기 실패 → 전체 롤백
         if (bStillEquippedHere) {
-          RemoveEquipmentEffects(Item->CachedRow);
+          RemoveEquipmentEffects(Item->GetRow());
           RemoveVisual(TargetSlot);
         }
 
         // 예전 아이템 복원
         Equipped.Add(TargetSlot, Replaced);
-        ApplyVisual(TargetSlot, Replaced->CachedRow);
-        ApplyEquipmentEffects(Replaced->CachedRow);
+        ApplyVisual(TargetSlot, Replaced->GetRow());
+        ApplyEquipmentEffects(Replaced->GetRow());
         RecomputeSetBonuses();
         if (OutReturnedIndex) {
           *OutReturnedIndex = INDEX_NONE;
@@ -510,7 +512,7 @@ bool UEquipmentComponent::EquipInternal(UInventoryItem *Item,
 
 void UEquipmentComponent::UnequipInternal(EEquipmentSlot Slot) {
   if (UInventoryItem *Item = GetEquippedItemBySlot(Slot)) {
-    RemoveEquipmentEffects(Item->CachedRow);
+    RemoveEquipmentEffects(Item->GetRow());
   }
 
   RemoveVisual(Slot);
@@ -561,7 +563,7 @@ void UEquipmentComponent::ResolveTwoHandedConflicts() {
   if (UInventoryItem *Main =
           GetEquippedItemBySlot(EEquipmentSlot::WeaponMain)) {
     const bool bTwoHandOrStaff = Main->IsTwoHandedWeapon() ||
-                                 (Main->CachedRow.WeaponType ==
+                                 (Main->GetRow().WeaponType ==
                                   EWeaponType::Staff); // 프로젝트에 맞게 조정
 
     if (bTwoHandOrStaff) {
@@ -580,14 +582,14 @@ void UEquipmentComponent::ResolveWeaponSubConflicts() {
   // 보조가 방패면 메인에 2H/Staff 금지
   if (UInventoryItem *Sub = GetEquippedItemBySlot(EEquipmentSlot::WeaponSub)) {
     const bool bWeaponSub =
-        (Sub->CachedRow.WeaponType == EWeaponType::WeaponSub);
+        (Sub->GetRow().WeaponType == EWeaponType::WeaponSub);
     if (!bWeaponSub)
       return;
 
     if (UInventoryItem *Main =
             GetEquippedItemBySlot(EEquipmentSlot::WeaponMain)) {
       const bool bTwoHandOrStaff = Main->IsTwoHandedWeapon() ||
-                                   (Main->CachedRow.WeaponType ==
+                                   (Main->GetRow().WeaponType ==
                                     EWeaponType::Staff); // 프로젝트에 맞게 조정
 
       if (bTwoHandOrStaff) {
@@ -731,6 +733,8 @@ void UEquipmentComponent::ApplyVisual(EEquipmentSlot Slot,
   }
 }
 void UEquipmentComponent::RemoveVisual(EEquipmentSlot Slot) {
+  InvalidateTraceCache(Slot);
+
   if (TObjectPtr<UMeshComponent> *Found = VisualComponents.Find(Slot)) {
     if (UMeshComponent *MC = Found->Get()) {
       MC->DestroyComponent();
@@ -899,13 +903,13 @@ void UEquipmentComponent::RecomputeSetBonuses() {
   for (const auto& Pair : Equipped)
   {
       UInventoryItem* Item = Pair.Value;
-      if (Item && Item->CachedRow.bIsSetItem)
+      if (Item && Item->GetRow().bIsSetItem)
       {
-          FName SId = Item->CachedRow.SetId;
+          FName SId = Item->GetRow().SetId;
           SetCounts.FindOrAdd(SId)++;
           if (!SetRowMap.Contains(SId))
           {
-              SetRowMap.Add(SId, &Item->CachedRow);
+              SetRowMap.Add(SId, &Item->GetRow());
           }
       }
   }
@@ -1050,7 +1054,7 @@ bool UEquipmentComponent::IsTwoHandedLike(const UInventoryItem *Item) const {
 
   // 너 프로젝트의 무기 타입 접근으로 교체
   const EWeaponType WT =
-      Item->CachedRow.WeaponType; // 예: Item->CachedRow.WeaponType;
+      Item->GetRow().WeaponType; // 예: Item->GetRow().WeaponType;
   switch (WT) {
   case EWeaponType::TwoHanded:
   case EWeaponType::Staff: //  스태프를 양손처럼 취급
@@ -1076,6 +1080,7 @@ UEquipmentComponent::GetEquippedItemsForSave() const {
       Data.Slot = Pair.Key;
       Data.ItemId = Item->ItemId;
       Data.Quantity = Item->Quantity;
+      Data.EnhancementLevel = Item->EnhancementLevel;
       OutData.Add(Data);
     }
   }
@@ -1128,7 +1133,7 @@ void UEquipmentComponent::RestoreEquippedItemsFromSave(
     // Row 데이터 로드 (필수)
     // 만약 UInventoryComponent에 GetItemRow 같은 헬퍼가 있다면 사용.
     // 없다면 Subsystem 사용.
-    // 현재 코드상 UInventoryItem::CachedRow는 public이므로 직접 채워야 할 수도.
+    // 현재 코드상 UInventoryItem::Definition 핸들을 직접 채워야 할 수도.
     // -> 보통 CreateItem 류 함수가 처리함.
 
     // 일단 GameInstance의 Subsystem(가령 SkillSystemSubsystem 처럼
@@ -1208,6 +1213,9 @@ void UEquipmentComponent::RestoreEquippedItemsFromSave(
       int32 AddedIdx = INDEX_NONE;
       // 인벤토리에 잠시 추가 (Row 로드됨)
       if (InvComp->AddItem(Data.ItemId, Data.Quantity, AddedIdx)) {
+        if (UInventoryItem *Added = InvComp->GetAt(AddedIdx)) {
+          Added->EnhancementLevel = Data.EnhancementLevel;
+        }
         // 바로 장착 (EquipFromInventory 사용)
         EquipFromInventory(InvComp, AddedIdx, Data.Slot);
       }
@@ -1245,7 +1253,7 @@ void UEquipmentComponent::UpdateWeaponTags(bool bIsArmed) {
   // 2) 서브 무기 (방패 등) - 항상 태그 부여 (사용자 요청: 토글 없음)
   if (UInventoryItem *Sub = GetEquippedItemBySlot(EEquipmentSlot::WeaponSub)) {
     if (const FGameplayTagContainer *FoundTags =
-            WeaponTypeArmedTags.Find(Sub->CachedRow.WeaponType)) {
+            WeaponTypeArmedTags.Find(Sub->GetRow().WeaponType)) {
       ASC->AddLooseGameplayTags(*FoundTags);
     }
   }
@@ -1258,7 +1266,7 @@ void UEquipmentComponent::UpdateWeaponTags(bool bIsArmed) {
   if (UInventoryItem *Main =
           GetEquippedItemBySlot(EEquipmentSlot::WeaponMain)) {
     if (const FGameplayTagContainer *FoundTags =
-            WeaponTypeArmedTags.Find(Main->CachedRow.WeaponType)) {
+            WeaponTypeArmedTags.Find(Main->GetRow().WeaponType)) {
       if (FoundTags->Num() > 0) {
         ASC->AddLooseGameplayTags(*FoundTags);
       }
@@ -1294,14 +1302,14 @@ void UEquipmentComponent::UpdateWeaponTags(bool bIsArmed) {
   if (UInventoryItem *Main =
           GetEquippedItemBySlot(EEquipmentSlot::WeaponMain)) {
     if (const FGameplayTagContainer *FoundTags =
-            WeaponTypeArmedTags.Find(Main->CachedRow.WeaponType)) {
+            WeaponTypeArmedTags.Find(Main->GetRow().WeaponType)) {
       TagsToAdd_Client.AppendTags(*FoundTags);
     }
   }
   // 서브 무기 태그도 있다면 추가 (코드 상단 953라인 참고)
   if (UInventoryItem *Sub = GetEquippedItemBySlot(EEquipmentSlot::WeaponSub)) {
     if (const FGameplayTagContainer *FoundTags =
-            WeaponTypeArmedTags.Find(Sub->CachedRow.WeaponType)) {
+            WeaponTypeArmedTags.Find(Sub->GetRow().WeaponType)) {
       TagsToAdd_Client.AppendTags(*FoundTags);
     }
   }
@@ -1399,3 +1407,70 @@ AActor *UEquipmentComponent::GetEquippedActor(EEquipmentSlot Slot) const {
   }
   return nullptr;
 }
+
+// ==================== 무기 트레이스 캐시 ====================
+
+const FWeaponTraceSockets *
+UEquipmentComponent::FindTraceSockets(EEquipmentSlot Slot, FName StartSocket,
+                                      FName EndSocket) {
+  TArray<FWeaponTraceSockets> &Entries = TraceSocketCache.FindOrAdd(Slot);
+
+  for (int32 i = 0; i < Entries.Num(); ++i) {
+    FWeaponTraceSockets &Entry = Entries[i];
+    if (Entry.StartSocket != StartSocket || Entry.EndSocket != EndSocket)
+      continue;
+
+    // 무효화 없이 컴포넌트가 사라진 경우에만 다시 해석
+    if (Entry.Component.IsStale()) {
+      Entries.RemoveAtSwap(i);
+      break;
+    }
+    return Entry.IsValid() ? &Entry : nullptr;
+  }
+
+  FWeaponTraceSockets Resolved;
+
+  // 1) 스폰된 무기 액터의 컴포넌트
+  if (AActor *SpawnedActor = GetEquippedActor(Slot)) {
+    TArray<USceneComponent *> Comps;
+    SpawnedActor->GetComponents<USceneComponent>(Comps);
+    for (USceneComponent *C : Comps) {
+      Resolved = FWeaponTraceSockets::Resolve(C, StartSocket, EndSocket);
+      if (Resolved.IsValid())
+        break;
+    }
+  }
+
+  // 2) 슬롯 비주얼 컴포넌트
+  if (!Resolved.IsValid()) {
+    Resolved = FWeaponTraceSockets::Resolve(GetVisualComponent(Slot),
+                                            StartSocket, EndSocket);
+  }
+
+  // 못 찾은 경우도 소켓 이름은 남겨서 다음 조회 때 바로 nullptr
+  Resolved.StartSocket = StartSocket;
+  Resolved.EndSocket = EndSocket;
+  FWeaponTraceSockets &Added = Entries.Add_GetRef(Resolved);
+  return Added.IsValid() ? &Added : nullptr;
+}
+
+UNiagaraComponent *UEquipmentComponent::GetActiveTrail(EEquipmentSlot Slot) const {
+  if (const TWeakObjectPtr<UNiagaraComponent> *Found = ActiveTrails.Find(Slot)) {
+    return Found->Get();
+  }
+  return nullptr;
+}
+
+void UEquipmentComponent::SetActiveTrail(EEquipmentSlot Slot,
+                                         UNiagaraComponent *Trail) {
+  if (Trail) {
+    ActiveTrails.Add(Slot, Trail);
+  } else {
+    ActiveTrails.Remove(Slot);
+  }
+}
+
+void UEquipmentComponent::InvalidateTraceCache(EEquipmentSlot Slot) {
+  TraceSocketCache.Remove(Slot);
+  ActiveTrails.Remove(Slot);
+}
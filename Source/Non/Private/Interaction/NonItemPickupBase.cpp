@@ -57,6 +57,9 @@ void ANonItemPickupBase::Interact_Implementation(ANonCharacterBase* Interactor)
         return;
     }
 
+    // 획득 처리 중 슬롯 변경은 한 번의 갱신으로 묶음
+    FScopedInventoryTransaction Transaction(Inv);
+
     int32 LastSlot = INDEX_NONE;
     const bool bAdded = Inv->AddItem(ItemId, Count, LastSlot);
     if (bAdded)
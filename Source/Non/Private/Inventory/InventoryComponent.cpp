@@ -4,13 +4,122 @@
 #include "TimerManager.h"
 #include "Net/UnrealNetwork.h" // [Multiplayer]
 #include "AbilitySystemComponent.h"
+#include "System/ItemDefinitionSubsystem.h"
+#include "Algo/BinarySearch.h"
 
 UInventoryComponent::UInventoryComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
     SetIsReplicatedByDefault(true); // 컴포넌트 리플리케이션 활성화
+    ReplicatedSlots.Owner = this;   // FastArray 컨테이너에 소유자 연결
 }
 
+// ===== FReplicatedInventoryList =====
+void FReplicatedInventoryList::SetSlot(int32 SlotIndex, const UInventoryItem* Item)
+{
+    if (SlotIndex < 0) return;
+
+    if (!EntryIndexBySlot.IsValidIndex(SlotIndex))
+    {
+        const int32 OldNum = EntryIndexBySlot.Num();
+        EntryIndexBySlot.SetNumUninitialized(SlotIndex + 1);
+        for (int32 i = OldNum; i < EntryIndexBySlot.Num(); ++i) EntryIndexBySlot[i] = INDEX_NONE;
+    }
+
+    const int32 EntryIdx = EntryIndexBySlot[SlotIndex];
+
+    if (Item)
+    {
+        if (EntryIdx != INDEX_NONE)
+        {
+            // 내용이 같으면 Dirty 처리하지 않음 (불필요한 델타 방지)
+            FReplicatedInventorySlot& Entry = Items[EntryIdx];
+            if (Entry.ItemId == Item->ItemId && Entry.Quantity == Item->Quantity && Entry.EnhancementLevel == Item->EnhancementLevel) return;
+
+            Entry.ItemId = Item->ItemId;
+            Entry.Quantity = Item->Quantity;
+            Entry.EnhancementLevel = Item->EnhancementLevel;
+            MarkItemDirty(Entry);
+        }
+        else
+        {
+            EntryIndexBySlot[SlotIndex] = Items.Num();
+
+            FReplicatedInventorySlot& Entry = Items.AddDefaulted_GetRef();
+            Entry.SlotIndex = SlotIndex;
+            Entry.ItemId = Item->ItemId;
+            Entry.Quantity = Item->Quantity;
+            Entry.EnhancementLevel = Item->EnhancementLevel;
+            MarkItemDirty(Entry);
+        }
+    }
+    else if (EntryIdx != INDEX_NONE)
+    {
+        // 제거: 마지막 항목을 빈 자리로 옮기고 인덱스 보정
+        EntryIndexBySlot[SlotIndex] = INDEX_NONE;
+        Items.RemoveAtSwap(EntryIdx);
+        if (Items.IsValidIndex(EntryIdx))
+        {
+            EntryIndexBySlot[Items[EntryIdx].SlotIndex] = EntryIdx;
+        }
+        MarkArrayDirty();
+    }
+}
+
+void FReplicatedInventoryList::BeginReceiveBatch()
+{
+    if (!bReceiveBatchOpen && Owner)
+    {
+        Owner->BeginTransaction();
+        bReceiveBatchOpen = true;
+    }
+}
+
+void FReplicatedInventoryList::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
+{
+    if (!Owner) return;
+    BeginReceiveBatch();
+    for (const int32 Idx : AddedIndices)
+    {
+        Owner->HandleReplicatedSlotChanged(Items[Idx]);
+    }
+}
+
+void FReplicatedInventoryList::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+    if (!Owner) return;
+    BeginReceiveBatch();
+    for (const int32 Idx : ChangedIndices)
+    {
+        Owner->HandleReplicatedSlotChanged(Items[Idx]);
+    }
+}
+
+void FReplicatedInventoryList::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+    if (!Owner) return;
+    BeginReceiveBatch();
+    for (const int32 Idx : RemovedIndices)
+    {
+        Owner->HandleReplicatedSlotRemoved(Items[Idx]);
+    }
+}
+
+void FReplicatedInventoryList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    // 정렬/일괄 복원처럼 여러 슬롯이 한 번에 오면 OnInventoryRefreshed 한 번, 한 슬롯이면 OnSlotUpdated 한 번
+    if (bReceiveBatchOpen)
+    {
+        bReceiveBatchOpen = false;
+        if (Owner)
+        {
+            Owner->CommitTransaction();
+        }
+    }
+}
+
+// ===== UInventoryComponent =====
+
 void UInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -25,8 +134,20 @@ void UInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 void UInventoryComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    // FastArray 컨테이너 소유자 재설정 (안전용)
+    ReplicatedSlots.Owner = this;
+
+    // 아이템 정의 레지스트리는 게임 인스턴스 단위로 한 번만 색인
+    if (UItemDefinitionSubsystem* Registry = UItemDefinitionSubsystem::Get(this))
+    {
+        Registry->RegisterTable(ItemDataTable);
+    }
+
     Slots.SetNum(MaxSlots);
-    OnInventoryRefreshed.Broadcast();
+    RebuildSlotIndex();
+
+    FScopedInventoryTransaction Transaction(this);
     for (int32 i = 0; i < Slots.Num(); ++i) BroadcastSlot(i);
 }
 
@@ -37,6 +158,12 @@ UInventoryItem* UInventoryComponent::GetAt(int32 Index) const
 
 int32 UInventoryComponent::GetFirstEmptySlot() const
 {
+    if (IsSlotIndexValid())
+    {
+        return FreeSlotBits.Find(true);
+    }
+
+    // 색인이 아직 준비되지 않았으면 선형 탐색
     for (int32 i = 0; i < Slots.Num(); ++i)
     {
         if (Slots[i] == nullptr) return i;
@@ -46,11 +173,18 @@ int32 UInventoryComponent::GetFirstEmptySlot() const
 
 int32 UInventoryComponent::FindStackableSlot(FName ItemId) const
 {
+    if (IsSlotIndexValid())
+    {
+        // 가장 앞쪽의 열린 스택부터 채움 (목록은 오름차순 유지)
+        const TArray<int32>* Open = OpenStacksByItem.Find(ItemId);
+        return (Open && Open->Num() > 0) ? (*Open)[0] : INDEX_NONE;
+    }
+
     for (int32 i = 0; i < Slots.Num(); ++i)
     {
         if (const UInventoryItem* It = Slots[i])
         {
-            if (It->ItemId == ItemId && It->IsStackable() && It->Quantity < It->CachedRow.MaxStack)
+            if (It->ItemId == ItemId && It->IsStackable() && It->Quantity < It->GetMaxStack())
             {
                 return i;
             }
@@ -59,6 +193,55 @@ int32 UInventoryComponent::FindStackableSlot(FName ItemId) const
     return INDEX_NONE;
 }
 
+void UInventoryComponent::UpdateSlotIndex(int32 Index)
+{
+    if (!IsSlotIndexValid())
+    {
+        RebuildSlotIndex();
+        return;
+    }
+    if (!IsValidIndex(Index)) return;
+
+    // 1. 이전 등록 해제
+    FName& Key = OpenStackKeyBySlot[Index];
+    if (!Key.IsNone())
+    {
+        if (TArray<int32>* Open = OpenStacksByItem.Find(Key))
+        {
+            const int32 Pos = Algo::BinarySearch(*Open, Index);
+            if (Pos != INDEX_NONE)
+            {
+                Open->RemoveAt(Pos, 1, EAllowShrinking::No);
+            }
+            if (Open->Num() == 0) OpenStacksByItem.Remove(Key);
+        }
+        Key = NAME_None;
+    }
+
+    // 2. 현재 상태로 재등록
+    const UInventoryItem* It = Slots[Index];
+    FreeSlotBits[Index] = (It == nullptr);
+
+    if (It && It->IsStackable() && It->Quantity < It->GetMaxStack())
+    {
+        TArray<int32>& Open = OpenStacksByItem.FindOrAdd(It->ItemId);
+        Open.Insert(Index, Algo::LowerBound(Open, Index));
+        Key = It->ItemId;
+    }
+}
+
+void UInventoryComponent::RebuildSlotIndex()
+{
+    FreeSlotBits.Init(false, Slots.Num());
+    OpenStackKeyBySlot.Init(NAME_None, Slots.Num());
+    OpenStacksByItem.Reset();
+
+    for (int32 i = 0; i < Slots.Num(); ++i)
+    {
+        UpdateSlotIndex(i);
+    }
+}
+
 bool UInventoryComponent::AddItem(FName ItemId, int32 Quantity, int32& OutLastSlotIndex)
 {
     OutLastSlotIndex = INDEX_NONE;
@@ -66,6 +249,9 @@ bool UInventoryComponent::AddItem(FName ItemId, int32 Quantity, int32& OutLastSl
     if (!ItemDataTable) return false;
     if (ItemId.IsNone() || Quantity <= 0) return false;
 
+    // 여러 슬롯에 나눠 들어가도 갱신은 한 번만
+    FScopedInventoryTransaction Transaction(this);
+
     int32 Remaining = Quantity;
     while (Remaining > 0)
     {
@@ -73,7 +259,7 @@ bool UInventoryComponent::AddItem(FName ItemId, int32 Quantity, int32& OutLastSl
         if (StackSlot != INDEX_NONE)
         {
             UInventoryItem* Stk = Slots[StackSlot];
-            const int32 MaxAdd = Stk->CachedRow.MaxStack - Stk->Quantity;
+            const int32 MaxAdd = Stk->GetMaxStack() - Stk->Quantity;
             const int32 ToAdd = FMath::Min(MaxAdd, Remaining);
             Stk->Quantity += ToAdd;
             
@@ -89,9 +275,8 @@ bool UInventoryComponent::AddItem(FName ItemId, int32 Quantity, int32& OutLastSl
         const int32 Empty = GetFirstEmptySlot();
         if (Empty == INDEX_NONE) break;
 
-        int32 MaxStack = 1;
-        if (const FItemRow* Row = ItemDataTable->FindRow<FItemRow>(ItemId, TEXT("AddItem_MaxStack")))
-            MaxStack = FMath::Max(1, Row->MaxStack);
+        const FItemDefinitionHandle Def = UItemDefinitionSubsystem::Resolve(this, ItemId, ItemDataTable);
+        const int32 MaxStack = FMath::Max(1, Def->MaxStack);
 
         const int32 ToCreate = FMath::Min(MaxStack, Remaining);
         UInventoryItem* NewObj = NewObject<UInventoryItem>(this);
@@ -145,7 +330,7 @@ bool UInventoryComponent::Move(int32 From, int32 To)
         Slots[From]->ItemId == Slots[To]->ItemId &&
         Slots[To]->IsStackable())
     {
-        const int32 MaxStack = Slots[To]->CachedRow.MaxStack;
+        const int32 MaxStack = Slots[To]->GetRow().MaxStack;
         const int32 Space = MaxStack - Slots[To]->Quantity;
         if (Space > 0)
         {
@@ -197,7 +382,9 @@ bool UInventoryComponent::SplitStack(int32 From, int32 To, int32 MoveQty)
 void UInventoryComponent::Refresh()
 {
     Slots.SetNum(MaxSlots);
-    OnInventoryRefreshed.Broadcast();
+    RebuildSlotIndex();
+
+    FScopedInventoryTransaction Transaction(this);
     for (int32 i = 0; i < Slots.Num(); ++i) BroadcastSlot(i);
 }
 
@@ -205,70 +392,114 @@ void UInventoryComponent::BroadcastSlot(int32 Index)
 {
     if (IsValidIndex(Index))
     {
-        // [Multiplayer] 서버에서 변경 시 리플리케이션 배열 동기화
-        if (GetOwner()->HasAuthority())
-        {
-            // 리플리케이션 배열에서 해당 슬롯 찾기
-            int32 FoundIdx = ReplicatedSlots.IndexOfByPredicate([Index](const FReplicatedInventorySlot& Entry) {
-                return Entry.SlotIndex == Index;
-            });
+        // 빈 슬롯/스택 색인은 변경 즉시 반영
+        UpdateSlotIndex(Index);
 
-            UInventoryItem* CurrentItem = Slots[Index];
-
-            if (CurrentItem)
-            {
-                // 아이템이 있으면: 업데이트 or 추가
-                FReplicatedInventorySlot NewData;
-                NewData.SlotIndex = Index;
-                NewData.ItemId = CurrentItem->ItemId;
-                NewData.Quantity = CurrentItem->Quantity;
+        // 트랜잭션 중이면 Commit 때 한 번에 처리
+        if (TransactionDepth > 0)
+        {
+            if (PendingDirtySlots.Num() < Slots.Num()) PendingDirtySlots.SetNum(Slots.Num(), false);
+            PendingDirtySlots[Index] = true;
+            return;
+        }
 
-                if (FoundIdx != INDEX_NONE)
-                {
-                    ReplicatedSlots[FoundIdx] = NewData;
-                }
-                else
-                {
-                    ReplicatedSlots.Add(NewData);
-                }
-            }
-            else
-            {
-                // 아이템이 없으면: 제거
-                if (FoundIdx != INDEX_NONE)
-                {
-                    ReplicatedSlots.RemoveAt(FoundIdx);
-                }
-            }
+        // [Multiplayer] 서버에서 변경 시 해당 슬롯 항목만 Dirty 처리 (델타 복제)
+        if (GetOwner()->HasAuthority())
+        {
+            ReplicatedSlots.SetSlot(Index, Slots[Index]);
         }
 
         OnSlotUpdated.Broadcast(Index, Slots[Index]);
     }
 }
 
-void UInventoryComponent::OnRep_ReplicatedSlots()
+void UInventoryComponent::BeginTransaction()
 {
-    // 리플리케이션 데이터 수신 시, 로컬 Slots 배열을 재구성
-    
-    // 1. 일단 싹 비우기 (MaxSlots 유지)
-    // (주의: 드래그 중인 아이템이 있으면 곤란할 수 있지만, 여기서는 단순화)
-    Slots.Init(nullptr, MaxSlots);
+    ++TransactionDepth;
+}
 
-    // 2. 복원
-    if (!ItemDataTable) return;
+void UInventoryComponent::CommitTransaction()
+{
+    if (TransactionDepth <= 0) return;
+    if (--TransactionDepth > 0) return;
+
+    const bool bAuthority = GetOwner() && GetOwner()->HasAuthority();
 
-    for (const FReplicatedInventorySlot& Data : ReplicatedSlots)
+    int32 NumDirty = 0;
+    int32 LastDirty = INDEX_NONE;
+    for (TConstSetBitIterator<> It(PendingDirtySlots); It; ++It)
     {
-        if (Slots.IsValidIndex(Data.SlotIndex))
+        const int32 Index = It.GetIndex();
+        if (!IsValidIndex(Index)) continue;
+
+        // [Multiplayer] 슬롯당 한 번만 복제 항목 갱신
+        if (bAuthority)
         {
-            UInventoryItem* NewItem = NewObject<UInventoryItem>(this);
-            NewItem->Init(Data.ItemId, Data.Quantity, ItemDataTable);
-            Slots[Data.SlotIndex] = NewItem;
+            ReplicatedSlots.SetSlot(Index, Slots[Index]);
         }
+        ++NumDirty;
+        LastDirty = Index;
     }
+    PendingDirtySlots.Reset();
 
-    // 3. UI 갱신 알림
-    OnInventoryRefreshed.Broadcast();
+    // UI 알림도 한 번만: 단일 슬롯이면 슬롯 갱신, 여러 슬롯이면 전체 리프레시
+    if (NumDirty == 1)
+    {
+        OnSlotUpdated.Broadcast(LastDirty, Slots[LastDirty]);
+    }
+    else if (NumDirty > 1)
+    {
+        OnInventoryRefreshed.Broadcast();
+    }
+}
+
+FScopedInventoryTransaction::FScopedInventoryTransaction(UInventoryComponent* InInventory)
+    : Inventory(InInventory)
+{
+    if (Inventory.IsValid())
+    {
+        Inventory->BeginTransaction();
+    }
+}
+
+FScopedInventoryTransaction::~FScopedInventoryTransaction()
+{
+    if (Inventory.IsValid())
+    {
+        Inventory->CommitTransaction();
+    }
+}
+
+void UInventoryComponent::HandleReplicatedSlotChanged(const FReplicatedInventorySlot& Entry)
+{
+    if (Entry.SlotIndex < 0 || Entry.SlotIndex >= MaxSlots) return;
+    if (Slots.Num() < MaxSlots) Slots.SetNum(MaxSlots);
+
+    // 같은 아이템이면 기존 객체를 재사용하고 수량만 갱신
+    UInventoryItem* Existing = Slots[Entry.SlotIndex];
+    if (Existing && Existing->ItemId == Entry.ItemId)
+    {
+        Existing->Quantity = Entry.Quantity;
+        Existing->EnhancementLevel = Entry.EnhancementLevel;
+    }
+    else
+    {
+        UInventoryItem* NewItem = NewObject<UInventoryItem>(this);
+        NewItem->Init(Entry.ItemId, Entry.Quantity, ItemDataTable);
+        NewItem->EnhancementLevel = Entry.EnhancementLevel;
+        Slots[Entry.SlotIndex] = NewItem;
+    }
+
+    // 수신 배치(트랜잭션) 안이면 PostReplicatedReceive 에서 한 번에 알림
+    BroadcastSlot(Entry.SlotIndex);
+}
+
+void UInventoryComponent::HandleReplicatedSlotRemoved(const FReplicatedInventorySlot& Entry)
+{
+    if (!Slots.IsValidIndex(Entry.SlotIndex)) return;
+
+    Slots[Entry.SlotIndex] = nullptr;
+    BroadcastSlot(Entry.SlotIndex);
 }
 
 void UInventoryComponent::DumpInventoryOnScreen() const
@@ -352,6 +583,7 @@ TArray<FInventorySaveData> UInventoryComponent::GetItemsForSave() const
             FInventorySaveData Data;
             Data.ItemId = It->ItemId;
             Data.Quantity = It->Quantity;
+            Data.EnhancementLevel = It->EnhancementLevel;
             OutData.Add(Data);
         }
     }
@@ -360,6 +592,9 @@ TArray<FInventorySaveData> UInventoryComponent::GetItemsForSave() const
 
 void UInventoryComponent::RestoreItemsFromSave(const TArray<FInventorySaveData>& InData)
 {
+    // 클리어 + 복구 전체를 한 번의 갱신으로 묶음
+    FScopedInventoryTransaction Transaction(this);
+
     // 1. 기존 아이템 클리어
     for (int32 i = 0; i < Slots.Num(); ++i)
     {
@@ -371,8 +606,16 @@ void UInventoryComponent::RestoreItemsFromSave(const TArray<FInventorySaveData>&
     for (const FInventorySaveData& Data : InData)
     {
         // AddItem 로직 재사용 (빈 슬롯 찾아 추가)
-        int32 Dummy;
-        AddItem(Data.ItemId, Data.Quantity, Dummy);
+        int32 LastSlot = INDEX_NONE;
+        if (AddItem(Data.ItemId, Data.Quantity, LastSlot) && Data.EnhancementLevel > 0)
+        {
+            // 강화 수치는 인스턴스 데이터이므로 방금 채운 슬롯에 복원
+            if (UInventoryItem* Restored = GetAt(LastSlot))
+            {
+                Restored->EnhancementLevel = Data.EnhancementLevel;
+                BroadcastSlot(LastSlot); // 복제 항목에도 강화 수치 반영
+            }
+        }
     }
 }
 void UInventoryComponent::ServerUseConsumable_Implementation(int32 SlotIndex)
@@ -380,10 +623,10 @@ void UInventoryComponent::ServerUseConsumable_Implementation(int32 SlotIndex)
     if (!IsValidIndex(SlotIndex) || !Slots[SlotIndex]) return;
 
     UInventoryItem* It = Slots[SlotIndex];
-    if (It->CachedRow.ItemType != EItemType::Consumable) return;
+    if (It->GetRow().ItemType != EItemType::Consumable) return;
 
     // 쿨다운 체크
-    const FName GroupId = It->CachedRow.Consumable.CooldownGroupId;
+    const FName GroupId = It->GetRow().Consumable.CooldownGroupId;
     if (!GroupId.IsNone() && IsCooldownActive(GroupId))
     {
         return; // 실패
@@ -407,12 +650,12 @@ void UInventoryComponent::ServerUseConsumable_Implementation(int32 SlotIndex)
     // 쿨다운 시작 & 동기화 (쿨다운은 ReplicatedSlots에 없으므로 별도 RPC나 리플리케이션 필요)
     // 여기서는 간단히 로컬(서버) 적용만 하고, Client는 Prediction으로 UI 타이머 돌림
     // (완벽한 동기화를 위해선 쿨다운 정보를 리플리케이션 해야 함. CooldownEndTimeByGroup를 Replicated로?)
-    if (!GroupId.IsNone() && It->CachedRow.Consumable.CooldownTime > 0.f)
+    if (!GroupId.IsNone() && It->GetRow().Consumable.CooldownTime > 0.f)
     {
         // 서버도 쿨다운 관리 (보안/검증용)
-        StartCooldown(GroupId, It->CachedRow.Consumable.CooldownTime);
+        StartCooldown(GroupId, It->GetRow().Consumable.CooldownTime);
         // 클라이언트에게 알림 (UI 표시용)
-        ClientPlayCooldown(GroupId, It->CachedRow.Consumable.CooldownTime);
+        ClientPlayCooldown(GroupId, It->GetRow().Consumable.CooldownTime);
     }
 }
 
@@ -456,6 +699,8 @@ void UInventoryComponent::AddMultipleItems(const TArray<FName>& ItemIds, int32 Q
 {
     if (ItemIds.Num() == 0 || QuantityPerItem <= 0) return;
 
+    FScopedInventoryTransaction Transaction(this);
+
     for (const FName& ItemId : ItemIds)
     {
         int32 DummyIndex;
@@ -468,6 +713,9 @@ void UInventoryComponent::SortInventory()
     // 정렬과 압축은 서버 권한(Authority) 하에서만 안전하게 실행하고 리플리케이션 처리해야 합니다.
     if (!GetOwner() || !GetOwner()->HasAuthority()) return;
 
+    // 정렬 중 변경은 모아서 Commit 시 한 번만 복제/UI 갱신
+    FScopedInventoryTransaction Transaction(this);
+
     // ── 1단계: 스택 합치기 (Consolidate Stacks) ──────────────────────────
     // 동일한 아이템이 쪼개져 있는 경우, 앞에서부터 꽉꽉 채워 합칩니다.
     for (int32 i = 0; i < Slots.Num(); ++i)
@@ -513,13 +761,13 @@ void UInventoryComponent::SortInventory()
     // ── 3단계: 정교한 기준에 맞추어 정렬 (Sort) ─────────────────────────
     ValidItems.Sort([](const UInventoryItem& A, const UInventoryItem& B) {
         // 1순위: 아이템 타입 오름차순 (Equipment -> Consumable -> Material -> Quest ...)
-        if (A.CachedRow.ItemType != B.CachedRow.ItemType)
+        if (A.GetRow().ItemType != B.GetRow().ItemType)
         {
-            return static_cast<uint8>(A.CachedRow.ItemType) < static_cast<uint8>(B.CachedRow.ItemType);
+            return static_cast<uint8>(A.GetRow().ItemType) < static_cast<uint8>(B.GetRow().ItemType);
         }
 
         // [New] 1-2순위: 대분류가 '장비(Equipment)'로 동일한 경우, 세부 장착 부위별 우선순위 비교 (무기 최우선!)
-        if (A.CachedRow.ItemType == EItemType::Equipment)
+        if (A.GetRow().ItemType == EItemType::Equipment)
         {
             auto GetEquipSlotPriority = [](EEquipmentSlot Slot) -> int32 {
                 switch (Slot)
@@ -537,8 +785,8 @@ void UInventoryComponent::SortInventory()
                 }
             };
 
-            int32 PriorityA = GetEquipSlotPriority(A.CachedRow.EquipSlot);
-            int32 PriorityB = GetEquipSlotPriority(B.CachedRow.EquipSlot);
+            int32 PriorityA = GetEquipSlotPriority(A.GetRow().EquipSlot);
+            int32 PriorityB = GetEquipSlotPriority(B.GetRow().EquipSlot);
 
             if (PriorityA != PriorityB)
             {
@@ -547,9 +795,9 @@ void UInventoryComponent::SortInventory()
         }
 
         // 2순위: 등급 내림차순 (전설/신화 등이 먼저 오도록)
-        if (A.CachedRow.Rarity != B.CachedRow.Rarity)
+        if (A.GetRow().Rarity != B.GetRow().Rarity)
         {
-            return static_cast<uint8>(A.CachedRow.Rarity) > static_cast<uint8>(B.CachedRow.Rarity);
+            return static_cast<uint8>(A.GetRow().Rarity) > static_cast<uint8>(B.GetRow().Rarity);
         }
 
         // 3순위: 이름(ItemId) 사전 오름차순
@@ -576,15 +824,11 @@ void UInventoryComponent::SortInventory()
         }
     }
 
-    // 서버의 리플리케이션 데이터(ReplicatedSlots) 전체 재구성 및 BroadcastSlot
-    ReplicatedSlots.Empty();
+    // 슬롯별 BroadcastSlot (Commit 시 바뀐 슬롯만 델타 복제 + UI 전체 리프레시 1회)
     for (int32 i = 0; i < Slots.Num(); ++i)
     {
         BroadcastSlot(i);
     }
-
-    // UI에 전체 리프레시 델리게이트 송출
-    OnInventoryRefreshed.Broadcast();
 }
 
 void UInventoryComponent::ClearAllNewItemFlags()
@@ -614,8 +858,8 @@ void UInventoryComponent::ServerBuyItem_Implementation(FName ItemId, int32 Quant
 {
     if (!ItemDataTable) return;
 
-    const FItemRow* ItemRow = ItemDataTable->FindRow<FItemRow>(ItemId, TEXT("ShopBuyCheck"));
-    if (!ItemRow) return;
+    const FItemDefinitionHandle ItemRow = UItemDefinitionSubsystem::Resolve(this, ItemId, ItemDataTable);
+    if (!ItemRow.IsValid()) return;
 
     const int32 TotalCost = ItemRow->BuyPrice * Quantity;
     if (Gold < TotalCost) return;
@@ -641,7 +885,7 @@ void UInventoryComponent::ServerSellItem_Implementation(int32 SlotIndex, int32 Q
 
     if (TargetItem->Quantity < Quantity) return;
 
-    const int32 TotalReward = TargetItem->CachedRow.SellPrice * Quantity;
+    const int32 TotalReward = TargetItem->GetRow().SellPrice * Quantity;
 
     if (RemoveAt(SlotIndex, Quantity))
     {
@@ -2,6 +2,8 @@
 #include "Inventory/ItemEnums.h"
 #include "Data/ItemStructs.h"
 #include "Engine/DataTable.h"
+#include "System/ItemDefinitionSubsystem.h"
+#include "System/IconCacheSubsystem.h"
 
 void UInventoryItem::Init(FName InItemId, int32 InQty, UDataTable* DT)
 {
@@ -10,37 +12,40 @@ void UInventoryItem::Init(FName InItemId, int32 InQty, UDataTable* DT)
     InstanceId = FGuid::NewGuid();
     ItemDataTable = DT;
 
-    if (ItemDataTable && !ItemId.IsNone())
+    // 행 복사 대신 게임 인스턴스 레지스트리의 공유 정의를 참조
+    Definition = UItemDefinitionSubsystem::Resolve(this, ItemId, ItemDataTable);
+    if (Definition.IsValid())
     {
-        if (const FItemRow* Row = ItemDataTable->FindRow<FItemRow>(ItemId, TEXT("UInventoryItem::Init")))
-        {
-            CachedRow = *Row;
-            Quantity = FMath::Clamp(Quantity, 1, FMath::Max(1, CachedRow.MaxStack));
-        }
+        Quantity = FMath::Clamp(Quantity, 1, FMath::Max(1, GetRow().MaxStack));
     }
 }
 
+UTexture2D* UInventoryItem::RequestIcon(FOnIconLoaded OnLoaded) const
+{
+    return UIconCacheSubsystem::Resolve(this, GetRow().Icon, MoveTemp(OnLoaded));
+}
+
 bool UInventoryItem::IsEquipment() const
 {
-     return CachedRow.ItemType == EItemType::Equipment;
+     return GetRow().ItemType == EItemType::Equipment;
 
 }
 EEquipmentSlot UInventoryItem::GetEquipSlot() const
 {
     // 장비가 아니면 슬롯 없음
-    if (CachedRow.ItemType != EItemType::Equipment)
+    if (GetRow().ItemType != EItemType::Equipment)
     {
         return EEquipmentSlot::None;
     }
 
     // 데이터 행에 명시된 슬롯이 최우선
-    if (CachedRow.EquipSlot != EEquipmentSlot::None)
+    if (GetRow().EquipSlot != EEquipmentSlot::None)
     {
-        return CachedRow.EquipSlot;
+        return GetRow().EquipSlot;
     }
 
     // (폴백) 무기 타입이 지정되어 있으면 메인 무기로 취급
-    if (CachedRow.WeaponType != EWeaponType::None)
+    if (GetRow().WeaponType != EWeaponType::None)
     {
         return EEquipmentSlot::WeaponMain;
     }
@@ -53,6 +58,6 @@ EEquipmentSlot UInventoryItem::GetEquipSlot() const
 bool UInventoryItem::IsTwoHandedWeapon() const
 {
     // 장비 + 무기타입=TwoHanded 일 때만 true
-    return (CachedRow.ItemType == EItemType::Equipment) &&
-        (CachedRow.WeaponType == EWeaponType::TwoHanded);
+    return (GetRow().ItemType == EItemType::Equipment) &&
+        (GetRow().WeaponType == EWeaponType::TwoHanded);
 }
\ No newline at end of file
@@ -104,7 +104,7 @@ bool UItemUseLibrary::UseOrEquip(AActor* InstigatorActor, UInventoryComponent* I
         return false;
     }
 
-    const FItemRow& Row = Item->CachedRow;
+    const FItemRow& Row = Item->GetRow();
 
     // 1) 소모품
     if (Row.ItemType == EItemType::Consumable)
@@ -163,7 +163,7 @@ bool UItemUseLibrary::UseConsumable(AActor* InstigatorActor, UInventoryComponent
     UInventoryItem* Item = Inventory->GetAt(SlotIndex);
     if (!Item) return false;
 
-    const FItemRow& Row = Item->CachedRow;
+    const FItemRow& Row = Item->GetRow();
     if (Row.ItemType != EItemType::Consumable) return false;
 
     // [Multiplayer Support]
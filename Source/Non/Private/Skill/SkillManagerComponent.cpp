@@ -4,6 +4,7 @@
 #include "GameplayEffect.h"
 #include "Net/UnrealNetwork.h"
 #include "Ability/NonAttributeSet.h"
+#include "Ability/NonGameplayTags.h"
 
 void USkillManagerComponent::BeginPlay()
 {
@@ -373,11 +374,10 @@ bool USkillManagerComponent::DoActivateSkillLogic(FName SkillId)
             GetWorld()->GetTimerManager().ClearTimer(*ExistingHandle);
         }
 
-        FGameplayTag ReadyTag = FGameplayTag::RequestGameplayTag(TEXT("State.Combo.Ready"), false);
+        FGameplayTag ReadyTag = NonGameplayTags::State_Combo_Ready;
         ASC->AddLooseGameplayTag(ReadyTag);
 
-        FString TagString = FString::Printf(TEXT("State.Combo.Ready.%s"), *SkillId.ToString());
-        FGameplayTag ComboTag = FGameplayTag::RequestGameplayTag(*TagString, false);
+        FGameplayTag ComboTag = NonGameplayTags::GetComboReadyTag(SkillId);
         if (ComboTag.IsValid())
         {
             ASC->AddLooseGameplayTag(ComboTag);
@@ -553,10 +553,9 @@ void USkillManagerComponent::ClearComboReadyTag(FName BaseSkillId)
 {
     if (!ASC) return;
 
-    FString TagString = FString::Printf(TEXT("State.Combo.Ready.%s"), *BaseSkillId.ToString());
-    FGameplayTag ComboTag = FGameplayTag::RequestGameplayTag(*TagString, false);
+    FGameplayTag ComboTag = NonGameplayTags::GetComboReadyTag(BaseSkillId);
     
-    FGameplayTag ReadyTag = FGameplayTag::RequestGameplayTag(TEXT("State.Combo.Ready"), false);
+    FGameplayTag ReadyTag = NonGameplayTags::State_Combo_Ready;
 
     if (ComboTag.IsValid())
     {
@@ -615,8 +614,7 @@ void USkillManagerComponent::ForceClearAllCombos()
     {
         GetWorld()->GetTimerManager().ClearTimer(Elem.Value);
         
-        FString TagString = FString::Printf(TEXT("State.Combo.Ready.%s"), *Elem.Key.ToString());
-        FGameplayTag ComboTag = FGameplayTag::RequestGameplayTag(*TagString, false);
+        FGameplayTag ComboTag = NonGameplayTags::GetComboReadyTag(Elem.Key);
         if (ComboTag.IsValid())
         {
             ASC->RemoveLooseGameplayTag(ComboTag);
@@ -636,15 +634,14 @@ void USkillManagerComponent::ForceClearAllCombos()
     ComboWindowTimerHandles.Empty();
     ActiveComboChains.Empty(); // [New] 전체 콤보 맵을 완벽하게 초기화합니다.
 
-    FGameplayTag ReadyTag = FGameplayTag::RequestGameplayTag(TEXT("State.Combo.Ready"), false);
+    FGameplayTag ReadyTag = NonGameplayTags::State_Combo_Ready;
     ASC->RemoveLooseGameplayTag(ReadyTag);
 }
 
 void USkillManagerComponent::ClientSyncComboState_Implementation(FName BaseSkillId, FName NextComboSkillId, float Duration, float CooldownRemaining, float CooldownTotal)
 {
-    FGameplayTag ReadyTag = FGameplayTag::RequestGameplayTag(TEXT("State.Combo.Ready"), false);
-    FString TagString = FString::Printf(TEXT("State.Combo.Ready.%s"), *BaseSkillId.ToString());
-    FGameplayTag ComboTag = FGameplayTag::RequestGameplayTag(*TagString, false);
+    FGameplayTag ReadyTag = NonGameplayTags::State_Combo_Ready;
+    FGameplayTag ComboTag = NonGameplayTags::GetComboReadyTag(BaseSkillId);
 
     // [New] 다음 연계 스킬을 아직 학습하지 않았거나 레벨이 0이라면 연계 대기 상태를 적용하지 않고 즉시 차단/만료시킵니다!
     if (NextComboSkillId.IsNone() || Duration <= 0.f || GetSkillLevel(NextComboSkillId) <= 0)
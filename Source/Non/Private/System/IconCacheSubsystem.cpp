@@ -0,0 +1,196 @@
+#include "System/IconCacheSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "Character/NonCharacterBase.h"
+#include "Inventory/InventoryComponent.h"
+#include "Inventory/InventoryItem.h"
+#include "UI/QuickSlot/QuickSlotManager.h"
+#include "Skill/SkillManagerComponent.h"
+#include "Skill/SkillTypes.h"
+
+void UIconCacheSubsystem::Deinitialize()
+{
+    for (TPair<FSoftObjectPath, FIconEntry>& Pair : Entries)
+    {
+        if (Pair.Value.Handle.IsValid())
+        {
+            Pair.Value.Handle->CancelHandle();
+        }
+    }
+    Entries.Reset();
+    Super::Deinitialize();
+}
+
+UIconCacheSubsystem* UIconCacheSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+    return GI ? GI->GetSubsystem<UIconCacheSubsystem>() : nullptr;
+}
+
+UTexture2D* UIconCacheSubsystem::Resolve(const UObject* WorldContextObject, const TSoftObjectPtr<UTexture2D>& Icon,
+    FOnIconLoaded OnLoaded)
+{
+    if (Icon.IsNull()) return nullptr;
+
+    if (UIconCacheSubsystem* Cache = Get(WorldContextObject))
+    {
+        return Cache->RequestIcon(Icon, MoveTemp(OnLoaded));
+    }
+    return Icon.LoadSynchronous();
+}
+
+UIconCacheSubsystem::FIconEntry& UIconCacheSubsystem::FindOrRequest(const FSoftObjectPath& Path, bool bLowPriority)
+{
+    FIconEntry* Entry = Entries.Find(Path);
+    if (!Entry)
+    {
+        EvictIfNeeded();
+        Entry = &Entries.Add(Path);
+
+        // 이미 메모리에 있어도 핸들로 붙잡아 둬야 LRU 해제 전까지 GC 되지 않음
+        const TAsyncLoadPriority Priority = bLowPriority
+            ? FStreamableManager::AsyncLoadLowPriority
+            : FStreamableManager::DefaultAsyncLoadPriority;
+
+        Entry->Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            Path,
+            FStreamableDelegate::CreateUObject(this, &UIconCacheSubsystem::OnIconStreamed, Path),
+            Priority);
+
+        // RequestAsyncLoad 가 이미 로드된 에셋이면 델리게이트를 즉시 호출할 수 있으므로 다시 찾음
+        Entry = &Entries.FindChecked(Path);
+    }
+
+    Entry->LastUsed = ++UseClock;
+    return *Entry;
+}
+
+UTexture2D* UIconCacheSubsystem::RequestIcon(const TSoftObjectPtr<UTexture2D>& Icon, FOnIconLoaded OnLoaded)
+{
+    if (Icon.IsNull()) return nullptr;
+
+    const FSoftObjectPath Path = Icon.ToSoftObjectPath();
+    FIconEntry& Entry = FindOrRequest(Path, false);
+
+    if (UTexture2D* Loaded = Icon.Get())
+    {
+        return Loaded;
+    }
+
+    // 로드 실패한 경로는 다시 기다리지 않음
+    if (Entry.Handle.IsValid() && Entry.Handle->HasLoadCompleted())
+    {
+        return nullptr;
+    }
+
+    // 로드 중: 완료 시 콜백 (호출자는 그 전까지 플레이스홀더 표시)
+    if (OnLoaded.IsBound())
+    {
+        Entry.Waiters.Add(MoveTemp(OnLoaded));
+    }
+    return nullptr;
+}
+
+void UIconCacheSubsystem::Prefetch(TConstArrayView<TSoftObjectPtr<UTexture2D>> Icons)
+{
+    for (const TSoftObjectPtr<UTexture2D>& Icon : Icons)
+    {
+        if (!Icon.IsNull())
+        {
+            FindOrRequest(Icon.ToSoftObjectPath(), true);
+        }
+    }
+}
+
+void UIconCacheSubsystem::PrefetchForCharacter(const AActor* Character)
+{
+    if (!Character || IsRunningDedicatedServer()) return;
+
+    TArray<TSoftObjectPtr<UTexture2D>> Icons;
+
+    const ANonCharacterBase* NonChar = Cast<ANonCharacterBase>(Character);
+
+    // 가방
+    if (const UInventoryComponent* Inv = NonChar ? NonChar->GetInventoryComponent() : Character->FindComponentByClass<UInventoryComponent>())
+    {
+        const int32 SlotCount = Inv->GetSlotCount();
+        Icons.Reserve(SlotCount);
+        for (int32 i = 0; i < SlotCount; ++i)
+        {
+            if (const UInventoryItem* Item = Inv->GetItemAt(i))
+            {
+                Icons.Add(Item->GetRow().Icon);
+            }
+        }
+    }
+
+    // 퀵슬롯 (아이템 + 스킬)
+    if (const UQuickSlotManager* QS = NonChar ? NonChar->GetQuickSlotManager() : Character->FindComponentByClass<UQuickSlotManager>())
+    {
+        const USkillManagerComponent* SkillMgr = Character->FindComponentByClass<USkillManagerComponent>();
+        const USkillDataAsset* SkillData = SkillMgr ? SkillMgr->GetDataAsset() : nullptr;
+
+        for (int32 i = 0; i < QS->NumSlots; ++i)
+        {
+            if (const UInventoryItem* Item = QS->ResolveItem(i))
+            {
+                Icons.Add(Item->GetRow().Icon);
+            }
+
+            const FName SkillId = QS->GetSkillInSlot(i);
+            if (SkillData && !SkillId.IsNone())
+            {
+                if (const FSkillRow* Row = SkillData->Skills.Find(SkillId))
+                {
+                    Icons.Add(Row->Icon);
+                }
+            }
+        }
+    }
+
+    Prefetch(Icons);
+}
+
+void UIconCacheSubsystem::OnIconStreamed(FSoftObjectPath Path)
+{
+    FIconEntry* Entry = Entries.Find(Path);
+    if (!Entry || Entry->Waiters.Num() == 0) return;
+
+    UTexture2D* Texture = Cast<UTexture2D>(Path.ResolveObject());
+
+    // 콜백 안에서 다른 아이콘을 요청하면 Entries 가 재배치될 수 있으므로 먼저 꺼내 둠
+    TArray<FOnIconLoaded> Waiters = MoveTemp(Entry->Waiters);
+    for (FOnIconLoaded& Waiter : Waiters)
+    {
+        Waiter.ExecuteIfBound(Texture);
+    }
+}
+
+void UIconCacheSubsystem::EvictIfNeeded()
+{
+    while (Entries.Num() >= FMath::Max(1, MaxCachedIcons))
+    {
+        // 대기 중인 위젯이 없는 것 중 가장 오래 안 쓴 항목
+        const FSoftObjectPath* Oldest = nullptr;
+        uint64 OldestUse = MAX_uint64;
+        for (const TPair<FSoftObjectPath, FIconEntry>& Pair : Entries)
+        {
+            if (Pair.Value.Waiters.Num() == 0 && Pair.Value.LastUsed < OldestUse)
+            {
+                OldestUse = Pair.Value.LastUsed;
+                Oldest = &Pair.Key;
+            }
+        }
+        if (!Oldest) return;
+
+        const FSoftObjectPath Victim = *Oldest;
+        if (TSharedPtr<FStreamableHandle> Handle = Entries.FindAndRemoveChecked(Victim).Handle)
+        {
+            Handle->ReleaseHandle();
+        }
+    }
+}
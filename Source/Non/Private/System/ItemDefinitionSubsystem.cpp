@@ -0,0 +1,120 @@
+#include "System/ItemDefinitionSubsystem.h"
+#include "Engine/DataTable.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+const FItemRow& FItemDefinitionHandle::GetEmptyRow()
+{
+    static const FItemRow EmptyRow;
+    return EmptyRow;
+}
+
+void UItemDefinitionSubsystem::Deinitialize()
+{
+    for (UDataTable* Table : RegisteredTables)
+    {
+        if (Table)
+        {
+            Table->OnDataTableChanged().RemoveAll(this);
+        }
+    }
+    Definitions.Reset();
+    RegisteredTables.Reset();
+    Super::Deinitialize();
+}
+
+UItemDefinitionSubsystem* UItemDefinitionSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+    return GI ? GI->GetSubsystem<UItemDefinitionSubsystem>() : nullptr;
+}
+
+void UItemDefinitionSubsystem::RegisterTable(UDataTable* Table)
+{
+    if (!Table || RegisteredTables.Contains(Table)) return;
+
+    const UScriptStruct* RowStruct = Table->GetRowStruct();
+    if (!RowStruct || !RowStruct->IsChildOf(FItemRow::StaticStruct())) return;
+
+    RegisteredTables.Add(Table);
+    Table->OnDataTableChanged().AddUObject(this, &UItemDefinitionSubsystem::HandleTableChanged);
+
+    IndexTable(Table);
+}
+
+void UItemDefinitionSubsystem::IndexTable(const UDataTable* Table)
+{
+    const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+    Definitions.Reserve(Definitions.Num() + RowMap.Num());
+    for (const TPair<FName, uint8*>& Pair : RowMap)
+    {
+        const FItemRow* Row = reinterpret_cast<const FItemRow*>(Pair.Value);
+
+        // 먼저 등록된 테이블의 정의를 우선
+        if (TSharedRef<FItemDefinitionSlot>* Found = Definitions.Find(Pair.Key))
+        {
+            if (!(*Found)->Row)
+            {
+                (*Found)->Row = Row;
+            }
+        }
+        else
+        {
+            TSharedRef<FItemDefinitionSlot> Slot = MakeShared<FItemDefinitionSlot>();
+            Slot->Row = Row;
+            Definitions.Add(Pair.Key, Slot);
+        }
+    }
+}
+
+void UItemDefinitionSubsystem::HandleTableChanged()
+{
+    // 이전 행 메모리는 이미 해제됐으므로 모든 슬롯을 비우고 다시 채움 (사라진 행은 빈 정의가 됨)
+    for (TPair<FName, TSharedRef<FItemDefinitionSlot>>& Pair : Definitions)
+    {
+        Pair.Value->Row = nullptr;
+    }
+
+    for (const UDataTable* Table : RegisteredTables)
+    {
+        if (Table)
+        {
+            IndexTable(Table);
+        }
+    }
+}
+
+FItemDefinitionHandle UItemDefinitionSubsystem::FindDefinition(FName ItemId, UDataTable* Table)
+{
+    if (ItemId.IsNone()) return FItemDefinitionHandle();
+
+    RegisterTable(Table);
+
+    if (const TSharedRef<FItemDefinitionSlot>* Found = Definitions.Find(ItemId))
+    {
+        return FItemDefinitionHandle(*Found);
+    }
+    return FItemDefinitionHandle();
+}
+
+FItemDefinitionHandle UItemDefinitionSubsystem::Resolve(const UObject* WorldContextObject, FName ItemId, UDataTable* Table)
+{
+    if (UItemDefinitionSubsystem* Registry = Get(WorldContextObject))
+    {
+        return Registry->FindDefinition(ItemId, Table);
+    }
+
+    // 게임 인스턴스가 없으면 무효화해 줄 레지스트리도 없으므로 행 사본을 들고 있음
+    if (Table && !ItemId.IsNone())
+    {
+        if (const FItemRow* Row = Table->FindRow<FItemRow>(ItemId, TEXT("UItemDefinitionSubsystem::Resolve"), false))
+        {
+            TSharedRef<FItemDefinitionSlot> Slot = MakeShared<FItemDefinitionSlot>();
+            Slot->Detached = MakeUnique<FItemRow>(*Row);
+            Slot->Row = Slot->Detached.Get();
+            return FItemDefinitionHandle(Slot);
+        }
+    }
+    return FItemDefinitionHandle();
+}
@@ -0,0 +1,179 @@
+#include "System/LootSubsystem.h"
+#include "Data/EnemyDataAsset.h"
+#include "Inventory/InventoryComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+uint32 FLootAliasChunk::Sample(float U) const
+{
+    const int32 NumOutcomes = Prob.Num();
+    const float Scaled = U * NumOutcomes;
+    const int32 Index = FMath::Min(static_cast<int32>(Scaled), NumOutcomes - 1);
+    return (Scaled - Index) < Prob[Index] ? static_cast<uint32>(Index) : static_cast<uint32>(Alias[Index]);
+}
+
+void FCompiledLootTable::Build(const UEnemyDataAsset& Data)
+{
+    Entries.Reset();
+    Chunks.Reset();
+    AlwaysCount = 0;
+
+    // 확률 1 인 항목은 굴릴 필요 없이 앞쪽에, 확률 0 인 항목은 제외
+    TArray<float> Chances;
+    for (int32 Pass = 0; Pass < 2; ++Pass)
+    {
+        for (const FEnemyDropItem& Drop : Data.DropList)
+        {
+            if (Drop.ItemId.IsNone() || Drop.DropChance <= 0.f || FMath::Max(Drop.MinCount, Drop.MaxCount) <= 0) continue;
+
+            const bool bAlways = Drop.DropChance >= 1.f;
+            if (bAlways != (Pass == 0)) continue;
+
+            FEntry& Entry = Entries.AddDefaulted_GetRef();
+            Entry.ItemId = Drop.ItemId;
+            Entry.MinCount = FMath::Max(1, FMath::Min(Drop.MinCount, Drop.MaxCount));
+            Entry.MaxCount = FMath::Max(Entry.MinCount, Drop.MaxCount);
+
+            if (bAlways)
+            {
+                ++AlwaysCount;
+            }
+            else
+            {
+                Chances.Add(Drop.DropChance);
+            }
+        }
+    }
+
+    // 나머지는 MaxEntries 개씩 묶어 조합별 확률로 앨리어스 테이블 구성 (Vose)
+    for (int32 First = 0; First < Chances.Num(); First += FLootAliasChunk::MaxEntries)
+    {
+        FLootAliasChunk& Chunk = Chunks.AddDefaulted_GetRef();
+        Chunk.FirstEntry = AlwaysCount + First;
+        Chunk.NumEntries = FMath::Min(FLootAliasChunk::MaxEntries, Chances.Num() - First);
+
+        const int32 NumOutcomes = 1 << Chunk.NumEntries;
+        TArray<float> Scaled;
+        Scaled.SetNumUninitialized(NumOutcomes);
+        for (int32 Mask = 0; Mask < NumOutcomes; ++Mask)
+        {
+            float P = 1.f;
+            for (int32 Bit = 0; Bit < Chunk.NumEntries; ++Bit)
+            {
+                const float Chance = Chances[First + Bit];
+                P *= (Mask & (1 << Bit)) ? Chance : (1.f - Chance);
+            }
+            Scaled[Mask] = P * NumOutcomes;
+        }
+
+        Chunk.Prob.SetNumZeroed(NumOutcomes);
+        Chunk.Alias.SetNumZeroed(NumOutcomes);
+
+        TArray<int32> Small;
+        TArray<int32> Large;
+        for (int32 i = 0; i < NumOutcomes; ++i)
+        {
+            (Scaled[i] < 1.f ? Small : Large).Add(i);
+        }
+
+        while (Small.Num() > 0 && Large.Num() > 0)
+        {
+            const int32 Less = Small.Pop(EAllowShrinking::No);
+            const int32 More = Large.Pop(EAllowShrinking::No);
+
+            Chunk.Prob[Less] = Scaled[Less];
+            Chunk.Alias[Less] = static_cast<uint8>(More);
+
+            Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.f;
+            (Scaled[More] < 1.f ? Small : Large).Add(More);
+        }
+
+        // 부동소수 오차로 남은 항목은 자기 자신 확정
+        for (const int32 i : Large) { Chunk.Prob[i] = 1.f; }
+        for (const int32 i : Small) { Chunk.Prob[i] = 1.f; }
+    }
+}
+
+void FCompiledLootTable::Roll(TArray<FLootDrop>& OutDrops) const
+{
+    auto AddDrop = [&OutDrops](const FEntry& Entry)
+    {
+        FLootDrop& Drop = OutDrops.AddDefaulted_GetRef();
+        Drop.ItemId = Entry.ItemId;
+        Drop.Count = FMath::RandRange(Entry.MinCount, Entry.MaxCount);
+    };
+
+    for (int32 i = 0; i < AlwaysCount; ++i)
+    {
+        AddDrop(Entries[i]);
+    }
+
+    for (const FLootAliasChunk& Chunk : Chunks)
+    {
+        uint32 Mask = Chunk.Sample(FMath::FRand());
+        while (Mask != 0)
+        {
+            const int32 Bit = FMath::CountTrailingZeros(Mask);
+            Mask &= Mask - 1;
+            AddDrop(Entries[Chunk.FirstEntry + Bit]);
+        }
+    }
+}
+
+void ULootSubsystem::Deinitialize()
+{
+    Tables.Reset();
+    Super::Deinitialize();
+}
+
+ULootSubsystem* ULootSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+    return GI ? GI->GetSubsystem<ULootSubsystem>() : nullptr;
+}
+
+const FCompiledLootTable* ULootSubsystem::Precompile(const UEnemyDataAsset* Data)
+{
+    if (!Data) return nullptr;
+
+    if (const FCompiledLootTable* Found = Tables.Find(Data))
+    {
+        return Found;
+    }
+
+    FCompiledLootTable& Table = Tables.Add(Data);
+    Table.Build(*Data);
+    return &Table;
+}
+
+void ULootSubsystem::RollLoot(const UEnemyDataAsset* Data, TArray<FLootDrop>& OutDrops)
+{
+    if (const FCompiledLootTable* Table = Precompile(Data))
+    {
+        Table->Roll(OutDrops);
+    }
+}
+
+int32 ULootSubsystem::GrantLoot(const UEnemyDataAsset* Data, UInventoryComponent* Inventory)
+{
+    if (!Inventory || !Inventory->GetOwner() || !Inventory->GetOwner()->HasAuthority()) return 0;
+
+    TArray<FLootDrop> Rolled;
+    RollLoot(Data, Rolled);
+    if (Rolled.Num() == 0) return 0;
+
+    // 슬롯 변경은 모아서 복제/UI 갱신 한 번
+    FScopedInventoryTransaction Transaction(Inventory);
+
+    int32 Granted = 0;
+    for (const FLootDrop& Drop : Rolled)
+    {
+        int32 LastSlot = INDEX_NONE;
+        if (Inventory->AddItem(Drop.ItemId, Drop.Count, LastSlot))
+        {
+            ++Granted;
+        }
+    }
+    return Granted;
+}
@@ -0,0 +1,296 @@
+#include "System/NonSaveGame.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    // 파일 선두 식별자 ("NSAV"). 기존 태그 프로퍼티 스트림과 구분하는 용도
+    constexpr uint32 NonSaveMagic = 0x5641534E;
+
+    void WritePacked(FArchive& Ar, int32 Value)
+    {
+        uint32 Packed = static_cast<uint32>(FMath::Max(0, Value));
+        Ar.SerializeIntPacked(Packed);
+    }
+
+    int32 ReadPacked(FArchive& Ar)
+    {
+        uint32 Packed = 0;
+        Ar.SerializeIntPacked(Packed);
+        return static_cast<int32>(Packed);
+    }
+
+    // FName 은 인덱스가 아닌 문자열로 기록 (실행마다 네임 테이블이 달라짐)
+    void WriteName(FArchive& Ar, FName Name)
+    {
+        FString Str = Name.IsNone() ? FString() : Name.ToString();
+        Ar << Str;
+    }
+
+    FName ReadName(FArchive& Ar)
+    {
+        FString Str;
+        Ar << Str;
+        return Str.IsEmpty() ? NAME_None : FName(*Str);
+    }
+}
+
+void UNonSaveGame::Serialize(FArchive& Ar)
+{
+    // 참조 수집/메모리 집계 등 세이브 파일 외 경로는 기본 처리
+    if (Ar.IsObjectReferenceCollector() || Ar.IsCountingMemory() || HasAnyFlags(RF_ClassDefaultObject))
+    {
+        Super::Serialize(Ar);
+        return;
+    }
+
+    if (Ar.IsLoading())
+    {
+        bLoadFailed = false;
+
+        const int64 StartPos = Ar.Tell();
+        uint32 Magic = 0;
+        Ar << Magic;
+
+        // [Migration] 식별자가 없으면 구버전(태그 프로퍼티) 세이브
+        if (Magic != NonSaveMagic)
+        {
+            Ar.Seek(StartPos);
+            Super::Serialize(Ar);
+            SchemaVersion = static_cast<int32>(ENonSaveSchemaVersion::Legacy);
+            bLoadFailed = Ar.IsError();
+            return;
+        }
+
+        Ar << SchemaVersion;
+        if (SchemaVersion > static_cast<int32>(ENonSaveSchemaVersion::Latest))
+        {
+            // 더 최신 빌드에서 만든 세이브는 읽지 않음 (적용하면 기본값으로 덮어쓰게 됨)
+            bLoadFailed = true;
+            Ar.SetError();
+            return;
+        }
+    }
+    else
+    {
+        uint32 Magic = NonSaveMagic;
+        Ar << Magic;
+        SchemaVersion = static_cast<int32>(ENonSaveSchemaVersion::Latest);
+        Ar << SchemaVersion;
+    }
+
+    // ── 헤더: 항상 기록되는 작은 플레이어 정보 ──
+    Ar << PlayerName;
+
+    uint8 Job = static_cast<uint8>(JobClass);
+    Ar << Job;
+    JobClass = static_cast<EJobClass>(Job);
+
+    if (Ar.IsLoading())
+    {
+        Level = ReadPacked(Ar);
+        EXP = ReadPacked(Ar);
+    }
+    else
+    {
+        WritePacked(Ar, Level);
+        WritePacked(Ar, EXP);
+    }
+    Ar << CurrentHP;
+    Ar << CurrentMP;
+
+    // 트랜스폼은 위치/회전만 float 로 (캐릭터 스케일은 항상 1)
+    FVector3f Location(PlayerTransform.GetLocation());
+    FRotator3f Rotation(PlayerTransform.Rotator());
+    Ar << Location;
+    Ar << Rotation;
+    if (Ar.IsLoading())
+    {
+        PlayerTransform = FTransform(FRotator(Rotation), FVector(Location));
+    }
+
+    // ── 섹션: [Id][ByteCount][Bytes] ──
+    uint8 NumSections = static_cast<uint8>(ENonSaveSection::Num);
+    Ar << NumSections;
+
+    for (uint8 i = 0; i < NumSections && !Ar.IsError(); ++i)
+    {
+        uint8 SectionId = i;
+        Ar << SectionId;
+
+        TArray<uint8> LoadedBytes;
+        TArray<uint8>& Bytes = Ar.IsLoading() ? LoadedBytes : EncodedSections[SectionId];
+
+        // 변경되어 캐시가 비어 있는 섹션만 새로 인코딩
+        if (Ar.IsSaving() && Bytes.Num() == 0)
+        {
+            EncodeSection(static_cast<ENonSaveSection>(SectionId));
+        }
+        Ar << Bytes;
+
+        // 알 수 없는 섹션은 건너뜀 (하위 버전 호환)
+        // 로드 후 데이터가 수정될 수 있으므로 읽은 바이트는 캐시하지 않음
+        if (Ar.IsLoading() && SectionId < static_cast<uint8>(ENonSaveSection::Num))
+        {
+            if (!DecodeSection(static_cast<ENonSaveSection>(SectionId), LoadedBytes, SchemaVersion))
+            {
+                bLoadFailed = true;
+            }
+        }
+    }
+
+    if (Ar.IsLoading() && Ar.IsError())
+    {
+        bLoadFailed = true;
+    }
+}
+
+void UNonSaveGame::EncodeSection(ENonSaveSection Section)
+{
+    TArray<uint8>& Bytes = EncodedSections[static_cast<int32>(Section)];
+    Bytes.Reset();
+    FMemoryWriter W(Bytes);
+
+    switch (Section)
+    {
+    case ENonSaveSection::Items:
+        WritePacked(W, InventoryItems.Num());
+        for (const FInventorySaveData& D : InventoryItems)
+        {
+            WriteName(W, D.ItemId);
+            WritePacked(W, D.Quantity);
+            WritePacked(W, D.EnhancementLevel);
+        }
+        break;
+
+    case ENonSaveSection::Skills:
+        WritePacked(W, SkillPoints);
+        WritePacked(W, SkillLevels.Num());
+        for (const TPair<FName, int32>& Pair : SkillLevels)
+        {
+            WriteName(W, Pair.Key);
+            WritePacked(W, Pair.Value);
+        }
+        break;
+
+    case ENonSaveSection::Equipment:
+        WritePacked(W, EquippedItems.Num());
+        for (const FEquipmentSaveData& D : EquippedItems)
+        {
+            uint8 SlotByte = static_cast<uint8>(D.Slot);
+            W << SlotByte;
+            WriteName(W, D.ItemId);
+            WritePacked(W, D.Quantity);
+            WritePacked(W, D.EnhancementLevel);
+        }
+        break;
+
+    case ENonSaveSection::QuickSlots:
+        WritePacked(W, QuickSlots.Num());
+        for (const FQuickSlotSaveData& D : QuickSlots)
+        {
+            WritePacked(W, D.SlotIndex);
+            WriteName(W, D.ItemId);
+            WriteName(W, D.SkillId);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+bool UNonSaveGame::DecodeSection(ENonSaveSection Section, const TArray<uint8>& Bytes, int32 Version)
+{
+    FMemoryReader R(Bytes);
+
+    // Version 분기는 이후 스키마가 추가될 때 이곳에서 처리
+    switch (Section)
+    {
+    case ENonSaveSection::Items:
+    {
+        const int32 Num = ReadPacked(R);
+        InventoryItems.Reset(Num);
+        for (int32 i = 0; i < Num && !R.IsError(); ++i)
+        {
+            FInventorySaveData& D = InventoryItems.AddDefaulted_GetRef();
+            D.ItemId = ReadName(R);
+            D.Quantity = ReadPacked(R);
+            D.EnhancementLevel = ReadPacked(R);
+        }
+        break;
+    }
+    case ENonSaveSection::Skills:
+    {
+        SkillPoints = ReadPacked(R);
+        const int32 Num = ReadPacked(R);
+        SkillLevels.Reset();
+        SkillLevels.Reserve(Num);
+        for (int32 i = 0; i < Num && !R.IsError(); ++i)
+        {
+            const FName SkillId = ReadName(R);
+            SkillLevels.Add(SkillId, ReadPacked(R));
+        }
+        break;
+    }
+    case ENonSaveSection::Equipment:
+    {
+        const int32 Num = ReadPacked(R);
+        EquippedItems.Reset(Num);
+        for (int32 i = 0; i < Num && !R.IsError(); ++i)
+        {
+            FEquipmentSaveData& D = EquippedItems.AddDefaulted_GetRef();
+            uint8 SlotByte = 0;
+            R << SlotByte;
+            D.Slot = static_cast<EEquipmentSlot>(SlotByte);
+            D.ItemId = ReadName(R);
+            D.Quantity = ReadPacked(R);
+            D.EnhancementLevel = ReadPacked(R);
+        }
+        break;
+    }
+    case ENonSaveSection::QuickSlots:
+    {
+        const int32 Num = ReadPacked(R);
+        QuickSlots.Reset(Num);
+        for (int32 i = 0; i < Num && !R.IsError(); ++i)
+        {
+            FQuickSlotSaveData& D = QuickSlots.AddDefaulted_GetRef();
+            D.SlotIndex = ReadPacked(R);
+            D.ItemId = ReadName(R);
+            D.SkillId = ReadName(R);
+        }
+        break;
+    }
+    default:
+        return false;
+    }
+
+    return !R.IsError();
+}
+
+bool UNonSaveGame::IsSectionDataEqual(ENonSaveSection Section, const UNonSaveGame& Other) const
+{
+    switch (Section)
+    {
+    case ENonSaveSection::Items:      return InventoryItems == Other.InventoryItems;
+    case ENonSaveSection::Skills:     return SkillPoints == Other.SkillPoints && SkillLevels.OrderIndependentCompareEqual(Other.SkillLevels);
+    case ENonSaveSection::Equipment:  return EquippedItems == Other.EquippedItems;
+    case ENonSaveSection::QuickSlots: return QuickSlots == Other.QuickSlots;
+    default:                          return false;
+    }
+}
+
+void UNonSaveGame::CopySectionFrom(ENonSaveSection Section, const UNonSaveGame& Other)
+{
+    switch (Section)
+    {
+    case ENonSaveSection::Items:      InventoryItems = Other.InventoryItems; break;
+    case ENonSaveSection::Skills:     SkillPoints = Other.SkillPoints; SkillLevels = Other.SkillLevels; break;
+    case ENonSaveSection::Equipment:  EquippedItems = Other.EquippedItems; break;
+    case ENonSaveSection::QuickSlots: QuickSlots = Other.QuickSlots; break;
+    default: break;
+    }
+
+    EncodedSections[static_cast<int32>(Section)] = Other.EncodedSections[static_cast<int32>(Section)];
+}
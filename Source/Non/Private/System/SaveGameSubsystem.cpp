@@ -10,18 +10,210 @@
 #include "Equipment/EquipmentComponent.h"
 #include "UI/QuickSlot/QuickSlotManager.h"
 #include "System/NonGameInstance.h" // [New] for CurrentSlotName
+#include "System/IconCacheSubsystem.h"
 #include "Core/NonUIManagerComponent.h" // [Fix] for RefreshHUDState
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
 
 const FString USaveGameSubsystem::DefaultSlotName = TEXT("SaveSlot_01");
 
+namespace
+{
+    // 동기 경로(UGameplayStatics::SaveGameToSlot/LoadGameFromSlot)와 같은 플랫폼 세이브 시스템을 사용
+    // (콘솔/플러그인이 커스텀 세이브 시스템을 쓰면 파일 경로가 아닐 수 있음)
+    constexpr int32 SaveUserIndex = 0;
+
+    // 기본(파일 기반) 세이브 시스템의 경로 규칙
+    FString GetDefaultSaveFilePath(const FString& SlotName)
+    {
+        return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".sav"));
+    }
+
+    // 임시 슬롯에 먼저 쓰고 교체 (쓰기 도중 종료되어도 기존 슬롯 보존)
+    bool WriteSaveData(const FString& SlotName, const TArray<uint8>& Bytes)
+    {
+        ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+        if (!SaveSystem) return false;
+
+        const FString TempSlot = SlotName + TEXT("_tmp");
+        if (!SaveSystem->SaveGame(false, *TempSlot, SaveUserIndex, Bytes)) return false;
+
+        // 파일 기반 세이브 시스템이면 임시 파일을 원본 자리로 이동 (원본은 이동 직전까지 온전)
+        const FString TempPath = GetDefaultSaveFilePath(TempSlot);
+        if (IFileManager::Get().FileExists(*TempPath))
+        {
+            return IFileManager::Get().Move(*GetDefaultSaveFilePath(SlotName), *TempPath, true);
+        }
+
+        // 커스텀 세이브 시스템: 임시본이 온전히 기록된 뒤에만 원본을 덮어쓰고 임시본 정리
+        const bool bSaved = SaveSystem->SaveGame(false, *SlotName, SaveUserIndex, Bytes);
+        if (bSaved)
+        {
+            SaveSystem->DeleteGame(false, *TempSlot, SaveUserIndex);
+        }
+        return bSaved;
+    }
+
+    bool ReadSaveData(const FString& SlotName, TArray<uint8>& OutBytes)
+    {
+        ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+        return SaveSystem && SaveSystem->LoadGame(false, *SlotName, SaveUserIndex, OutBytes);
+    }
+}
+
+void USaveGameSubsystem::Deinitialize()
+{
+    // 진행 중인 비동기 저장은 끝까지 기록
+    WaitForPendingSave();
+    InFlightSnapshot = nullptr;
+
+    Super::Deinitialize();
+}
+
+FString USaveGameSubsystem::GetTargetSlotName() const
+{
+    FString TargetSlot = DefaultSlotName;
+    if (UNonGameInstance* GI = Cast<UNonGameInstance>(GetGameInstance()))
+    {
+        if (!GI->CurrentSlotName.IsEmpty())
+        {
+            TargetSlot = GI->CurrentSlotName;
+        }
+    }
+    return TargetSlot;
+}
+
+void USaveGameSubsystem::WaitForPendingSave()
+{
+    if (PendingSaveTask.IsValid())
+    {
+        PendingSaveTask.Wait();
+    }
+}
+
 void USaveGameSubsystem::SaveGame()
+{
+    // 비동기 저장이 진행 중이면 파일 충돌 방지를 위해 먼저 완료
+    WaitForPendingSave();
+
+    UNonSaveGame* SaveInst = CaptureSnapshot();
+    if (!SaveInst) return;
+    ReuseCleanSections(SaveInst);
+
+    // 파일 쓰기
+    const bool bSuccess = UGameplayStatics::SaveGameToSlot(SaveInst, GetTargetSlotName(), 0);
+    if (bSuccess)
+    {
+        UpdateSectionCache(SaveInst);
+    }
+    OnGameSaved.Broadcast(bSuccess);
+}
+
+void USaveGameSubsystem::SaveGameAsync()
+{
+    // 이미 저장 중이면 완료 후 최신 상태로 한 번 더 저장
+    if (bSaveInFlight)
+    {
+        bSaveQueued = true;
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // 게임 스레드: 값 복사만 수행
+    UNonSaveGame* Snapshot = CaptureSnapshot();
+    if (!Snapshot) return;
+    ReuseCleanSections(Snapshot);
+
+    InFlightSnapshot = Snapshot; // 워커 작업 동안 GC 방지
+    bSaveInFlight = true;
+
+    // 워커 스레드: 직렬화 + 세이브 시스템 쓰기 (스냅샷은 완료 전까지 게임 스레드에서 건드리지 않음)
+    const FString TargetSlot = GetTargetSlotName();
+    TWeakObjectPtr<USaveGameSubsystem> WeakThis(this);
+    PendingSaveTask = Async(EAsyncExecution::ThreadPool, [WeakThis, Snapshot, TargetSlot]()
+    {
+        TArray<uint8> Bytes;
+        const bool bSuccess = UGameplayStatics::SaveGameToMemory(Snapshot, Bytes) && WriteSaveData(TargetSlot, Bytes);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess]()
+        {
+            if (USaveGameSubsystem* This = WeakThis.Get())
+            {
+                This->HandleAsyncSaveFinished(bSuccess);
+            }
+        });
+    });
+
+    LastSaveGameThreadMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void USaveGameSubsystem::HandleAsyncSaveFinished(bool bSuccess)
+{
+    if (bSuccess && InFlightSnapshot)
+    {
+        UpdateSectionCache(InFlightSnapshot);
+    }
+    InFlightSnapshot = nullptr;
+    bSaveInFlight = false;
+
+    OnGameSaved.Broadcast(bSuccess);
+
+    if (bSaveQueued)
+    {
+        bSaveQueued = false;
+        SaveGameAsync();
+    }
+
+    // 저장 뒤로 미뤄 둔 로드 (방금 다시 시작한 저장이 있으면 그 완료 후)
+    if (bLoadQueued && !bSaveInFlight)
+    {
+        bLoadQueued = false;
+        LoadGameAsync();
+    }
+}
+
+void USaveGameSubsystem::ReuseCleanSections(UNonSaveGame* Snapshot) const
+{
+    if (!Snapshot || !SectionCache) return;
+
+    for (int32 i = 0; i < static_cast<int32>(ENonSaveSection::Num); ++i)
+    {
+        const ENonSaveSection Section = static_cast<ENonSaveSection>(i);
+        if (SectionCache->EncodedSections[i].Num() > 0 && Snapshot->IsSectionDataEqual(Section, *SectionCache))
+        {
+            Snapshot->EncodedSections[i] = SectionCache->EncodedSections[i];
+        }
+    }
+}
+
+void USaveGameSubsystem::UpdateSectionCache(const UNonSaveGame* Saved)
+{
+    if (!Saved) return;
+
+    if (!SectionCache)
+    {
+        SectionCache = NewObject<UNonSaveGame>(this);
+    }
+
+    for (int32 i = 0; i < static_cast<int32>(ENonSaveSection::Num); ++i)
+    {
+        SectionCache->CopySectionFrom(static_cast<ENonSaveSection>(i), *Saved);
+    }
+}
+
+UNonSaveGame* USaveGameSubsystem::CaptureSnapshot() const
 {
     // 로컬 플레이어 폰 찾기
     APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
-    if (!PlayerPawn) return;
+    if (!PlayerPawn) return nullptr;
 
     UNonSaveGame* SaveInst = Cast<UNonSaveGame>(UGameplayStatics::CreateSaveGameObject(UNonSaveGame::StaticClass()));
-    if (!SaveInst) return;
+    if (!SaveInst) return nullptr;
 
     // 1. 기본 정보 저장
     SaveInst->PlayerTransform = PlayerPawn->GetActorTransform();
@@ -68,46 +260,69 @@ void USaveGameSubsystem::SaveGame()
         }
     }
 
+    return SaveInst;
+}
+
+void USaveGameSubsystem::LoadGame()
+{
     // [Changed] 하드코딩된 SlotName 대신 GameInstance의 선택된 슬롯 사용
-    FString TargetSlot = DefaultSlotName;
-    if (UNonGameInstance* GI = Cast<UNonGameInstance>(GetGameInstance()))
+    const FString TargetSlot = GetTargetSlotName();
+
+    if (!UGameplayStatics::DoesSaveGameExist(TargetSlot, 0))
     {
-        if (!GI->CurrentSlotName.IsEmpty())
-        {
-            TargetSlot = GI->CurrentSlotName;
-        }
-    }
 
-    // 파일 쓰기
-    const bool bSuccess = UGameplayStatics::SaveGameToSlot(SaveInst, TargetSlot, 0);
-    OnGameSaved.Broadcast(bSuccess);
+        return;
+    }
 
+    UNonSaveGame* LoadInst = Cast<UNonSaveGame>(UGameplayStatics::LoadGameFromSlot(TargetSlot, 0));
 
+    // 읽기 실패한 세이브는 적용하지 않음 (ApplyLoadedSave 에서 거름)
+    OnGameLoaded.Broadcast(ApplyLoadedSave(LoadInst));
 }
 
-void USaveGameSubsystem::LoadGame()
+void USaveGameSubsystem::LoadGameAsync()
 {
-    FString TargetSlot = DefaultSlotName;
-    if (UNonGameInstance* GI = Cast<UNonGameInstance>(GetGameInstance()))
+    // 진행 중인 저장이 있으면 게임 스레드를 막지 않고 저장 완료 후 로드
+    if (bSaveInFlight)
     {
-        if (!GI->CurrentSlotName.IsEmpty())
-        {
-            TargetSlot = GI->CurrentSlotName;
-        }
+        bLoadQueued = true;
+        return;
     }
 
-    if (!UGameplayStatics::DoesSaveGameExist(TargetSlot, 0))
+    // 워커 스레드: 세이브 시스템에서 읽기
+    const FString TargetSlot = GetTargetSlotName();
+    TWeakObjectPtr<USaveGameSubsystem> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, TargetSlot]()
     {
+        TArray<uint8> Bytes;
+        const bool bRead = ReadSaveData(TargetSlot, Bytes);
 
-        return;
-    }
+        // 게임 스레드: UObject 생성(역직렬화) 및 적용
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, bRead, Bytes = MoveTemp(Bytes)]()
+        {
+            USaveGameSubsystem* This = WeakThis.Get();
+            if (!This) return;
+
+            UNonSaveGame* LoadInst = bRead ? Cast<UNonSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes)) : nullptr;
+            const bool bSuccess = LoadInst && This->ApplyLoadedSave(LoadInst);
+            This->OnGameLoaded.Broadcast(bSuccess);
+        });
+    });
+}
 
-    UNonSaveGame* LoadInst = Cast<UNonSaveGame>(UGameplayStatics::LoadGameFromSlot(TargetSlot, 0));
-    if (!LoadInst) return;
+bool USaveGameSubsystem::ApplyLoadedSave(UNonSaveGame* LoadInst)
+{
+    // 실패한 로드는 기본값 객체이므로 적용하면 레벨/위치/인벤토리가 초기화되고 다음 자동 저장이 원본을 덮어씀
+    if (!LoadInst || LoadInst->bLoadFailed)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[SaveGame] Refusing to apply failed load (Slot=%s, Schema=%d)"),
+            *GetTargetSlotName(), LoadInst ? LoadInst->SchemaVersion : -1);
+        return false;
+    }
 
     // 로컬 플레이어 폰 찾기
     APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
-    if (!PlayerPawn) return;
+    if (!PlayerPawn) return false;
 
     // 1. 위치 복구
     PlayerPawn->SetActorTransform(LoadInst->PlayerTransform);
@@ -176,6 +391,12 @@ void USaveGameSubsystem::LoadGame()
             QM->RestoreQuickSlotsFromSave(LoadInst->QuickSlots, InvenComp, EquipComp);
         }
 
+        // [New] 가방/퀵슬롯 아이콘 미리 로드 (창을 처음 열 때 로드 대기 줄이기)
+        if (UIconCacheSubsystem* Icons = UIconCacheSubsystem::Get(this))
+        {
+            Icons->PrefetchForCharacter(NonChar);
+        }
+
         // [New] 모든 데이터 복구 후 UI 한 번 강제 갱신 (직업 아이콘 등)
         if (UNonUIManagerComponent* UIMan = NonChar->FindComponentByClass<UNonUIManagerComponent>())
         {
@@ -183,21 +404,15 @@ void USaveGameSubsystem::LoadGame()
         }
     }
 
-    OnGameLoaded.Broadcast(true);
-
+    return true;
 }
 
 
 void USaveGameSubsystem::DeleteSaveGame()
 {
-    FString TargetSlot = DefaultSlotName;
-    if (UNonGameInstance* GI = Cast<UNonGameInstance>(GetGameInstance()))
-    {
-        if (!GI->CurrentSlotName.IsEmpty())
-        {
-            TargetSlot = GI->CurrentSlotName;
-        }
-    }
+    WaitForPendingSave();
+
+    const FString TargetSlot = GetTargetSlotName();
 
     if (UGameplayStatics::DoesSaveGameExist(TargetSlot, 0))
     {
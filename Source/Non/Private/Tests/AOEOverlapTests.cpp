@@ -0,0 +1,186 @@
+#include "Combat/AOEOverlapSubsystem.h"
+#include "Combat/DamageAOE.h"
+#include "Components/SceneComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AOEOverlapTests
+{
+    constexpr int32 NumPawns = 200;
+    constexpr int32 NumAOEs = 100;
+
+    // 폰/AOE 가 몰리는 지점 3곳 + 맵 전체에 흩어진 나머지
+    const FVector GroupCenters[] = { FVector(0.f, 0.f, 0.f), FVector(3000.f, 500.f, 0.f), FVector(-2500.f, -2000.f, 0.f) };
+    constexpr float GroupRadius = 800.f;
+    constexpr float MapHalfSize = 40000.f;
+
+    FVector RandomAround(FRandomStream& Rand, const FVector& Center, float HalfSize)
+    {
+        return Center + FVector(Rand.FRandRange(-HalfSize, HalfSize), Rand.FRandRange(-HalfSize, HalfSize), 0.f);
+    }
+
+    TArray<AActor*> SpawnPawns(FNonTestWorld& TestWorld, FRandomStream& Rand)
+    {
+        TArray<AActor*> Pawns;
+        for (int32 i = 0; i < NumPawns; ++i)
+        {
+            const FVector Location = i < 150
+                ? RandomAround(Rand, GroupCenters[i % 3], GroupRadius)
+                : RandomAround(Rand, FVector::ZeroVector, MapHalfSize);
+            Pawns.Add(TestWorld.SpawnBox(Location, FRotator::ZeroRotator, FVector(40.f, 40.f, 90.f), ECC_Pawn));
+        }
+        return Pawns;
+    }
+
+    /** 구/박스 AOE 100 개: 70 개는 몰린 지점, 15 개는 흩어진 폰 위, 15 개는 아무 데나 */
+    TArray<ADamageAOE*> SpawnAOEs(UWorld* World, FRandomStream& Rand, TConstArrayView<AActor*> Pawns)
+    {
+        TArray<ADamageAOE*> AOEs;
+        for (int32 i = 0; i < NumAOEs; ++i)
+        {
+            FVector Location;
+            if (i < 70)
+            {
+                Location = RandomAround(Rand, GroupCenters[i % 3], GroupRadius);
+            }
+            else if (i < 85)
+            {
+                Location = Pawns[150 + Rand.RandHelper(NumPawns - 150)]->GetActorLocation() + FVector(Rand.FRandRange(-100.f, 100.f), 0.f, 0.f);
+            }
+            else
+            {
+                Location = RandomAround(Rand, FVector::ZeroVector, MapHalfSize);
+            }
+
+            // 등록은 BeginPlay 에서, 형태/위치는 판정 시점(Tick)에 읽으므로 스폰 후 설정해도 됨
+            ADamageAOE* AOE = World->SpawnActor<ADamageAOE>();
+            if (i % 2 == 0)
+            {
+                AOE->ConfigureSphere(Rand.FRandRange(200.f, 500.f), 0.f, 10.f);
+            }
+            else
+            {
+                AOE->ConfigureBox(FVector(Rand.FRandRange(150.f, 400.f), Rand.FRandRange(150.f, 400.f), 200.f), 0.f, 10.f);
+            }
+            AOE->Team = ETeamSideAOE::Neutral;
+
+            USceneComponent* Root = NewObject<USceneComponent>(AOE);
+            AOE->SetRootComponent(Root);
+            Root->RegisterComponent();
+            AOE->SetActorLocation(Location);
+            AOEs.Add(AOE);
+        }
+        return AOEs;
+    }
+
+    /** AOE 마다 단독 물리 쿼리 (공용 처리기 이전 DoHit 과 같은 판정) */
+    TSet<AActor*> BruteForceTargets(UWorld* World, const ADamageAOE* AOE)
+    {
+        FVector Center;
+        FCollisionShape Shape;
+        AOE->GetOverlapQuery(Center, Shape);
+
+        TArray<FOverlapResult> Overlaps;
+        World->OverlapMultiByObjectType(Overlaps, Center, FQuat::Identity, FCollisionObjectQueryParams(ECC_Pawn), Shape,
+            FCollisionQueryParams(SCENE_QUERY_STAT(AOEOverlapTest), false, AOE));
+
+        TSet<AActor*> Result;
+        for (const FOverlapResult& Overlap : Overlaps)
+        {
+            if (AActor* Actor = Overlap.GetActor())
+            {
+                Result.Add(Actor);
+            }
+        }
+        return Result;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAOEOverlapHitSetTest, "Non.Combat.AOEOverlap.ClusteredHitSetMatchesPerAOE",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAOEOverlapHitSetTest::RunTest(const FString& Parameters)
+{
+    using namespace AOEOverlapTests;
+
+    FNonTestWorld TestWorld;
+    UWorld* World = TestWorld.World;
+    UAOEOverlapSubsystem* Overlaps = World->GetSubsystem<UAOEOverlapSubsystem>();
+    if (!TestNotNull(TEXT("AOE 오버랩 서브시스템"), Overlaps)) return false;
+
+    FRandomStream PawnRand(1234);
+    const TArray<AActor*> Pawns = SpawnPawns(TestWorld, PawnRand);
+    TestWorld.Tick();
+
+    struct FConfig
+    {
+        const TCHAR* Name;
+        float CellSize;
+        float VolumeRatio;
+    };
+    const FConfig Configs[] = {
+        { TEXT("기본 (격자 묶음)"), Overlaps->ClusterCellSize, Overlaps->MaxUnionVolumeRatio },
+        { TEXT("항상 AOE 별 쿼리"), Overlaps->ClusterCellSize, 0.f },
+        { TEXT("칸이 맵보다 큼 (사분면별 합집합)"), 1.e7f, 1.e30f },
+    };
+
+    for (const FConfig& Config : Configs)
+    {
+        Overlaps->ClusterCellSize = Config.CellSize;
+        Overlaps->MaxUnionVolumeRatio = Config.VolumeRatio;
+
+        // 설정마다 같은 배치
+        FRandomStream AOERand(5678);
+        const TArray<ADamageAOE*> AOEs = SpawnAOEs(World, AOERand, Pawns);
+        Overlaps->Tick(0.f);
+
+        TestEqual(FString::Printf(TEXT("%s: 판정한 AOE 수"), Config.Name), Overlaps->GetLastQueriedAOEs(), NumAOEs);
+
+        int32 NumExpectedHits = 0;
+        int32 NumMismatches = 0;
+        for (ADamageAOE* AOE : AOEs)
+        {
+            const TSet<AActor*> Expected = BruteForceTargets(World, AOE);
+            NumExpectedHits += Expected.Num();
+
+            for (AActor* Pawn : Pawns)
+            {
+                if (AOE->HasHitActor(Pawn) != Expected.Contains(Pawn))
+                {
+                    ++NumMismatches;
+                }
+            }
+        }
+
+        TestTrue(FString::Printf(TEXT("%s: 맞은 대상이 있어야 의미 있는 비교"), Config.Name), NumExpectedHits > 0);
+        TestEqual(FString::Printf(TEXT("%s: AOE 별 단독 쿼리와 다른 (AOE, 폰) 쌍"), Config.Name), NumMismatches, 0);
+
+        if (Config.VolumeRatio == 0.f)
+        {
+            TestEqual(TEXT("AOE 별 쿼리 수"), Overlaps->GetLastBroadphaseQueries(), NumAOEs);
+        }
+        else if (Config.CellSize >= 1.e7f)
+        {
+            // 칸 경계가 원점을 지나므로 XY 사분면 수만큼
+            TestTrue(TEXT("사분면별 합집합 쿼리 수"), Overlaps->GetLastBroadphaseQueries() <= 4);
+        }
+        else
+        {
+            // 몰린 AOE 는 묶이고 흩어진 AOE 는 각자 쿼리
+            TestTrue(TEXT("묶음 쿼리 수 < AOE 수"), Overlaps->GetLastBroadphaseQueries() < NumAOEs);
+            TestTrue(TEXT("흩어진 AOE 는 별도 쿼리"), Overlaps->GetLastBroadphaseQueries() > 3);
+        }
+
+        for (ADamageAOE* AOE : AOEs)
+        {
+            AOE->Destroy();
+        }
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,84 @@
+#include "Character/NonCharacterBase.h"
+#include "Ability/NonGameplayTags.h"
+#include "AbilitySystemComponent.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCharacterRotationLockEventTest, "Non.Character.Locomotion.RotationLockTracksTagEvents",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterRotationLockEventTest::RunTest(const FString& Parameters)
+{
+    FNonTestWorld TestWorld;
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ANonCharacterBase* Character = TestWorld.World->SpawnActor<ANonCharacterBase>(ANonCharacterBase::StaticClass(),
+        FVector(0.f, 0.f, 100.f), FRotator::ZeroRotator, SpawnParams);
+    if (!TestNotNull(TEXT("캐릭터 스폰"), Character)) return false;
+
+    UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+    if (!TestNotNull(TEXT("ASC"), ASC)) return false;
+
+    // BeginPlay 에서 이미 바인딩됐으면 무시됨
+    Character->BindLocomotionStateEvents();
+    TestFalse(TEXT("초기에는 잠금 없음"), Character->bRotationLockTagActive);
+
+    // 잠금 태그와 무관한 태그를 섞어 무작위로 붙였다 뗌 (같은 태그 중첩 포함)
+    const FGameplayTag Pool[] = {
+        NonGameplayTags::State_Attack, NonGameplayTags::State_Dodge, NonGameplayTags::Ability_Combo2,
+        NonGameplayTags::State_Stunned, NonGameplayTags::State_Dead, NonGameplayTags::State_ToggleWeapon_Root,
+        NonGameplayTags::State_Combat, NonGameplayTags::State_Guard, NonGameplayTags::State_Jump,
+    };
+    constexpr int32 NumPool = UE_ARRAY_COUNT(Pool);
+
+    FRandomStream Rand(31);
+    int32 CacheMismatches = 0;
+    int32 DirtyMismatches = 0;
+    int32 NumLockChanges = 0;
+
+    for (int32 Step = 0; Step < 500; ++Step)
+    {
+        const FGameplayTag Tag = Pool[Rand.RandHelper(NumPool)];
+        const bool bWasLocked = ASC->HasAnyMatchingGameplayTags(NonGameplayTags::GetRotationLockTags());
+        Character->bLocomotionDirty = false;
+
+        if (Rand.FRand() < 0.5f)
+        {
+            ASC->AddLooseGameplayTag(Tag);
+        }
+        else if (ASC->GetTagCount(Tag) > 0)
+        {
+            ASC->RemoveLooseGameplayTag(Tag);
+        }
+
+        const bool bLocked = ASC->HasAnyMatchingGameplayTags(NonGameplayTags::GetRotationLockTags());
+        if (Character->bRotationLockTagActive != bLocked)
+        {
+            ++CacheMismatches;
+        }
+        // 잠금 여부가 바뀐 경우에만 로코모션 재계산 요청
+        if (Character->bLocomotionDirty != (bLocked != bWasLocked))
+        {
+            ++DirtyMismatches;
+        }
+        NumLockChanges += (bLocked != bWasLocked) ? 1 : 0;
+    }
+
+    TestTrue(TEXT("잠금 상태가 실제로 여러 번 바뀌어야 의미 있는 비교"), NumLockChanges > 10);
+    TestEqual(TEXT("캐시된 잠금 상태가 ASC 와 다른 횟수"), CacheMismatches, 0);
+    TestEqual(TEXT("잠금 변경과 dirty 표시가 어긋난 횟수"), DirtyMismatches, 0);
+
+    // 입력도 상태 변화도 없는 프레임은 dirty 를 남기지 않음
+    Character->bLocomotionDirty = true;
+    TestWorld.Tick();
+    TestFalse(TEXT("틱 후 dirty 해제"), Character->bLocomotionDirty);
+    TestWorld.Tick();
+    TestFalse(TEXT("변화 없는 프레임은 다시 dirty 가 되지 않음"), Character->bLocomotionDirty);
+    return true;
+}
+
+#endif
@@ -0,0 +1,97 @@
+#include "Combat/CombatEventSubsystem.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CombatEventTests
+{
+    TArray<FCombatEvent> MakeDamageEvents(int32 Num)
+    {
+        TArray<FCombatEvent> Events;
+        for (int32 i = 0; i < Num; ++i)
+        {
+            FCombatEvent& Event = Events.AddDefaulted_GetRef();
+            Event.Type = ECombatEventType::Damage;
+            Event.Amount = static_cast<float>(i);
+        }
+        return Events;
+    }
+
+    int32 CountEvents(const TArray<FCombatEventBundle>& Bundles)
+    {
+        int32 Num = 0;
+        for (const FCombatEventBundle& Bundle : Bundles)
+        {
+            Num += Bundle.Events.Num();
+        }
+        return Num;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatEventBundleSplitTest, "Non.Combat.CombatEvents.OverflowSplitsIntoBundles",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCombatEventBundleSplitTest::RunTest(const FString& Parameters)
+{
+    using namespace CombatEventTests;
+
+    constexpr int32 Max = FCombatEventBundle::MaxEvents;
+    TArray<FCombatEventBundle> Bundles;
+
+    // 경계값: 0 / 딱 맞음 / 하나 넘침
+    UCombatEventSubsystem::BuildBundles(MakeDamageEvents(0), Bundles);
+    TestEqual(TEXT("이벤트 없음 → 묶음 없음"), Bundles.Num(), 0);
+
+    UCombatEventSubsystem::BuildBundles(MakeDamageEvents(Max), Bundles);
+    TestEqual(TEXT("MaxEvents 개 → 묶음 1"), Bundles.Num(), 1);
+
+    UCombatEventSubsystem::BuildBundles(MakeDamageEvents(Max + 1), Bundles);
+    TestEqual(TEXT("MaxEvents + 1 개 → 묶음 2"), Bundles.Num(), 2);
+    TestEqual(TEXT("넘친 1개는 두 번째 묶음"), Bundles.Num() == 2 ? Bundles[1].Events.Num() : 0, 1);
+
+    // 대규모 광역기: 데미지 140 + 적중 확인 5 (중간중간 섞여 들어옴)
+    constexpr int32 NumDamage = 140;
+    constexpr int32 NumHitConfirm = 5;
+    TArray<FCombatEvent> Events = MakeDamageEvents(NumDamage);
+    for (int32 i = 0; i < NumHitConfirm; ++i)
+    {
+        FCombatEvent HitConfirm;
+        HitConfirm.Type = ECombatEventType::HitConfirm;
+        Events.Insert(HitConfirm, 20 + i * 25);
+    }
+
+    UCombatEventSubsystem::BuildBundles(Events, Bundles);
+
+    const int32 Total = NumDamage + NumHitConfirm;
+    TestEqual(TEXT("묶음 수 = ceil(145 / MaxEvents)"), Bundles.Num(), FMath::DivideAndRoundUp(Total, Max));
+    TestEqual(TEXT("유실 없음"), CountEvents(Bundles), Total);
+
+    for (const FCombatEventBundle& Bundle : Bundles)
+    {
+        TestTrue(TEXT("묶음마다 MaxEvents 이하 (NetSerialize 제한)"), Bundle.Events.Num() <= Max);
+    }
+
+    // 적중 확인이 첫 묶음 맨 앞, 데미지는 원래 순서 그대로
+    TArray<FCombatEvent> Flat;
+    for (const FCombatEventBundle& Bundle : Bundles)
+    {
+        Flat.Append(Bundle.Events);
+    }
+    if (!TestEqual(TEXT("펼친 이벤트 수"), Flat.Num(), Total)) return false;
+
+    for (int32 i = 0; i < NumHitConfirm; ++i)
+    {
+        TestTrue(FString::Printf(TEXT("%d 번째는 HitConfirm"), i), Flat[i].Type == ECombatEventType::HitConfirm);
+    }
+
+    bool bDamageInOrder = true;
+    for (int32 i = 0; i < NumDamage; ++i)
+    {
+        const FCombatEvent& Event = Flat[NumHitConfirm + i];
+        bDamageInOrder &= Event.Type == ECombatEventType::Damage && Event.Amount == static_cast<float>(i);
+    }
+    TestTrue(TEXT("데미지 이벤트는 등록 순서 유지"), bDamageInOrder);
+    return true;
+}
+
+#endif
@@ -0,0 +1,124 @@
+#include "Combat/CombatResolverSubsystem.h"
+#include "Character/EnemyCharacter.h"
+#include "Ability/NonAttributeSet.h"
+#include "Data/EnemyDataAsset.h"
+#include "Misc/AutomationTest.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CombatResolverTests
+{
+    constexpr int32 NumAttackers = 3;
+    constexpr int32 NumTargets = 4;
+    constexpr int32 HitsPerPair = 5;
+    constexpr float TestMaxHP = 1000.f;
+    constexpr float HitDamage = 10.f;
+
+    AEnemyCharacter* SpawnTarget(UWorld* World, const UEnemyDataAsset* Data, int32 Index)
+    {
+        FActorSpawnParameters Params;
+        Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        AEnemyCharacter* Enemy = World->SpawnActor<AEnemyCharacter>(AEnemyCharacter::StaticClass(),
+            FVector(Index * 500.f, 0.f, 100.f), FRotator::ZeroRotator, Params);
+        Enemy->InitFromDataAsset(Data);
+        Enemy->InitializeAttributes();
+        return Enemy;
+    }
+
+    float GetHP(const AEnemyCharacter* Enemy)
+    {
+        const UNonAttributeSet* Attributes = Enemy ? Enemy->GetAttributeSet() : nullptr;
+        return Attributes ? Attributes->GetHP() : -1.f;
+    }
+
+    /** 스탯 없는 공격자(일반 액터) → 계산 결과 0 → FallbackDamage 로 확정 데미지 */
+    FCombatHitRequest MakeHit(AActor* Attacker, AActor* Target, float Damage)
+    {
+        FCombatHitRequest Request;
+        Request.Attacker = Attacker;
+        Request.DamageCauser = Attacker;
+        Request.Target = Target;
+        Request.FallbackDamage = Damage;
+        Request.HitLocation = Target ? Target->GetActorLocation() : FVector::ZeroVector;
+        return Request;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatResolverBatchTest, "Non.Combat.CombatResolver.BatchesHitsUntilTick",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCombatResolverBatchTest::RunTest(const FString& Parameters)
+{
+    using namespace CombatResolverTests;
+
+    FNonTestWorld TestWorld;
+    UWorld* World = TestWorld.World;
+    UCombatResolverSubsystem* Resolver = World->GetSubsystem<UCombatResolverSubsystem>();
+    if (!TestNotNull(TEXT("전투 해석기 서브시스템"), Resolver)) return false;
+
+    UEnemyDataAsset* Data = NewObject<UEnemyDataAsset>(GetTransientPackage());
+    Data->MaxHP = TestMaxHP;
+
+    TArray<AActor*> Attackers;
+    for (int32 i = 0; i < NumAttackers; ++i)
+    {
+        Attackers.Add(World->SpawnActor<AActor>());
+    }
+
+    TArray<AEnemyCharacter*> Targets;
+    for (int32 i = 0; i < NumTargets; ++i)
+    {
+        Targets.Add(SpawnTarget(World, Data, i));
+        if (!TestEqual(TEXT("대상 초기 HP"), GetHP(Targets.Last()), TestMaxHP)) return false;
+    }
+
+    // ── 1) 한 프레임의 다단히트: Tick 전까지는 적용되지 않음 ──
+    for (int32 Repeat = 0; Repeat < HitsPerPair; ++Repeat)
+    {
+        for (AActor* Attacker : Attackers)
+        {
+            for (AEnemyCharacter* Target : Targets)
+            {
+                UCombatResolverSubsystem::Submit(World, MakeHit(Attacker, Target, HitDamage));
+            }
+        }
+    }
+
+    constexpr int32 NumHits = NumAttackers * NumTargets * HitsPerPair;
+    TestEqual(TEXT("대기 중인 히트 수"), Resolver->GetNumPendingHits(), NumHits);
+    TestEqual(TEXT("Tick 전에는 HP 그대로"), GetHP(Targets[0]), TestMaxHP);
+
+    Resolver->Tick(0.f);
+
+    TestEqual(TEXT("처리 후 대기 0"), Resolver->GetNumPendingHits(), 0);
+    TestEqual(TEXT("처리한 히트 수"), Resolver->GetLastResolvedHits(), NumHits);
+    TestEqual(TEXT("스탯 스냅샷은 공격자당 한 번"), Resolver->GetLastSnapshotCount(), NumAttackers);
+
+    const float ExpectedHP = TestMaxHP - NumAttackers * HitsPerPair * HitDamage;
+    for (AEnemyCharacter* Target : Targets)
+    {
+        TestEqual(TEXT("대상마다 모든 히트가 한 번씩 적용"), GetHP(Target), ExpectedHP);
+    }
+
+    // ── 2) 대상 없음은 큐에 안 들어가고, 대기 중 파괴된 대상은 건너뜀 ──
+    UCombatResolverSubsystem::Submit(World, MakeHit(Attackers[0], nullptr, HitDamage));
+    TestEqual(TEXT("대상 없는 요청은 버림"), Resolver->GetNumPendingHits(), 0);
+
+    UCombatResolverSubsystem::Submit(World, MakeHit(Attackers[0], Targets[0], HitDamage));
+    UCombatResolverSubsystem::Submit(World, MakeHit(Attackers[0], Targets[1], HitDamage));
+    Targets[0]->Destroy();
+    Resolver->Tick(0.f);
+    TestEqual(TEXT("살아 있는 대상만 적용"), GetHP(Targets[1]), ExpectedHP - HitDamage);
+    TestEqual(TEXT("다른 대상은 영향 없음"), GetHP(Targets[2]), ExpectedHP);
+
+    // ── 3) 데미지 0 + bEffectRequiresDamage: 아무것도 적용 안 함 ──
+    FCombatHitRequest ZeroHit = MakeHit(Attackers[0], Targets[2], 0.f);
+    ZeroHit.bEffectRequiresDamage = true;
+    UCombatResolverSubsystem::Submit(World, MoveTemp(ZeroHit));
+    Resolver->Tick(0.f);
+    TestEqual(TEXT("데미지 0 히트는 HP 변화 없음"), GetHP(Targets[2]), ExpectedHP);
+    return true;
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "Effects/DamageNumberSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 위젯은 로컬 플레이어 화면이 있어야 만들 수 있으므로 게임 클라이언트에서 실행
+ * (예: -game -ExecCmds="Automation RunTests Non.Effects")
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDamageNumberPoolTest, "Non.Effects.DamageNumbers.PoolReusesWidgets",
+    EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FDamageNumberPoolTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = AutomationCommon::GetAnyGameWorld();
+    UDamageNumberSubsystem* Numbers = World ? World->GetSubsystem<UDamageNumberSubsystem>() : nullptr;
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    if (!TestNotNull(TEXT("게임 월드의 데미지 숫자 서브시스템"), Numbers)) return false;
+    if (!TestNotNull(TEXT("로컬 플레이어 컨트롤러"), PC)) return false;
+
+    constexpr int32 Max = UDamageNumberSubsystem::MaxOnScreen;
+    const FVector Location = PC->GetPawn() ? PC->GetPawn()->GetActorLocation() : FVector::ZeroVector;
+    const int32 Baseline = Numbers->GetNumCreatedWidgets();
+
+    // 1) 한 프레임에 최대치의 3배: 가장 오래된 숫자를 재사용하므로 위젯은 최대치까지만 생성
+    for (int32 i = 0; i < Max * 3; ++i)
+    {
+        UDamageNumberSubsystem::ShowNumber(World, nullptr, Location, static_cast<float>(i), ENonDamageNumberCategory::Normal);
+    }
+    TestEqual(TEXT("활성 숫자는 MaxOnScreen 에서 멈춤"), Numbers->GetNumActive(), Max);
+    TestTrue(TEXT("생성 위젯 수 <= 기존 + MaxOnScreen"), Numbers->GetNumCreatedWidgets() <= Baseline + Max);
+
+    const int32 AfterBurst = Numbers->GetNumCreatedWidgets();
+    TWeakObjectPtr<UWorld> WeakWorld = World;
+    TWeakObjectPtr<UDamageNumberSubsystem> WeakNumbers = Numbers;
+
+    // 2) 기본 수명(1.5초)이 지나면 전부 반납 → 같은 수를 다시 띄워도 새 위젯 없음
+    ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, WeakWorld, WeakNumbers, Location, AfterBurst]()
+    {
+        UDamageNumberSubsystem* Pool = WeakNumbers.Get();
+        if (!TestNotNull(TEXT("대기 후 서브시스템"), Pool)) return;
+
+        TestEqual(TEXT("수명이 지나면 활성 숫자 0"), Pool->GetNumActive(), 0);
+
+        for (int32 i = 0; i < Max; ++i)
+        {
+            UDamageNumberSubsystem::ShowNumber(WeakWorld.Get(), nullptr, Location, static_cast<float>(i), ENonDamageNumberCategory::Critical);
+        }
+        TestEqual(TEXT("두 번째 폭주는 전부 재사용 (추가 생성 0)"), Pool->GetNumCreatedWidgets(), AfterBurst);
+    }, 3.f));
+
+    return true;
+}
+
+#endif
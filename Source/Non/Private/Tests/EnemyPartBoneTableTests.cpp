@@ -0,0 +1,67 @@
+#include "Character/EnemyPartBoneTableSubsystem.h"
+#include "Engine/SkeletalMesh.h"
+#include "Misc/AutomationTest.h"
+#include "ReferenceSkeleton.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace EnemyPartBoneTableTests
+{
+    /** root ─ spine ─ head, root ─ arm 뼈만 있는 메시 */
+    USkeletalMesh* MakeTestMesh()
+    {
+        USkeletalMesh* Mesh = NewObject<USkeletalMesh>(GetTransientPackage());
+        {
+            FReferenceSkeletonModifier Modifier(Mesh->GetRefSkeleton(), nullptr);
+            Modifier.Add(FMeshBoneInfo(TEXT("root"), TEXT("root"), INDEX_NONE), FTransform::Identity);
+            Modifier.Add(FMeshBoneInfo(TEXT("spine"), TEXT("spine"), 0), FTransform::Identity);
+            Modifier.Add(FMeshBoneInfo(TEXT("head"), TEXT("head"), 1), FTransform::Identity);
+            Modifier.Add(FMeshBoneInfo(TEXT("arm"), TEXT("arm"), 0), FTransform::Identity);
+        }
+        return Mesh;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEnemyPartBoneTableCacheTest, "Non.Character.PartBoneTable.SharedPerWorld",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEnemyPartBoneTableCacheTest::RunTest(const FString& Parameters)
+{
+    using namespace EnemyPartBoneTableTests;
+
+    USkeletalMesh* Mesh = MakeTestMesh();
+    const TArray<FName> SpineParts = { TEXT("spine") };
+    const TArray<FName> ArmParts = { TEXT("arm"), TEXT("head") };
+
+    TWeakPtr<const FEnemyPartBoneTable> WeakTable;
+    {
+        FNonTestWorld TestWorld;
+        UEnemyPartBoneTableSubsystem* Subsystem = UEnemyPartBoneTableSubsystem::Get(TestWorld.World);
+        if (!TestNotNull(TEXT("월드 서브시스템"), Subsystem)) return false;
+
+        TSharedPtr<const FEnemyPartBoneTable> A = UEnemyPartBoneTableSubsystem::Resolve(TestWorld.World, Mesh, SpineParts);
+        TSharedPtr<const FEnemyPartBoneTable> B = UEnemyPartBoneTableSubsystem::Resolve(TestWorld.World, Mesh, SpineParts);
+        if (!TestTrue(TEXT("표 생성"), A.IsValid())) return false;
+
+        TestTrue(TEXT("같은 메시 + 같은 부위 구성은 표 공유"), A == B);
+        TestEqual(TEXT("root 는 부위 없음"), A->BoneToPart[0], INDEX_NONE);
+        TestEqual(TEXT("spine 은 slot 0"), A->BoneToPart[1], 0);
+        TestEqual(TEXT("head 는 가장 가까운 부위 조상(spine)"), A->BoneToPart[2], 0);
+        TestEqual(TEXT("arm 은 부위 없음"), A->BoneToPart[3], INDEX_NONE);
+
+        TSharedPtr<const FEnemyPartBoneTable> C = UEnemyPartBoneTableSubsystem::Resolve(TestWorld.World, Mesh, ArmParts);
+        TestTrue(TEXT("부위 구성이 다르면 별도 표"), A != C);
+        TestEqual(TEXT("arm 은 slot 0"), C->BoneToPart[3], 0);
+        TestEqual(TEXT("head 는 slot 1"), C->BoneToPart[2], 1);
+        TestEqual(TEXT("캐시된 표 수"), Subsystem->GetNumCachedTables(), 2);
+
+        WeakTable = A;
+    }
+
+    // 적들이 표를 놓고 월드가 끝나면 캐시도 비워져 표가 해제되어야 함
+    TestFalse(TEXT("월드 종료 후 표 해제"), WeakTable.IsValid());
+    return true;
+}
+
+#endif
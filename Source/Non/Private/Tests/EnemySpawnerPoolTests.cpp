@@ -0,0 +1,100 @@
+#include "AI/EnemySpawner.h"
+#include "Character/EnemyCharacter.h"
+#include "Ability/NonAttributeSet.h"
+#include "Data/EnemyDataAsset.h"
+#include "EngineUtils.h"
+#include "Misc/AutomationTest.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace EnemySpawnerPoolTests
+{
+    constexpr int32 NumAlive = 3;
+    constexpr int32 NumCycles = 30;
+    constexpr float TestMaxHP = 150.f;
+
+    TArray<AEnemyCharacter*> GatherEnemies(UWorld* World, bool bInPool)
+    {
+        TArray<AEnemyCharacter*> Result;
+        for (TActorIterator<AEnemyCharacter> It(World); It; ++It)
+        {
+            if (IsValid(*It) && It->IsInPool() == bInPool)
+            {
+                Result.Add(*It);
+            }
+        }
+        return Result;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEnemySpawnerPoolTest, "Non.AI.EnemySpawner.PoolReusesDeadEnemies",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEnemySpawnerPoolTest::RunTest(const FString& Parameters)
+{
+    using namespace EnemySpawnerPoolTests;
+
+    FNonTestWorld TestWorld;
+    UWorld* World = TestWorld.World;
+
+    UEnemyDataAsset* Data = NewObject<UEnemyDataAsset>(GetTransientPackage());
+    Data->EnemyClass = AEnemyCharacter::StaticClass();
+    Data->MaxHP = TestMaxHP;
+
+    // BeginPlay 에서 초기 스폰하므로 설정은 FinishSpawning 전에
+    AEnemySpawner* Spawner = World->SpawnActorDeferred<AEnemySpawner>(AEnemySpawner::StaticClass(), FTransform::Identity);
+    Spawner->EnemyDataAsset = Data;
+    Spawner->InitialCount = NumAlive;
+    Spawner->MaxAlive = NumAlive;
+    Spawner->RespawnDelay = 0.05f;
+    Spawner->SpawnRadius = 3000.f;
+    Spawner->bProjectToNavMesh = false;
+    Spawner->bAutoRefill = false;
+    Spawner->bUsePooling = true;
+    Spawner->MaxPoolSize = NumAlive;
+    Spawner->FinishSpawning(FTransform::Identity);
+
+    if (!TestEqual(TEXT("초기 스폰 수"), GatherEnemies(World, false).Num(), NumAlive)) return false;
+    TestEqual(TEXT("초기 스폰은 풀 미스"), Spawner->GetPoolMisses(), NumAlive);
+
+    // 한 마리씩 죽이고 → 페이드 아웃 종료(풀 반환) → 리스폰 타이머 순으로 반복
+    int32 NumNotReused = 0;
+    int32 NumNotReset = 0;
+    for (int32 Cycle = 0; Cycle < NumCycles; ++Cycle)
+    {
+        const TArray<AEnemyCharacter*> Active = GatherEnemies(World, false);
+        if (!TestEqual(FString::Printf(TEXT("%d 회차 활성 수"), Cycle), Active.Num(), NumAlive)) return false;
+
+        AEnemyCharacter* Victim = Active[Cycle % Active.Num()];
+        Victim->GetAttributeSet()->SetHP(0.f);
+        Victim->StartDeathSequence();
+
+        // OnFadeTimelineFinished 와 같은 경로
+        TestTrue(TEXT("풀이 죽은 적을 받음"), Spawner->ReleaseToPool(Victim));
+        TestTrue(TEXT("반환된 적은 숨김"), Victim->IsHidden());
+
+        TestWorld.Tick(0.1f);
+
+        if (Victim->IsInPool())
+        {
+            ++NumNotReused;
+            continue;
+        }
+
+        const UNonAttributeSet* Attributes = Victim->GetAttributeSet();
+        if (Victim->IsDead() || Victim->IsHidden() || !Attributes || Attributes->GetHP() != TestMaxHP)
+        {
+            ++NumNotReset;
+        }
+    }
+
+    TestEqual(TEXT("리스폰이 풀의 같은 적을 꺼내지 않은 횟수"), NumNotReused, 0);
+    TestEqual(TEXT("재사용된 적이 사망/숨김 상태를 벗지 못한 횟수"), NumNotReset, 0);
+    TestEqual(TEXT("풀 히트 = 회차 수"), Spawner->GetPoolHits(), NumCycles);
+    TestEqual(TEXT("추가 SpawnActor 없음"), Spawner->GetPoolMisses(), NumAlive);
+    TestEqual(TEXT("월드의 적 액터 수 유지"), GatherEnemies(World, false).Num() + GatherEnemies(World, true).Num(), NumAlive);
+    return true;
+}
+
+#endif
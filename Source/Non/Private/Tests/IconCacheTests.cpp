@@ -0,0 +1,73 @@
+#include "System/IconCacheSubsystem.h"
+#include "Engine/Texture2D.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace IconCacheTests
+{
+    // 엔진에 항상 있는 2D 텍스처
+    TSoftObjectPtr<UTexture2D> EngineIcon(const TCHAR* Path)
+    {
+        return TSoftObjectPtr<UTexture2D>(FSoftObjectPath(Path));
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FIconCacheLRUTest, "Non.System.IconCache.EvictsLeastRecentlyUsed",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FIconCacheLRUTest::RunTest(const FString& Parameters)
+{
+    using namespace IconCacheTests;
+
+    const TSoftObjectPtr<UTexture2D> A = EngineIcon(TEXT("/Engine/EngineResources/DefaultTexture.DefaultTexture"));
+    const TSoftObjectPtr<UTexture2D> B = EngineIcon(TEXT("/Engine/EngineResources/WhiteSquareTexture.WhiteSquareTexture"));
+    const TSoftObjectPtr<UTexture2D> C = EngineIcon(TEXT("/Engine/EngineMaterials/DefaultDiffuse.DefaultDiffuse"));
+    const TSoftObjectPtr<UTexture2D> D = EngineIcon(TEXT("/Engine/EngineMaterials/DefaultNormal.DefaultNormal"));
+
+    // 게임 인스턴스가 없으면 동기 로드로 대체 (에디터 프리뷰 경로) → 이후 요청은 메모리에 있는 상태
+    for (const TSoftObjectPtr<UTexture2D>& Icon : { A, B, C, D })
+    {
+        if (!TestNotNull(*FString::Printf(TEXT("%s 동기 로드"), *Icon.ToString()), UIconCacheSubsystem::Resolve(nullptr, Icon))) return false;
+    }
+
+    UIconCacheSubsystem* Cache = NewObject<UIconCacheSubsystem>(GetTransientPackage());
+    Cache->MaxCachedIcons = 2;
+
+    // 메모리에 있는 아이콘은 콜백 없이 바로 반환
+    bool bCallbackFired = false;
+    TestTrue(TEXT("로드된 아이콘은 즉시 반환"),
+        Cache->RequestIcon(A, FOnIconLoaded::CreateLambda([&bCallbackFired](UTexture2D*) { bCallbackFired = true; })) == A.Get());
+    TestFalse(TEXT("즉시 반환이면 대기 콜백 등록 안 함"), bCallbackFired);
+
+    // A, B 요청 → A 다시 사용 → C 요청: 가장 오래 안 쓴 B 가 빠짐
+    Cache->RequestIcon(B);
+    Cache->RequestIcon(A);
+    Cache->RequestIcon(C);
+    TestEqual(TEXT("최대 개수 유지"), Cache->GetNumCachedIcons(), 2);
+    TestTrue(TEXT("최근에 쓴 A 는 남음"), Cache->IsIconCached(A));
+    TestFalse(TEXT("가장 오래 안 쓴 B 는 해제"), Cache->IsIconCached(B));
+    TestTrue(TEXT("새로 요청한 C 는 캐시"), Cache->IsIconCached(C));
+
+    // 미리 로드도 같은 LRU 규칙: B → A 해제, D → C 해제
+    const TSoftObjectPtr<UTexture2D> PrefetchIcons[] = { B, D };
+    Cache->Prefetch(PrefetchIcons);
+    TestEqual(TEXT("미리 로드 후에도 최대 개수 유지"), Cache->GetNumCachedIcons(), 2);
+    TestTrue(TEXT("미리 로드한 B 캐시"), Cache->IsIconCached(B));
+    TestTrue(TEXT("미리 로드한 D 캐시"), Cache->IsIconCached(D));
+    TestFalse(TEXT("A 해제"), Cache->IsIconCached(A));
+    TestFalse(TEXT("C 해제"), Cache->IsIconCached(C));
+
+    // 같은 아이콘 반복 요청은 항목을 늘리지 않음
+    for (int32 i = 0; i < 10; ++i)
+    {
+        Cache->RequestIcon(D);
+    }
+    TestEqual(TEXT("반복 요청은 항목을 늘리지 않음"), Cache->GetNumCachedIcons(), 2);
+
+    Cache->Deinitialize();
+    TestEqual(TEXT("Deinitialize 후 캐시 비움"), Cache->GetNumCachedIcons(), 0);
+    return true;
+}
+
+#endif
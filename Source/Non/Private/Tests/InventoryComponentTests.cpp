@@ -0,0 +1,139 @@
+#include "Inventory/InventoryComponent.h"
+#include "Inventory/InventoryItem.h"
+#include "Engine/DataTable.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace InventoryComponentTests
+{
+    const FName ItemIds[] = { TEXT("Potion"), TEXT("Arrow"), TEXT("Sword"), TEXT("Ore") };
+    const int32 MaxStacks[] = { 10, 99, 1, 5 };
+    constexpr int32 NumItemIds = UE_ARRAY_COUNT(ItemIds);
+
+    UDataTable* MakeItemTable()
+    {
+        UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+        Table->RowStruct = FItemRow::StaticStruct();
+        for (int32 i = 0; i < NumItemIds; ++i)
+        {
+            FItemRow Row;
+            Row.ItemId = ItemIds[i];
+            Row.MaxStack = MaxStacks[i];
+            Table->AddRow(ItemIds[i], Row);
+        }
+        return Table;
+    }
+
+    /** 색인 없이 앞에서부터 훑는 기준 구현 (색인 도입 전 AddItem 이 고르던 슬롯) */
+    int32 LinearFirstEmpty(const UInventoryComponent& Inventory)
+    {
+        for (int32 i = 0; i < Inventory.Slots.Num(); ++i)
+        {
+            if (Inventory.Slots[i] == nullptr) return i;
+        }
+        return INDEX_NONE;
+    }
+
+    int32 LinearTargetSlot(const UInventoryComponent& Inventory, FName ItemId)
+    {
+        for (int32 i = 0; i < Inventory.Slots.Num(); ++i)
+        {
+            const UInventoryItem* It = Inventory.Slots[i];
+            if (It && It->ItemId == ItemId && It->IsStackable() && It->Quantity < It->GetMaxStack())
+            {
+                return i;
+            }
+        }
+        return LinearFirstEmpty(Inventory);
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInventorySlotIndexTest, "Non.Inventory.SlotIndex.MatchesLinearScan",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FInventorySlotIndexTest::RunTest(const FString& Parameters)
+{
+    using namespace InventoryComponentTests;
+
+    FNonTestWorld TestWorld;
+    AActor* Owner = TestWorld.World->SpawnActor<AActor>();
+    UInventoryComponent* Inventory = NewObject<UInventoryComponent>(Owner);
+    Inventory->MaxSlots = 40;
+    Inventory->ItemDataTable = MakeItemTable();
+    Inventory->RegisterComponent();
+    if (!Inventory->HasBegunPlay())
+    {
+        Inventory->BeginPlay();
+    }
+    if (!TestEqual(TEXT("슬롯 수"), Inventory->GetSlotCount(), 40)) return false;
+
+    // 추가/제거/이동/교환/나누기/정렬을 섞어 돌리며 매번 색인 결과를 선형 탐색과 비교
+    FRandomStream Rand(2024);
+    constexpr int32 NumOps = 2000;
+    int32 EmptyMismatches = 0;
+    int32 TargetMismatches = 0;
+
+    for (int32 Op = 0; Op < NumOps; ++Op)
+    {
+        const int32 A = Rand.RandHelper(Inventory->MaxSlots);
+        const int32 B = Rand.RandHelper(Inventory->MaxSlots);
+        const int32 Kind = Rand.RandHelper(100);
+        int32 Unused = INDEX_NONE;
+
+        if (Kind < 40)
+        {
+            Inventory->AddItem(ItemIds[Rand.RandHelper(NumItemIds)], Rand.RandRange(1, 25), Unused);
+        }
+        else if (Kind < 65)
+        {
+            Inventory->RemoveAt(A, Rand.RandRange(1, 10));
+        }
+        else if (Kind < 80)
+        {
+            Inventory->Move(A, B);
+        }
+        else if (Kind < 90)
+        {
+            Inventory->Swap(A, B);
+        }
+        else if (Kind < 98)
+        {
+            Inventory->SplitStack(A, B, Rand.RandRange(1, 5));
+        }
+        else
+        {
+            Inventory->SortInventory();
+        }
+
+        if (Inventory->GetFirstEmptySlot() != LinearFirstEmpty(*Inventory))
+        {
+            ++EmptyMismatches;
+        }
+
+        // 아이템마다 1개를 넣어 보고 들어간 슬롯을 확인한 뒤 되돌림
+        for (const FName ItemId : ItemIds)
+        {
+            const int32 Expected = LinearTargetSlot(*Inventory, ItemId);
+            int32 Placed = INDEX_NONE;
+            const bool bAdded = Inventory->AddItem(ItemId, 1, Placed);
+
+            if (Placed != Expected || bAdded != (Expected != INDEX_NONE))
+            {
+                ++TargetMismatches;
+            }
+            if (bAdded)
+            {
+                Inventory->RemoveAt(Placed, 1);
+            }
+        }
+    }
+
+    TestEqual(TEXT("빈 슬롯 색인이 선형 탐색과 다른 횟수"), EmptyMismatches, 0);
+    TestEqual(TEXT("AddItem 이 고른 슬롯이 선형 탐색과 다른 횟수"), TargetMismatches, 0);
+    return true;
+}
+
+#endif
@@ -0,0 +1,125 @@
+#include "UI/Inventory/InventoryWidget.h"
+#include "UI/Inventory/InventorySlotWidget.h"
+#include "Inventory/InventoryComponent.h"
+#include "Inventory/InventoryItem.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/UniformGridPanel.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace InventoryWidgetTests
+{
+    constexpr int32 NumSlots = 24;
+
+    UDataTable* MakeItemTable()
+    {
+        UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+        Table->RowStruct = FItemRow::StaticStruct();
+
+        FItemRow Row;
+        Row.ItemId = TEXT("Potion");
+        Row.MaxStack = 10;
+        Table->AddRow(Row.ItemId, Row);
+        return Table;
+    }
+
+    UInventorySlotWidget* GetSlotWidget(const UInventoryWidget* Bag, int32 Index)
+    {
+        return Bag->Grid ? Cast<UInventorySlotWidget>(Bag->Grid->GetChildAt(Index)) : nullptr;
+    }
+}
+
+/**
+ * 슬롯 갱신은 NativeTick 에서 모아 처리하므로 화면에 띄울 수 있는 게임 클라이언트에서 실행
+ * (예: -game -ExecCmds="Automation RunTests Non.UI")
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInventoryWidgetDispatchTest, "Non.UI.Inventory.SlotUpdatesDispatchByIndex",
+    EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FInventoryWidgetDispatchTest::RunTest(const FString& Parameters)
+{
+    using namespace InventoryWidgetTests;
+
+    UWorld* World = AutomationCommon::GetAnyGameWorld();
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    if (!TestNotNull(TEXT("로컬 플레이어 컨트롤러"), PC)) return false;
+
+    // 플레이어 인벤토리를 건드리지 않도록 임시 액터에 별도 인벤토리
+    AActor* Holder = World->SpawnActor<AActor>();
+    UInventoryComponent* Inventory = NewObject<UInventoryComponent>(Holder);
+    Inventory->MaxSlots = NumSlots;
+    Inventory->ItemDataTable = MakeItemTable();
+    Inventory->RegisterComponent();
+    if (!Inventory->HasBegunPlay())
+    {
+        Inventory->BeginPlay();
+    }
+
+    UInventoryWidget* Bag = CreateWidget<UInventoryWidget>(PC, UInventoryWidget::StaticClass());
+    if (!TestNotNull(TEXT("가방 위젯"), Bag)) return false;
+    Bag->SlotWidgetClass = UInventorySlotWidget::StaticClass();
+    Bag->Grid = Bag->WidgetTree->ConstructWidget<UUniformGridPanel>(UUniformGridPanel::StaticClass(), TEXT("Grid"));
+    Bag->WidgetTree->RootWidget = Bag->Grid;
+    Bag->AddToViewport();
+    Bag->InitInventoryUI(Inventory, nullptr);
+
+    if (!TestEqual(TEXT("슬롯 위젯 수"), Bag->Grid->GetChildrenCount(), NumSlots)) return false;
+
+    // 1) 인벤토리 델리게이트 구독자는 가방 위젯 하나뿐 (슬롯 위젯은 직접 구독하지 않음)
+    TestEqual(TEXT("OnSlotUpdated 구독자 수"), Inventory->OnSlotUpdated.GetAllObjects().Num(), 1);
+    TestEqual(TEXT("OnInventoryRefreshed 구독자 수"), Inventory->OnInventoryRefreshed.GetAllObjects().Num(), 1);
+
+    // 2) 같은 프레임의 슬롯 변경은 다음 틱까지 모아 둠
+    int32 Placed[3];
+    Inventory->AddItem(TEXT("Potion"), 10, Placed[0]);
+    Inventory->AddItem(TEXT("Potion"), 10, Placed[1]);
+    Inventory->AddItem(TEXT("Potion"), 3, Placed[2]);
+    Inventory->RemoveAt(Placed[2], 1);
+
+    bool bDeferred = true;
+    for (const int32 Index : Placed)
+    {
+        const UInventorySlotWidget* SlotWidget = GetSlotWidget(Bag, Index);
+        bDeferred &= SlotWidget && SlotWidget->Item == nullptr;
+    }
+    TestTrue(TEXT("틱 전에는 슬롯 위젯 갱신 안 됨"), bDeferred);
+
+    TWeakObjectPtr<UInventoryWidget> WeakBag = Bag;
+    TWeakObjectPtr<UInventoryComponent> WeakInventory = Inventory;
+    TWeakObjectPtr<AActor> WeakHolder = Holder;
+
+    // 3) 틱 한 번 뒤에는 모든 슬롯 위젯이 인벤토리 내용과 일치
+    ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, WeakBag, WeakInventory, WeakHolder]()
+    {
+        UInventoryWidget* LiveBag = WeakBag.Get();
+        UInventoryComponent* LiveInventory = WeakInventory.Get();
+        if (TestNotNull(TEXT("대기 후 가방 위젯"), LiveBag) && TestNotNull(TEXT("대기 후 인벤토리"), LiveInventory))
+        {
+            int32 NumMismatches = 0;
+            for (int32 i = 0; i < NumSlots; ++i)
+            {
+                const UInventorySlotWidget* SlotWidget = GetSlotWidget(LiveBag, i);
+                if (!SlotWidget || SlotWidget->Item != LiveInventory->GetItemAt(i))
+                {
+                    ++NumMismatches;
+                }
+            }
+            TestEqual(TEXT("틱 후 슬롯 위젯과 인벤토리가 다른 슬롯 수"), NumMismatches, 0);
+            LiveBag->RemoveFromParent();
+        }
+
+        if (AActor* LiveHolder = WeakHolder.Get())
+        {
+            LiveHolder->Destroy();
+        }
+    }, 0.2f));
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,161 @@
+#include "System/LootSubsystem.h"
+#include "Data/EnemyDataAsset.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace LootTableTests
+{
+    // 굴림 대상 9개 → 묶음 2개 (8 + 1)
+    const float RolledChances[] = { 0.01f, 0.05f, 0.1f, 0.25f, 0.5f, 0.75f, 0.9f, 0.99f, 0.33f };
+    constexpr int32 NumRolled = UE_ARRAY_COUNT(RolledChances);
+
+    UEnemyDataAsset* MakeData()
+    {
+        UEnemyDataAsset* Data = NewObject<UEnemyDataAsset>(GetTransientPackage());
+
+        auto Add = [Data](const TCHAR* Id, float Chance)
+        {
+            FEnemyDropItem& Drop = Data->DropList.AddDefaulted_GetRef();
+            Drop.ItemId = FName(Id);
+            Drop.DropChance = Chance;
+        };
+
+        Add(TEXT("Rolled_0"), RolledChances[0]);
+        Add(TEXT("Always"), 1.f);
+        Add(TEXT("Never"), 0.f);
+        for (int32 i = 1; i < NumRolled; ++i)
+        {
+            Add(*FString::Printf(TEXT("Rolled_%d"), i), RolledChances[i]);
+        }
+        return Data;
+    }
+
+    /** 앨리어스 테이블이 뜻하는 결과(비트마스크)별 확률 */
+    TArray<double> ImpliedDistribution(const FLootAliasChunk& Chunk)
+    {
+        const int32 NumOutcomes = Chunk.Prob.Num();
+        TArray<double> P;
+        P.SetNumZeroed(NumOutcomes);
+        for (int32 i = 0; i < NumOutcomes; ++i)
+        {
+            P[i] += Chunk.Prob[i] / NumOutcomes;
+            P[Chunk.Alias[i]] += (1.0 - Chunk.Prob[i]) / NumOutcomes;
+        }
+        return P;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLootAliasTableTest, "Non.System.Loot.AliasTableMatchesPerEntryRolls",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FLootAliasTableTest::RunTest(const FString& Parameters)
+{
+    using namespace LootTableTests;
+
+    FCompiledLootTable Table;
+    Table.Build(*MakeData());
+
+    // ── 구성: 확률 1 은 앞쪽, 확률 0 은 제외, 나머지는 8개씩 묶음 ──
+    TestEqual(TEXT("항목 수 (확률 0 제외)"), Table.Entries.Num(), NumRolled + 1);
+    TestEqual(TEXT("확정 항목 수"), Table.AlwaysCount, 1);
+    TestTrue(TEXT("확정 항목이 맨 앞"), Table.Entries.Num() > 0 && Table.Entries[0].ItemId == FName(TEXT("Always")));
+    if (!TestEqual(TEXT("묶음 수"), Table.Chunks.Num(), 2)) return false;
+    TestEqual(TEXT("첫 묶음 항목 수"), Table.Chunks[0].NumEntries, FLootAliasChunk::MaxEntries);
+    TestEqual(TEXT("둘째 묶음 항목 수"), Table.Chunks[1].NumEntries, NumRolled - FLootAliasChunk::MaxEntries);
+
+    // ── 정확도: 테이블이 뜻하는 조합 확률 == 항목별 독립 확률의 곱 ──
+    for (const FLootAliasChunk& Chunk : Table.Chunks)
+    {
+        const TArray<double> Implied = ImpliedDistribution(Chunk);
+        double MaxError = 0.0;
+        for (int32 Mask = 0; Mask < Implied.Num(); ++Mask)
+        {
+            double Expected = 1.0;
+            for (int32 Bit = 0; Bit < Chunk.NumEntries; ++Bit)
+            {
+                const double Chance = RolledChances[Chunk.FirstEntry - Table.AlwaysCount + Bit];
+                Expected *= (Mask & (1 << Bit)) ? Chance : (1.0 - Chance);
+            }
+            MaxError = FMath::Max(MaxError, FMath::Abs(Implied[Mask] - Expected));
+        }
+        TestTrue(FString::Printf(TEXT("묶음 %d: 조합 확률 오차 %g < 1e-5"), Chunk.FirstEntry, MaxError), MaxError < 1.e-5);
+    }
+
+    // ── 표본: 같은 횟수로 앨리어스 샘플과 항목별 굴림을 비교 ──
+    constexpr int32 NumSamples = 200000;
+    FRandomStream AliasRand(42);
+    FRandomStream PerEntryRand(43);
+
+    TArray<int32> AliasHits;
+    TArray<int32> PerEntryHits;
+    AliasHits.SetNumZeroed(NumRolled);
+    PerEntryHits.SetNumZeroed(NumRolled);
+    int32 AliasJoint = 0; // 0.5 와 0.75 항목이 함께 나온 횟수 (독립성 확인)
+
+    const FLootAliasChunk& First = Table.Chunks[0];
+    for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+    {
+        for (const FLootAliasChunk& Chunk : Table.Chunks)
+        {
+            const uint32 Mask = Chunk.Sample(AliasRand.GetFraction());
+            for (int32 Bit = 0; Bit < Chunk.NumEntries; ++Bit)
+            {
+                if (Mask & (1u << Bit))
+                {
+                    ++AliasHits[Chunk.FirstEntry - Table.AlwaysCount + Bit];
+                }
+            }
+            if (&Chunk == &First && (Mask & 0x30u) == 0x30u)
+            {
+                ++AliasJoint;
+            }
+        }
+
+        for (int32 i = 0; i < NumRolled; ++i)
+        {
+            if (PerEntryRand.GetFraction() < RolledChances[i])
+            {
+                ++PerEntryHits[i];
+            }
+        }
+    }
+
+    for (int32 i = 0; i < NumRolled; ++i)
+    {
+        const double P = RolledChances[i];
+        const double Sigma = FMath::Sqrt(P * (1.0 - P) / NumSamples);
+        const double AliasFreq = static_cast<double>(AliasHits[i]) / NumSamples;
+        const double PerEntryFreq = static_cast<double>(PerEntryHits[i]) / NumSamples;
+
+        TestTrue(FString::Printf(TEXT("항목 %d (p=%.2f): 앨리어스 빈도 %.4f 가 5σ 안"), i, P, AliasFreq),
+            FMath::Abs(AliasFreq - P) <= 5.0 * Sigma);
+        TestTrue(FString::Printf(TEXT("항목 %d (p=%.2f): 항목별 굴림 빈도 %.4f 가 5σ 안"), i, P, PerEntryFreq),
+            FMath::Abs(PerEntryFreq - P) <= 5.0 * Sigma);
+        TestTrue(FString::Printf(TEXT("항목 %d: 두 방식 차이가 5√2σ 안"), i),
+            FMath::Abs(AliasFreq - PerEntryFreq) <= 5.0 * UE_SQRT_2 * Sigma);
+    }
+
+    const double JointP = static_cast<double>(RolledChances[4]) * RolledChances[5];
+    const double JointSigma = FMath::Sqrt(JointP * (1.0 - JointP) / NumSamples);
+    TestTrue(TEXT("같은 묶음의 두 항목은 독립 (동시 발생 ≈ 곱)"),
+        FMath::Abs(static_cast<double>(AliasJoint) / NumSamples - JointP) <= 5.0 * JointSigma);
+
+    // ── Roll: 확정 항목은 매번, 확률 0 항목은 한 번도 안 나옴 ──
+    int32 AlwaysMissing = 0;
+    int32 NeverDropped = 0;
+    TArray<FLootDrop> Drops;
+    for (int32 i = 0; i < 1000; ++i)
+    {
+        Drops.Reset();
+        Table.Roll(Drops);
+        AlwaysMissing += Drops.ContainsByPredicate([](const FLootDrop& Drop) { return Drop.ItemId == TEXT("Always"); }) ? 0 : 1;
+        NeverDropped += Drops.ContainsByPredicate([](const FLootDrop& Drop) { return Drop.ItemId == TEXT("Never"); }) ? 1 : 0;
+    }
+    TestEqual(TEXT("확정 항목 누락 횟수"), AlwaysMissing, 0);
+    TestEqual(TEXT("확률 0 항목 드롭 횟수"), NeverDropped, 0);
+    return true;
+}
+
+#endif
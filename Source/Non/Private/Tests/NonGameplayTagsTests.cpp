@@ -0,0 +1,135 @@
+#include "Ability/NonGameplayTags.h"
+#include "GameplayTagContainer.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NonGameplayTagsTests
+{
+    struct FNamedTag
+    {
+        const FNativeGameplayTag* Native;
+        const TCHAR* Name;
+    };
+
+    const FNamedTag AllTags[] = {
+        { &NonGameplayTags::State_Attack, TEXT("State.Attack") },
+        { &NonGameplayTags::State_Attacking, TEXT("State.Attacking") },
+        { &NonGameplayTags::State_Combat, TEXT("State.Combat") },
+        { &NonGameplayTags::State_Combat_Dueling, TEXT("State.Combat.Dueling") },
+        { &NonGameplayTags::State_Combo_Ready, TEXT("State.Combo.Ready") },
+        { &NonGameplayTags::State_Dead, TEXT("State.Dead") },
+        { &NonGameplayTags::State_Dodge, TEXT("State.Dodge") },
+        { &NonGameplayTags::State_Guard, TEXT("State.Guard") },
+        { &NonGameplayTags::State_HitReacting, TEXT("State.HitReacting") },
+        { &NonGameplayTags::State_IFrame, TEXT("State.IFrame") },
+        { &NonGameplayTags::State_Invincible, TEXT("State.Invincible") },
+        { &NonGameplayTags::State_Jump, TEXT("State.Jump") },
+        { &NonGameplayTags::State_Skill, TEXT("State.Skill") },
+        { &NonGameplayTags::State_Stunned, TEXT("State.Stunned") },
+        { &NonGameplayTags::State_ToggleWeapon_Root, TEXT("State.ToggleWeapon.Root") },
+        { &NonGameplayTags::Ability_Attack, TEXT("Ability.Attack") },
+        { &NonGameplayTags::Ability_Combo, TEXT("Ability.Combo") },
+        { &NonGameplayTags::Ability_Combo1, TEXT("Ability.Combo1") },
+        { &NonGameplayTags::Ability_Combo2, TEXT("Ability.Combo2") },
+        { &NonGameplayTags::Ability_Combo3, TEXT("Ability.Combo3") },
+        { &NonGameplayTags::Ability_Dodge, TEXT("Ability.Dodge") },
+        { &NonGameplayTags::Ability_Guard, TEXT("Ability.Guard") },
+        { &NonGameplayTags::Ability_ToggleWeapon, TEXT("Ability.ToggleWeapon") },
+        { &NonGameplayTags::Effect_Damage_Critical, TEXT("Effect.Damage.Critical") },
+        { &NonGameplayTags::Effect_Death, TEXT("Effect.Death") },
+        { &NonGameplayTags::Effect_Hit, TEXT("Effect.Hit") },
+        { &NonGameplayTags::Effect_Hit_Light, TEXT("Effect.Hit.Light") },
+        { &NonGameplayTags::Effect_Revive, TEXT("Effect.Revive") },
+        { &NonGameplayTags::Data_Damage, TEXT("Data.Damage") },
+        { &NonGameplayTags::Data_ExpToNextLevel, TEXT("Data.ExpToNextLevel") },
+        { &NonGameplayTags::Data_MaxHP, TEXT("Data.MaxHP") },
+        { &NonGameplayTags::Data_MaxMP, TEXT("Data.MaxMP") },
+        { &NonGameplayTags::Data_StunDuration, TEXT("Data.StunDuration") },
+    };
+    constexpr int32 NumTags = UE_ARRAY_COUNT(AllTags);
+
+    // 네이티브 태그 이전 코드가 하나씩 RequestGameplayTag + HasMatchingGameplayTag 하던 목록
+    const TCHAR* LegacyRotationLockNames[] = {
+        TEXT("State.Dodge"), TEXT("State.Attack"), TEXT("State.Attacking"),
+        TEXT("Ability.Combo"), TEXT("Ability.Combo1"), TEXT("Ability.Combo2"), TEXT("Ability.Combo3"),
+        TEXT("State.Skill"), TEXT("State.HitReacting"), TEXT("State.Stunned"), TEXT("State.Dead"),
+        TEXT("State.ToggleWeapon.Root"),
+    };
+    const TCHAR* LegacyActionBusyNames[] = {
+        TEXT("State.Dodge"), TEXT("State.Attack"), TEXT("Ability.Combo"), TEXT("State.Skill"), TEXT("State.Guard"),
+    };
+
+    bool LegacyHasAny(const FGameplayTagContainer& Owned, TConstArrayView<const TCHAR*> Names)
+    {
+        for (const TCHAR* Name : Names)
+        {
+            if (Owned.HasTag(FGameplayTag::RequestGameplayTag(FName(Name), false)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNonGameplayTagsTest, "Non.Ability.GameplayTags.NativeTagsMatchLegacyLookups",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FNonGameplayTagsTest::RunTest(const FString& Parameters)
+{
+    using namespace NonGameplayTagsTests;
+
+    // ── 1) 네이티브 태그 == 문자열 조회 결과 ──
+    for (const FNamedTag& Tag : AllTags)
+    {
+        TestTrue(FString::Printf(TEXT("%s 등록됨"), Tag.Name), Tag.Native->GetTag().IsValid());
+        TestTrue(FString::Printf(TEXT("%s == RequestGameplayTag"), Tag.Name),
+            Tag.Native->GetTag() == FGameplayTag::RequestGameplayTag(FName(Tag.Name), false));
+    }
+
+    // ── 2) 미리 만든 컨테이너 HasAny == 이전의 태그별 검사 (태그 1~2개 보유한 모든 경우) ──
+    int32 RotationMismatches = 0;
+    int32 BusyMismatches = 0;
+    for (int32 i = 0; i < NumTags; ++i)
+    {
+        for (int32 j = i; j < NumTags; ++j)
+        {
+            FGameplayTagContainer Owned;
+            Owned.AddTag(AllTags[i].Native->GetTag());
+            Owned.AddTag(AllTags[j].Native->GetTag());
+
+            if (Owned.HasAny(NonGameplayTags::GetRotationLockTags()) != LegacyHasAny(Owned, LegacyRotationLockNames))
+            {
+                ++RotationMismatches;
+            }
+            if (Owned.HasAny(NonGameplayTags::GetActionBusyTags()) != LegacyHasAny(Owned, LegacyActionBusyNames))
+            {
+                ++BusyMismatches;
+            }
+        }
+    }
+    TestEqual(TEXT("회전 잠금 판정이 이전과 다른 경우"), RotationMismatches, 0);
+    TestEqual(TEXT("행동 불가 판정이 이전과 다른 경우"), BusyMismatches, 0);
+
+    FGameplayTagContainer Idle;
+    Idle.AddTag(NonGameplayTags::State_Combat);
+    TestFalse(TEXT("전투 상태만으로는 회전 잠금 아님"), Idle.HasAny(NonGameplayTags::GetRotationLockTags()));
+
+    // ── 3) 스킬별 연계 태그: 직접 조회와 같고, 정의 안 된 스킬은 빈 태그 ──
+    const FName SkillIds[] = { TEXT("Slash"), TEXT("Whirlwind"), TEXT("NonGameplayTagsTest_Undefined") };
+    for (const FName SkillId : SkillIds)
+    {
+        const FGameplayTag Direct = FGameplayTag::RequestGameplayTag(
+            FName(*FString::Printf(TEXT("State.Combo.Ready.%s"), *SkillId.ToString())), false);
+        const FGameplayTag First = NonGameplayTags::GetComboReadyTag(SkillId);
+        const FGameplayTag Cached = NonGameplayTags::GetComboReadyTag(SkillId);
+
+        TestTrue(FString::Printf(TEXT("%s: 캐시 태그 == 직접 조회"), *SkillId.ToString()), First == Direct);
+        TestTrue(FString::Printf(TEXT("%s: 두 번째 조회도 같은 태그"), *SkillId.ToString()), Cached == First);
+    }
+    TestFalse(TEXT("정의 안 된 스킬은 빈 태그"), NonGameplayTags::GetComboReadyTag(TEXT("NonGameplayTagsTest_Undefined")).IsValid());
+    return true;
+}
+
+#endif
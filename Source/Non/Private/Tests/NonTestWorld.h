@@ -0,0 +1,59 @@
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Components/BoxComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+/**
+ * 자동화 테스트용 임시 게임 월드
+ * - 생성 시 BeginPlay 까지 진행, 소멸 시 월드 컨텍스트와 함께 정리
+ */
+struct FNonTestWorld
+{
+    UWorld* World = nullptr;
+
+    FNonTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("NonTestWorld"));
+        FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+        Context.SetCurrentWorld(World);
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+    }
+
+    ~FNonTestWorld()
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    FNonTestWorld(const FNonTestWorld&) = delete;
+    FNonTestWorld& operator=(const FNonTestWorld&) = delete;
+
+    /** 틱 한 번 (새로 등록한 충돌체를 쿼리 구조에 반영) */
+    void Tick(float DeltaSeconds = 1.f / 60.f)
+    {
+        World->Tick(LEVELTICK_All, DeltaSeconds);
+    }
+
+    /** 쿼리 전용 박스 하나를 가진 액터 (모든 채널에 Overlap) */
+    AActor* SpawnBox(const FVector& Location, const FRotator& Rotation, const FVector& Extent, ECollisionChannel ObjectType = ECC_Pawn)
+    {
+        AActor* Actor = World->SpawnActor<AActor>();
+        UBoxComponent* Box = NewObject<UBoxComponent>(Actor);
+        Box->SetBoxExtent(Extent, false);
+        Box->SetCollisionObjectType(ObjectType);
+        Box->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+        Box->SetCollisionResponseToAllChannels(ECR_Overlap);
+        Actor->SetRootComponent(Box);
+        Box->RegisterComponent();
+        Actor->SetActorLocationAndRotation(Location, Rotation);
+        return Actor;
+    }
+};
+
+#endif
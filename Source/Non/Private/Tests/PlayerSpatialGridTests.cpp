@@ -0,0 +1,112 @@
+#include "AI/PlayerSpatialGridSubsystem.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PlayerSpatialGridTests
+{
+    /** 플레이어 컨트롤러 + 빙의한 폰 하나 */
+    APawn* SpawnPlayer(UWorld* World, const FVector& Location)
+    {
+        FActorSpawnParameters Params;
+        Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        APlayerController* PC = World->SpawnActor<APlayerController>(Params);
+        APawn* Pawn = World->SpawnActor<APawn>(APawn::StaticClass(), Location, FRotator::ZeroRotator, Params);
+        PC->Possess(Pawn);
+        return Pawn;
+    }
+
+    /** 격자 이전처럼 모든 플레이어를 직접 검사 (반경 안에서 가장 가까운 2D 거리, 없으면 -1) */
+    float BruteNearest(const TArray<APawn*>& Players, const FVector& Origin, float Radius)
+    {
+        float Best = -1.f;
+        for (const APawn* Pawn : Players)
+        {
+            const float Dist = FVector::Dist2D(Origin, Pawn->GetActorLocation());
+            if (Dist <= Radius && (Best < 0.f || Dist < Best))
+            {
+                Best = Dist;
+            }
+        }
+        return Best;
+    }
+
+    /** 플레이어 NumPlayers 명을 흩어 놓고 무작위 조회를 전수 검사와 비교, 어긋난 조회 수 반환 */
+    int32 CountMismatches(FAutomationTestBase& Test, int32 NumPlayers, float Spread, int32 Seed)
+    {
+        FNonTestWorld TestWorld;
+        UWorld* World = TestWorld.World;
+        UPlayerSpatialGridSubsystem* Grid = World->GetSubsystem<UPlayerSpatialGridSubsystem>();
+        if (!Test.TestNotNull(TEXT("플레이어 격자 서브시스템"), Grid)) return -1;
+
+        FRandomStream Rand(Seed);
+        TArray<APawn*> Players;
+        for (int32 i = 0; i < NumPlayers; ++i)
+        {
+            Players.Add(SpawnPlayer(World, FVector(Rand.FRandRange(-Spread, Spread), Rand.FRandRange(-Spread, Spread), Rand.FRandRange(0.f, 500.f))));
+        }
+
+        // 격자는 프레임당 한 번 재구성되므로 배치를 끝낸 뒤 첫 조회
+        if (!Test.TestEqual(TEXT("격자에 들어간 플레이어 수"), Grid->GetNumPlayers(), NumPlayers)) return -1;
+
+        int32 NumMismatches = 0;
+        for (int32 Query = 0; Query < 1000; ++Query)
+        {
+            const FVector Origin(Rand.FRandRange(-Spread, Spread), Rand.FRandRange(-Spread, Spread), 0.f);
+            const float Radius = Rand.FRandRange(100.f, 3000.f);
+
+            const float Expected = BruteNearest(Players, Origin, Radius);
+            float Dist = -1.f;
+            const APawn* Found = Grid->FindNearestPlayer(Origin, Radius, &Dist);
+
+            // 거리가 같은 플레이어가 있을 수 있으므로 폰이 아니라 거리로 비교
+            if ((Found != nullptr) != (Expected >= 0.f)
+                || (Found && (!FMath::IsNearlyEqual(Dist, Expected, 0.1f)
+                    || !FMath::IsNearlyEqual(FVector::Dist2D(Origin, Found->GetActorLocation()), Expected, 0.1f))))
+            {
+                ++NumMismatches;
+            }
+
+            // 반경 제한 없는 거리 (타겟이 없을 때 DistanceKey 갱신용)
+            float AnyDist = -1.f;
+            if (!Grid->GetNearestPlayerDistance2D(Origin, AnyDist)
+                || !FMath::IsNearlyEqual(AnyDist, BruteNearest(Players, Origin, MAX_flt), 0.1f))
+            {
+                ++NumMismatches;
+            }
+        }
+        return NumMismatches;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlayerSpatialGridTest, "Non.AI.PlayerSpatialGrid.NearestMatchesLinearScan",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FPlayerSpatialGridTest::RunTest(const FString& Parameters)
+{
+    using namespace PlayerSpatialGridTests;
+
+    // ── 1) 소수 인원: 셀 수가 플레이어 수보다 많아 전수 검사 경로 ──
+    TestEqual(TEXT("4인: 격자 결과가 전수 검사와 다른 조회 수"), CountMismatches(*this, 4, 5000.f, 7), 0);
+
+    // ── 2) 다수 인원 밀집: 주변 셀만 확인하는 격자 경로 ──
+    TestEqual(TEXT("64인: 격자 결과가 전수 검사와 다른 조회 수"), CountMismatches(*this, 64, 3000.f, 11), 0);
+
+    // ── 3) 플레이어가 없으면 찾지 못함 ──
+    {
+        FNonTestWorld TestWorld;
+        UPlayerSpatialGridSubsystem* Grid = TestWorld.World->GetSubsystem<UPlayerSpatialGridSubsystem>();
+        if (!TestNotNull(TEXT("플레이어 격자 서브시스템"), Grid)) return false;
+
+        float Dist = 0.f;
+        TestNull(TEXT("플레이어 없음"), Grid->FindNearestPlayer(FVector::ZeroVector, 1400.f, &Dist));
+        TestFalse(TEXT("플레이어 없으면 거리 없음"), Grid->GetNearestPlayerDistance2D(FVector::ZeroVector, Dist));
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,120 @@
+#include "Combat/WeaponTraceComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
+#include "Misc/AutomationTest.h"
+#include "ReferenceSkeleton.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace WeaponTraceSocketTests
+{
+    const FName StartSocketName(TEXT("TraceStart"));
+    const FName EndSocketName(TEXT("TraceEnd"));
+
+    UStaticMesh* MakeStaticWeapon()
+    {
+        UStaticMesh* Mesh = NewObject<UStaticMesh>(GetTransientPackage());
+
+        auto AddSocket = [Mesh](FName Name, const FVector& Location)
+        {
+            UStaticMeshSocket* Socket = NewObject<UStaticMeshSocket>(Mesh);
+            Socket->SocketName = Name;
+            Socket->RelativeLocation = Location;
+            Mesh->Sockets.Add(Socket);
+        };
+        AddSocket(StartSocketName, FVector(0.f, 0.f, 10.f));
+        AddSocket(EndSocketName, FVector(0.f, 0.f, 110.f));
+        return Mesh;
+    }
+
+    /** root ─ hand ─ blade, 시작 소켓은 hand 에 붙은 오프셋, 끝은 blade 본 이름 그대로 */
+    USkeletalMesh* MakeSkeletalWeapon(FTransform& OutStartLocal)
+    {
+        USkeletalMesh* Mesh = NewObject<USkeletalMesh>(GetTransientPackage());
+        {
+            FReferenceSkeletonModifier Modifier(Mesh->GetRefSkeleton(), nullptr);
+            Modifier.Add(FMeshBoneInfo(TEXT("root"), TEXT("root"), INDEX_NONE), FTransform::Identity);
+            Modifier.Add(FMeshBoneInfo(TEXT("hand"), TEXT("hand"), 0), FTransform(FVector(0.f, 0.f, 50.f)));
+            Modifier.Add(FMeshBoneInfo(TEXT("blade"), TEXT("blade"), 1), FTransform(FVector(0.f, 0.f, 100.f)));
+        }
+
+        OutStartLocal = FTransform(FRotator(0.f, 90.f, 0.f), FVector(5.f, 0.f, 12.f));
+
+        USkeletalMeshSocket* Socket = NewObject<USkeletalMeshSocket>(Mesh);
+        Socket->SocketName = StartSocketName;
+        Socket->BoneName = TEXT("hand");
+        Socket->RelativeLocation = OutStartLocal.GetLocation();
+        Socket->RelativeRotation = OutStartLocal.Rotator();
+        Mesh->GetMeshOnlySocketList().Add(Socket);
+        Mesh->RebuildSocketMap();
+        return Mesh;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeaponTraceSocketResolveTest, "Non.Combat.WeaponTrace.CachedSocketsMatchNameLookup",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FWeaponTraceSocketResolveTest::RunTest(const FString& Parameters)
+{
+    using namespace WeaponTraceSocketTests;
+
+    FNonTestWorld TestWorld;
+    AActor* Weapon = TestWorld.World->SpawnActor<AActor>();
+
+    // ── 스태틱 메시: 본이 없으므로 이름 조회 경로, 움직여도 GetSocketLocation 과 같아야 함 ──
+    UStaticMeshComponent* StaticComp = NewObject<UStaticMeshComponent>(Weapon);
+    StaticComp->SetMobility(EComponentMobility::Movable);
+    StaticComp->SetStaticMesh(MakeStaticWeapon());
+    Weapon->SetRootComponent(StaticComp);
+    StaticComp->RegisterComponent();
+
+    const FWeaponTraceSockets StaticSockets = FWeaponTraceSockets::Resolve(StaticComp, StartSocketName, EndSocketName);
+    if (!TestTrue(TEXT("스태틱 메시 소켓 해석"), StaticSockets.IsValid())) return false;
+    TestEqual(TEXT("스태틱 메시는 본 인덱스 없음"), StaticSockets.StartBoneIndex, INDEX_NONE);
+
+    const FTransform Poses[] = {
+        FTransform::Identity,
+        FTransform(FRotator(0.f, 45.f, 0.f), FVector(100.f, -50.f, 0.f)),
+        FTransform(FRotator(30.f, -120.f, 10.f), FVector(-300.f, 20.f, 75.f), FVector(1.5f)),
+    };
+    for (const FTransform& Pose : Poses)
+    {
+        StaticComp->SetWorldTransform(Pose);
+
+        FVector Start, End;
+        TestTrue(TEXT("위치 조회"), StaticSockets.GetLocations(Start, End));
+        TestEqual(TEXT("시작 = GetSocketLocation"), Start, StaticComp->GetSocketLocation(StartSocketName), 0.01f);
+        TestEqual(TEXT("끝 = GetSocketLocation"), End, StaticComp->GetSocketLocation(EndSocketName), 0.01f);
+    }
+
+    // 없는 소켓은 해석 실패
+    TestFalse(TEXT("없는 소켓은 무효"), FWeaponTraceSockets::Resolve(StaticComp, StartSocketName, TEXT("Missing")).IsValid());
+    TestFalse(TEXT("컴포넌트 없음은 무효"), FWeaponTraceSockets::Resolve(nullptr, StartSocketName, EndSocketName).IsValid());
+
+    // ── 스켈레탈 메시: 소켓은 부모 본 + 로컬 오프셋, 본 이름은 본 그대로 ──
+    FTransform StartLocal;
+    USkeletalMeshComponent* SkelComp = NewObject<USkeletalMeshComponent>(Weapon);
+    SkelComp->SetSkeletalMeshAsset(MakeSkeletalWeapon(StartLocal));
+
+    const FWeaponTraceSockets SkelSockets = FWeaponTraceSockets::Resolve(SkelComp, StartSocketName, TEXT("blade"));
+    if (!TestTrue(TEXT("스켈레탈 메시 소켓 해석"), SkelSockets.IsValid())) return false;
+    TestEqual(TEXT("시작 소켓의 본 = hand"), SkelSockets.StartBoneIndex, SkelComp->GetBoneIndex(TEXT("hand")));
+    TestTrue(TEXT("시작 소켓 로컬 = 소켓 오프셋"), SkelSockets.StartLocal.Equals(StartLocal, 0.01f));
+    TestEqual(TEXT("끝(본 이름)의 본 = blade"), SkelSockets.EndBoneIndex, SkelComp->GetBoneIndex(TEXT("blade")));
+    TestTrue(TEXT("본 이름은 로컬 오프셋 없음"), SkelSockets.EndLocal.Equals(FTransform::Identity));
+
+    // ── 컴포넌트가 사라지면 위치 조회 실패 → 호출부가 다시 해석 ──
+    StaticComp->DestroyComponent();
+    Weapon->Destroy();
+
+    FVector Start, End;
+    TestFalse(TEXT("파괴된 컴포넌트는 위치 조회 실패"), StaticSockets.GetLocations(Start, End));
+    return true;
+}
+
+#endif
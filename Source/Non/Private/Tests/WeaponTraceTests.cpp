@@ -0,0 +1,113 @@
+#include "Combat/WeaponTraceComponent.h"
+#include "Misc/AutomationTest.h"
+#include "NonTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace WeaponTraceTests
+{
+    // 원점 위 Height 에서 Z 축으로 도는 스윙: 칼날은 반지름 BladeInner → BladeOuter
+    constexpr float Height = 100.f;
+    constexpr float BladeInner = 50.f;
+    constexpr float BladeOuter = 150.f;
+    constexpr float SwingDegrees = 180.f;
+    constexpr float SwingSeconds = 0.2f;
+
+    void BladeAt(float Alpha, FVector& OutStart, FVector& OutEnd)
+    {
+        const FVector Pivot(0.f, 0.f, Height);
+        const FVector Dir = FRotator(0.f, SwingDegrees * Alpha, 0.f).Vector();
+        OutStart = Pivot + Dir * BladeInner;
+        OutEnd = Pivot + Dir * BladeOuter;
+    }
+
+    /** Hz 주기로 스윙 전체를 판정해 맞은 액터 집합 반환 (첫 판정은 현재 자세 한 번, SweepSwing 과 같음) */
+    TSet<const AActor*> RunSwing(UWorld* World, float Hz, const FWeaponSweepParams& Params)
+    {
+        const int32 NumFrames = FMath::RoundToInt(SwingSeconds * Hz);
+
+        TArray<FHitResult> Hits;
+        FVector PrevStart, PrevEnd;
+        BladeAt(0.f, PrevStart, PrevEnd);
+        UWeaponTraceComponent::SweepPoses(World, nullptr, PrevStart, PrevEnd, PrevStart, PrevEnd, Params, Hits);
+
+        for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+        {
+            FVector CurStart, CurEnd;
+            BladeAt(static_cast<float>(Frame) / NumFrames, CurStart, CurEnd);
+            UWeaponTraceComponent::SweepPoses(World, nullptr, PrevStart, PrevEnd, CurStart, CurEnd, Params, Hits);
+            PrevStart = CurStart;
+            PrevEnd = CurEnd;
+        }
+
+        TSet<const AActor*> Result;
+        for (const FHitResult& Hit : Hits)
+        {
+            Result.Add(Hit.GetActor());
+        }
+        return Result;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeaponTraceSubStepCountTest, "Non.Combat.WeaponTrace.SubStepCount",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FWeaponTraceSubStepCountTest::RunTest(const FString& Parameters)
+{
+    const FVector A(0.f, 0.f, 0.f);
+    const FVector B(0.f, 0.f, 100.f);
+
+    TestEqual(TEXT("움직임 없음 → 1"), UWeaponTraceComponent::ComputeNumSubSteps(A, B, A, B, 12.f, 16), 1);
+    TestEqual(TEXT("끝점 이동 100 / 반지름 10 → 10"),
+        UWeaponTraceComponent::ComputeNumSubSteps(A, B, A, B + FVector(100.f, 0.f, 0.f), 10.f, 16), 10);
+    TestEqual(TEXT("두 끝점 중 큰 이동 기준"),
+        UWeaponTraceComponent::ComputeNumSubSteps(A, B, A + FVector(30.f, 0.f, 0.f), B + FVector(55.f, 0.f, 0.f), 10.f, 16), 6);
+    TestEqual(TEXT("상한 적용"),
+        UWeaponTraceComponent::ComputeNumSubSteps(A, B, A, B + FVector(1000.f, 0.f, 0.f), 10.f, 16), 16);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeaponTraceFrameRateTest, "Non.Combat.WeaponTrace.HitSetIndependentOfFrameRate",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FWeaponTraceFrameRateTest::RunTest(const FString& Parameters)
+{
+    using namespace WeaponTraceTests;
+
+    FNonTestWorld TestWorld;
+
+    // 칼날 끝 쪽의 얇은 대상 (접선 방향 두께 1): 반지름 110~130, 15° 간격
+    // 15Hz 에서는 프레임 사이 칼날 중심이 현(chord) 을 따라 안쪽으로 최대 ~13 들어오므로 그 안쪽에 둠
+    const FVector ThinExtent(10.f, 0.5f, 50.f);
+    TSet<const AActor*> Expected;
+    for (float Yaw = 15.f; Yaw < SwingDegrees; Yaw += 15.f)
+    {
+        const FVector Dir = FRotator(0.f, Yaw, 0.f).Vector();
+        Expected.Add(TestWorld.SpawnBox(FVector(0.f, 0.f, Height) + Dir * 120.f, FRotator(0.f, Yaw, 0.f), ThinExtent));
+    }
+
+    // 스윙 범위 밖: 호 바깥 각도 두 개, 칼날 끝(150 + 반지름) 바깥 하나
+    TSet<const AActor*> Outside;
+    Outside.Add(TestWorld.SpawnBox(FVector(0.f, 0.f, Height) + FRotator(0.f, 215.f, 0.f).Vector() * 120.f, FRotator(0.f, 215.f, 0.f), ThinExtent));
+    Outside.Add(TestWorld.SpawnBox(FVector(0.f, 0.f, Height) + FRotator(0.f, 300.f, 0.f).Vector() * 120.f, FRotator(0.f, 300.f, 0.f), ThinExtent));
+    Outside.Add(TestWorld.SpawnBox(FVector(0.f, 0.f, Height) + FRotator(0.f, 90.f, 0.f).Vector() * 200.f, FRotator(0.f, 90.f, 0.f), ThinExtent));
+
+    TestWorld.Tick();
+
+    FWeaponSweepParams Params;
+    Params.Radius = 4.f;
+    Params.Channel = ECC_Pawn;
+
+    const float Rates[] = { 15.f, 30.f, 120.f };
+    for (const float Hz : Rates)
+    {
+        const TSet<const AActor*> Hit = RunSwing(TestWorld.World, Hz, Params);
+
+        TestEqual(FString::Printf(TEXT("%.0fHz: 맞은 수"), Hz), Hit.Num(), Expected.Num());
+        TestTrue(FString::Printf(TEXT("%.0fHz: 얇은 대상 전부 맞음"), Hz), Expected.Difference(Hit).IsEmpty());
+        TestTrue(FString::Printf(TEXT("%.0fHz: 범위 밖 대상은 맞지 않음"), Hz), Outside.Intersect(Hit).IsEmpty());
+    }
+    return true;
+}
+
+#endif
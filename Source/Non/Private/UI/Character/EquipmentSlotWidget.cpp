@@ -176,13 +176,13 @@ void UEquipmentSlotWidget::UpdateVisual(UInventoryItem* Item)
         FLinearColor RarityColor = FLinearColor(0.5f, 0.5f, 0.5f, 1.0f); // 기본 회색 (Common)
         
         // 디자이너가 에디터에서 설정한 RarityColors가 있으면 그것을 최우선적으로 상속받아 칠합니다
-        if (RarityColors.Contains(Item->CachedRow.Rarity))
+        if (RarityColors.Contains(Item->GetRow().Rarity))
         {
-            RarityColor = RarityColors[Item->CachedRow.Rarity];
+            RarityColor = RarityColors[Item->GetRow().Rarity];
         }
         else
         {
-            switch (Item->CachedRow.Rarity)
+            switch (Item->GetRow().Rarity)
             {
                 case EItemRarity::Uncommon:  RarityColor = FLinearColor(0.12f, 0.77f, 0.12f, 1.0f); break; // 고급 (연초록)
                 case EItemRarity::Rare:      RarityColor = FLinearColor(0.0f, 0.47f, 0.95f, 1.0f);  break; // 희귀 (파랑)
@@ -224,9 +224,19 @@ void UEquipmentSlotWidget::UpdateVisual(UInventoryItem* Item)
 
     if (!IconImage) return;
 
-    if (Item && Item->GetIcon())
+    // 캐시에 없으면 로드 완료 전까지 빈 슬롯 가이드 아이콘을 보여주고, 완료 시 컴포넌트 기준으로 다시 그림
+    TWeakObjectPtr<UEquipmentSlotWidget> WeakThis(this);
+    UTexture2D* IconTex = Item ? Item->RequestIcon(FOnIconLoaded::CreateLambda([WeakThis](UTexture2D* Loaded)
     {
-        IconImage->SetBrushFromTexture(Item->GetIcon(), /*bMatchSize*/ true);
+        if (Loaded && WeakThis.IsValid() && WeakThis->OwnerEquipment && !WeakThis->bIsMirror)
+        {
+            WeakThis->RefreshFromComponent();
+        }
+    })) : nullptr;
+
+    if (IconTex)
+    {
+        IconImage->SetBrushFromTexture(IconTex, /*bMatchSize*/ true);
         IconImage->SetBrushTintColor(FSlateColor(FLinearColor::White)); //  추가: Brush Tint도 화이트로
         
         // 대기 고스트 상태일 때는 아이콘의 불투명도를 30% 반투명으로 낮추어 흐릿한 잔상으로 연출합니다
@@ -487,13 +497,13 @@ void UEquipmentSlotWidget::NativeOnDragDetected(
             if (UBorder* Frame = Cast<UBorder>(VW->GetWidgetFromName(TEXT("BorderIconFrame"))))
             {
                 FLinearColor RarityColor = FLinearColor(0.5f, 0.5f, 0.5f, 1.0f); // 기본 회색 (Common)
-                if (RarityColors.Contains(Equipped->CachedRow.Rarity))
+                if (RarityColors.Contains(Equipped->GetRow().Rarity))
                 {
-                    RarityColor = RarityColors[Equipped->CachedRow.Rarity];
+                    RarityColor = RarityColors[Equipped->GetRow().Rarity];
                 }
                 else
                 {
-                    switch (Equipped->CachedRow.Rarity)
+                    switch (Equipped->GetRow().Rarity)
                     {
                         case EItemRarity::Uncommon:  RarityColor = FLinearColor(0.12f, 0.77f, 0.12f, 1.0f); break; // 고급 (연초록)
                         case EItemRarity::Rare:      RarityColor = FLinearColor(0.0f, 0.47f, 0.95f, 1.0f);  break; // 희귀 (파랑)
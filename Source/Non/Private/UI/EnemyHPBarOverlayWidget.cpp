@@ -0,0 +1,42 @@
+#include "UI/EnemyHPBarOverlayWidget.h"
+#include "UI/EnemyHPBarSubsystem.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+void UEnemyHPBarOverlayWidget::NativeConstruct()
+{
+    Super::NativeConstruct();
+
+    SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+int32 UEnemyHPBarOverlayWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+    FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    LayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+    const UEnemyHPBarSubsystem* Bars = Source.Get();
+    if (!Bars) return LayerId;
+
+    const FSlateBrush* White = FCoreStyle::Get().GetBrush(TEXT("WhiteBrush"));
+
+    for (const FEnemyHPBarEntry& Entry : Bars->GetEntries())
+    {
+        if (!Entry.bOnScreen) continue;
+
+        const FVector2D TopLeft = Entry.LocalPosition - Entry.BarSize * 0.5f;
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+            AllottedGeometry.ToPaintGeometry(Entry.BarSize, FSlateLayoutTransform(TopLeft)),
+            White, ESlateDrawEffect::None, Entry.BackgroundColor);
+
+        if (Entry.Ratio > 0.f)
+        {
+            const FVector2D FillSize(Entry.BarSize.X * Entry.Ratio, Entry.BarSize.Y);
+            FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 1,
+                AllottedGeometry.ToPaintGeometry(FillSize, FSlateLayoutTransform(TopLeft)),
+                White, ESlateDrawEffect::None, Entry.FillColor);
+        }
+    }
+
+    return LayerId + 1;
+}
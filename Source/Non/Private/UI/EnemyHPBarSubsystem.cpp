@@ -0,0 +1,193 @@
+#include "UI/EnemyHPBarSubsystem.h"
+#include "UI/EnemyHPBarOverlayWidget.h"
+#include "UI/EnemyHPBarWidget.h"
+#include "Character/EnemyCharacter.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+
+namespace
+{
+    // 데미지 숫자(-1) 아래에 그림
+    constexpr int32 HPBarOverlayZOrder = -2;
+
+    const FIntPoint OffScreenPixel(MIN_int32, MIN_int32);
+}
+
+bool UEnemyHPBarSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UEnemyHPBarSubsystem::Deinitialize()
+{
+    if (Overlay)
+    {
+        Overlay->RemoveFromParent();
+        Overlay = nullptr;
+    }
+    Entries.Reset();
+    IndexByEnemy.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UEnemyHPBarSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyHPBarSubsystem, STATGROUP_Tickables);
+}
+
+UEnemyHPBarSubsystem* UEnemyHPBarSubsystem::Find(const AEnemyCharacter* Enemy)
+{
+    const UWorld* World = Enemy ? Enemy->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UEnemyHPBarSubsystem>() : nullptr;
+}
+
+void UEnemyHPBarSubsystem::SetBarVisible(const AEnemyCharacter* Enemy, bool bVisible, float Ratio)
+{
+    UEnemyHPBarSubsystem* Bars = Find(Enemy);
+    if (!Bars) return;
+
+    const int32* Found = Bars->IndexByEnemy.Find(Enemy);
+    if (!bVisible)
+    {
+        if (Found)
+        {
+            Bars->RemoveAt(*Found);
+        }
+        return;
+    }
+
+    if (Found)
+    {
+        SetBarRatio(Enemy, Ratio);
+        return;
+    }
+
+    // 위치는 다음 Tick 에서 투영 (그 전까지는 화면 밖 취급)
+    Bars->IndexByEnemy.Add(Enemy, Bars->Entries.Num());
+    FEnemyHPBarEntry& Entry = Bars->Entries.AddDefaulted_GetRef();
+    Entry.Enemy = Enemy;
+    Entry.Key = Enemy;
+    Entry.Ratio = FMath::Clamp(Ratio, 0.f, 1.f);
+
+    if (const UEnemyHPBarWidget* Style = Enemy->GetHPBarStyle())
+    {
+        Entry.FillColor = Style->GetFillColor();
+        Entry.BackgroundColor = Style->GetBackgroundColor();
+        Entry.BarSize = Style->GetBarSize();
+    }
+}
+
+void UEnemyHPBarSubsystem::SetBarRatio(const AEnemyCharacter* Enemy, float Ratio)
+{
+    UEnemyHPBarSubsystem* Bars = Find(Enemy);
+    if (!Bars) return;
+
+    if (const int32* Found = Bars->IndexByEnemy.Find(Enemy))
+    {
+        FEnemyHPBarEntry& Entry = Bars->Entries[*Found];
+        const float Clamped = FMath::Clamp(Ratio, 0.f, 1.f);
+        if (Entry.Ratio != Clamped)
+        {
+            Entry.Ratio = Clamped;
+            if (Entry.bOnScreen)
+            {
+                Bars->MarkDirty();
+            }
+        }
+    }
+}
+
+void UEnemyHPBarSubsystem::RemoveAt(int32 Index)
+{
+    if (!Entries.IsValidIndex(Index)) return;
+
+    if (Entries[Index].bOnScreen)
+    {
+        MarkDirty();
+    }
+
+    // 마지막 항목을 빈 자리로 옮기고 인덱스 갱신 (파괴된 적이어도 키로 찾을 수 있음)
+    IndexByEnemy.Remove(Entries[Index].Key);
+    const int32 Last = Entries.Num() - 1;
+    if (Index != Last)
+    {
+        IndexByEnemy.Add(Entries[Last].Key, Index);
+    }
+    Entries.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UEnemyHPBarSubsystem::EnsureOverlay(APlayerController* PC)
+{
+    if (Overlay && Overlay->GetOwningPlayer() == PC) return;
+
+    if (Overlay)
+    {
+        Overlay->RemoveFromParent();
+    }
+
+    Overlay = CreateWidget<UEnemyHPBarOverlayWidget>(PC, UEnemyHPBarOverlayWidget::StaticClass());
+    if (Overlay)
+    {
+        Overlay->SetSource(this);
+        Overlay->AddToPlayerScreen(HPBarOverlayZOrder);
+    }
+}
+
+void UEnemyHPBarSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (Entries.Num() > 0)
+    {
+        APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
+        if (!PC) return;
+
+        EnsureOverlay(PC);
+
+        const FVector ViewLoc = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetCameraLocation() : PC->GetFocalLocation();
+        const float MaxDistSq = FMath::Square(MaxDrawDistance);
+        const float ViewportScale = FMath::Max(UWidgetLayoutLibrary::GetViewportScale(PC), KINDA_SMALL_NUMBER);
+
+        for (int32 i = Entries.Num() - 1; i >= 0; --i)
+        {
+            const AEnemyCharacter* Enemy = Entries[i].Enemy.Get();
+            if (!Enemy)
+            {
+                RemoveAt(i);
+                continue;
+            }
+
+            FEnemyHPBarEntry& Entry = Entries[i];
+            const FVector WorldLoc = Enemy->GetHPBarWorldLocation();
+
+            // 거리 → 최근 렌더링 여부(가려짐/프러스텀 밖) → 투영 순으로 컬링
+            FVector2D ScreenPos;
+            const bool bShow = FVector::DistSquared(ViewLoc, WorldLoc) <= MaxDistSq
+                && Enemy->WasRecentlyRendered(VisibleTolerance)
+                && PC->ProjectWorldLocationToScreen(WorldLoc, ScreenPos, true);
+
+            const FIntPoint Pixel = bShow
+                ? FIntPoint(FMath::RoundToInt(ScreenPos.X), FMath::RoundToInt(ScreenPos.Y))
+                : OffScreenPixel;
+
+            // 같은 픽셀이면 다시 그릴 필요 없음
+            if (bShow != Entry.bOnScreen || Pixel != Entry.Pixel)
+            {
+                Entry.bOnScreen = bShow;
+                Entry.Pixel = Pixel;
+                Entry.LocalPosition = bShow ? FVector2D(Pixel) / ViewportScale : FVector2D::ZeroVector;
+                MarkDirty();
+            }
+        }
+    }
+
+    if (bDirty && Overlay)
+    {
+        Overlay->Invalidate(EInvalidateWidgetReason::Paint);
+    }
+    bDirty = false;
+}
@@ -383,9 +383,9 @@ void UInventorySlotWidget::NativeOnDragDetected(
             if (UBorder* Frame = Cast<UBorder>(VW->GetWidgetFromName(TEXT("BorderIconFrame"))))
             {
                 FLinearColor RarityColor = FLinearColor(0.5f, 0.5f, 0.5f, 1.0f);
-                if (RarityColors.Contains(Item->CachedRow.Rarity))
+                if (RarityColors.Contains(Item->GetRow().Rarity))
                 {
-                    RarityColor = RarityColors[Item->CachedRow.Rarity];
+                    RarityColor = RarityColors[Item->GetRow().Rarity];
                 }
                 Frame->SetBrushColor(RarityColor);
 
@@ -615,12 +615,13 @@ void UInventorySlotWidget::TryUseThisItem()
     // 사용 직후 최신 상태 확인은 필요 시 작성
 }
 
-void UInventorySlotWidget::InitSlot(UInventoryComponent* InInventory, int32 InIndex)
+void UInventorySlotWidget::InitSlot(UInventoryComponent* InInventory, int32 InIndex, bool bBindInventoryEvents)
 {
     if (OwnerInventory)
     {
         OwnerInventory->OnSlotUpdated.RemoveAll(this);
         OwnerInventory->OnInventoryRefreshed.RemoveAll(this);
+        OwnerInventory->OnCooldownStarted.RemoveAll(this);
     }
 
     OwnerInventory = InInventory;
@@ -628,15 +629,24 @@ void UInventorySlotWidget::InitSlot(UInventoryComponent* InInventory, int32 InIn
 
     if (OwnerInventory)
     {
-        OwnerInventory->OnSlotUpdated.AddDynamic(this, &UInventorySlotWidget::HandleSlotUpdated);
-        OwnerInventory->OnInventoryRefreshed.AddDynamic(this, &UInventorySlotWidget::HandleInventoryRefreshed);
+        // [New] 소유 위젯이 인덱스 테이블로 갱신을 전달하면 슬롯마다 구독하지 않음
+        // (슬롯 하나가 바뀔 때 모든 슬롯 위젯이 깨어나는 것 방지)
+        if (bBindInventoryEvents)
+        {
+            OwnerInventory->OnSlotUpdated.AddDynamic(this, &UInventorySlotWidget::HandleSlotUpdated);
+            OwnerInventory->OnInventoryRefreshed.AddDynamic(this, &UInventorySlotWidget::HandleInventoryRefreshed);
+        }
         OwnerInventory->OnCooldownStarted.AddDynamic(this, &UInventorySlotWidget::OnInventoryCooldownStarted);
     }
 
     // [이중 안전장치] 인스턴스가 런타임에 조립될 때도 델리게이트가 절대 풀리지 않도록 재바인딩해 줍니다.
     ToolTipWidgetDelegate.BindDynamic(this, &UInventorySlotWidget::GetCustomToolTipWidget);
 
-    RefreshFromInventory();
+    // 소유 위젯이 관리하는 슬롯은 소유 위젯의 전체 갱신 한 번으로 채움
+    if (bBindInventoryEvents)
+    {
+        RefreshFromInventory();
+    }
 }
 
 void UInventorySlotWidget::HandleSlotUpdated(int32 UpdatedIndex, UInventoryItem* UpdatedItem)
@@ -786,29 +796,50 @@ void UInventorySlotWidget::UpdateCooldownTick()
 void UInventorySlotWidget::OnInventoryCooldownStarted(FName GroupId, float Duration, float EndTime)
 {
     if (!Item) return;
-    if (Item->CachedRow.ItemType == EItemType::Consumable &&
-        Item->CachedRow.Consumable.CooldownGroupId == GroupId)
+    if (Item->GetRow().ItemType == EItemType::Consumable &&
+        Item->GetRow().Consumable.CooldownGroupId == GroupId)
     {
         StartCooldown(Duration, EndTime);
     }
 }
 
+void UInventorySlotWidget::SetIconTexture(UTexture2D* IconTex)
+{
+    if (!ImgIcon) return;
+
+    if (IconTex)
+    {
+        FSlateBrush Brush = ImgIcon->GetBrush();
+        Brush.SetResourceObject(IconTex);
+        ImgIcon->SetBrush(Brush);
+        ImgIcon->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+    }
+    else
+    {
+        ImgIcon->SetBrush(FSlateBrush());
+        ImgIcon->SetVisibility(ESlateVisibility::Hidden);
+    }
+}
+
 void UInventorySlotWidget::UpdateVisual()
 {
     if (ImgIcon)
     {
-        if (UTexture2D* IconTex = (Item ? Item->GetIcon() : nullptr))
-        {
-            FSlateBrush Brush = ImgIcon->GetBrush();
-            Brush.SetResourceObject(IconTex);
-            ImgIcon->SetBrush(Brush);
-            ImgIcon->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
-        }
-        else
+        UTexture2D* IconTex = nullptr;
+        if (Item)
         {
-            ImgIcon->SetBrush(FSlateBrush());
-            ImgIcon->SetVisibility(ESlateVisibility::Hidden);
+            // 캐시에 없으면 로드 완료 시 브러시만 교체 (그 사이 슬롯 아이템이 바뀌었으면 무시)
+            TWeakObjectPtr<UInventorySlotWidget> WeakThis(this);
+            TWeakObjectPtr<UInventoryItem> Requested(Item);
+            IconTex = Item->RequestIcon(FOnIconLoaded::CreateLambda([WeakThis, Requested](UTexture2D* Loaded)
+            {
+                if (WeakThis.IsValid() && Requested.IsValid() && WeakThis->Item == Requested.Get())
+                {
+                    WeakThis->SetIconTexture(Loaded);
+                }
+            }));
         }
+        SetIconTexture(IconTex);
     }
 
     if (TxtCount)
@@ -837,9 +868,9 @@ void UInventorySlotWidget::UpdateVisual()
     // Cooldown Check
     if (Item && OwnerInventory)
     {
-        if (Item->CachedRow.ItemType == EItemType::Consumable)
+        if (Item->GetRow().ItemType == EItemType::Consumable)
         {
-            const FName GID = Item->CachedRow.Consumable.CooldownGroupId;
+            const FName GID = Item->GetRow().Consumable.CooldownGroupId;
             float Rem = 0.f, Tot = 0.f;
             if (OwnerInventory->GetCooldownRemaining(GID, Rem, Tot))
             {
@@ -874,7 +905,7 @@ void UInventorySlotWidget::UpdateVisual()
 
         if (Item)
         {
-            EItemRarity Rarity = Item->CachedRow.Rarity;
+            EItemRarity Rarity = Item->GetRow().Rarity;
             if (RarityColors.Contains(Rarity))
             {
                 TargetColor = RarityColors[Rarity];
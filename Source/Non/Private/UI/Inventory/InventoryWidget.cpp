@@ -43,6 +43,14 @@ void UInventoryWidget::NativeDestruct()
     Super::NativeDestruct();
 }
 
+void UInventoryWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    // 창이 숨겨져 있는 동안에는 틱이 돌지 않으므로, 다시 보일 때 한 번에 반영됨
+    FlushPendingRefresh();
+}
+
 void UInventoryWidget::SetInventory(UInventoryComponent* InInventory)
 {
     if (InvRef == InInventory)
@@ -106,8 +114,8 @@ void UInventoryWidget::InitSlots()
         UInventorySlotWidget* SlotWidget = CreateWidget<UInventorySlotWidget>(this, SlotWidgetClass);
         if (!SlotWidget) continue;
 
-        // 여기서 한 줄로 초기화 + 델리게이트 바인딩까지 처리
-        SlotWidget->InitSlot(InvRef, Index);
+        // 슬롯 갱신은 이 위젯이 인덱스로 직접 전달하므로 슬롯별 구독은 하지 않음
+        SlotWidget->InitSlot(InvRef, Index, false);
 
         const int32 Row = Columns > 0 ? Index / Columns : 0;
         const int32 Col = Columns > 0 ? Index % Columns : Index;
@@ -144,10 +152,15 @@ void UInventoryWidget::ClearSlots()
         Grid->ClearChildren();
     }
     Slots.Empty();
+    DirtySlots.Reset();
+    bFullRefreshPending = false;
 }
 
 void UInventoryWidget::RefreshAll()
 {
+    DirtySlots.Reset();
+    bFullRefreshPending = false;
+
     for (int32 i = 0; i < Slots.Num(); ++i)
     {
         if (UInventorySlotWidget* S = Slots[i])
@@ -162,17 +175,38 @@ void UInventoryWidget::RefreshAll()
 
 void UInventoryWidget::HandleSlotUpdated(int32 Index, UInventoryItem* /*Item*/)
 {
-    if (!Slots.IsValidIndex(Index)) return;
-    if (UInventorySlotWidget* S = Slots[Index])
-    {
-        S->RefreshFromInventory();
-    }
-    ApplyFilter();
+    if (!Slots.IsValidIndex(Index) || bFullRefreshPending) return;
+
+    // 같은 프레임에 여러 번 바뀌어도 해당 슬롯 위젯만 한 번 갱신
+    if (DirtySlots.Num() < Slots.Num()) DirtySlots.SetNum(Slots.Num(), false);
+    DirtySlots[Index] = true;
 }
 
 void UInventoryWidget::HandleInventoryRefreshed()
 {
-    RefreshAll();
+    bFullRefreshPending = true;
+}
+
+void UInventoryWidget::FlushPendingRefresh()
+{
+    if (bFullRefreshPending)
+    {
+        RefreshAll();
+        return;
+    }
+
+    for (TConstSetBitIterator<> It(DirtySlots); It; ++It)
+    {
+        const int32 Index = It.GetIndex();
+        if (!Slots.IsValidIndex(Index)) continue;
+
+        if (UInventorySlotWidget* S = Slots[Index])
+        {
+            S->RefreshFromInventory();
+            ApplyFilterToSlot(S);
+        }
+    }
+    DirtySlots.Reset();
 }
 
 bool UInventoryWidget::NativeOnDragOver(const FGeometry& InGeometry, const FDragDropEvent& InDragDropEvent,
@@ -281,29 +315,33 @@ void UInventoryWidget::ApplyFilter()
 {
     for (int32 i = 0; i < Slots.Num(); ++i)
     {
-        UInventorySlotWidget* SlotWidget = Slots[i];
-        if (!SlotWidget) continue;
+        ApplyFilterToSlot(Slots[i]);
+    }
+}
+
+void UInventoryWidget::ApplyFilterToSlot(UInventorySlotWidget* SlotWidget) const
+{
+    if (!SlotWidget) return;
 
-        if (!bIsFilterActive)
+    if (!bIsFilterActive)
+    {
+        // 필터가 해제되어 있으면 모든 슬롯을 환하고 상호작용 가능하게 원상 복귀
+        SlotWidget->SetFilterState(false);
+    }
+    else
+    {
+        // 필터가 켜져 있으면
+        UInventoryItem* SlotItem = SlotWidget->Item;
+        if (SlotItem)
         {
-            // 필터가 해제되어 있으면 모든 슬롯을 환하고 상호작용 가능하게 원상 복귀
-            SlotWidget->SetFilterState(false);
+            // 아이템 대분류가 활성 필터와 일치하면 활성, 다르면 필터아웃(회색조/반투명) 처리!
+            const bool bMatch = (SlotItem->GetRow().ItemType == ActiveFilterType);
+            SlotWidget->SetFilterState(!bMatch);
         }
         else
         {
-            // 필터가 켜져 있으면
-            UInventoryItem* SlotItem = SlotWidget->Item;
-            if (SlotItem)
-            {
-                // 아이템 대분류가 활성 필터와 일치하면 활성, 다르면 필터아웃(회색조/반투명) 처리!
-                const bool bMatch = (SlotItem->CachedRow.ItemType == ActiveFilterType);
-                SlotWidget->SetFilterState(!bMatch);
-            }
-            else
-            {
-                // 빈 슬롯은 필터 조건에 무조건 맞지 않으므로 톤다운 처리!
-                SlotWidget->SetFilterState(true);
-            }
+            // 빈 슬롯은 필터 조건에 무조건 맞지 않으므로 톤다운 처리!
+            SlotWidget->SetFilterState(true);
         }
     }
 }
\ No newline at end of file
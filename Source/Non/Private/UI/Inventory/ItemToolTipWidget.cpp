@@ -16,12 +16,12 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
         // 강화 수치가 있으면 이름 뒤에 "+3" 형태로 세련되게 붙여줍니다.
         if (InItem->EnhancementLevel > 0)
         {
-            FString EncStr = FString::Printf(TEXT("%s (+%d)"), *InItem->CachedRow.Name.ToString(), InItem->EnhancementLevel);
+            FString EncStr = FString::Printf(TEXT("%s (+%d)"), *InItem->GetRow().Name.ToString(), InItem->EnhancementLevel);
             TxtItemName->SetText(FText::FromString(EncStr));
         }
         else
         {
-            TxtItemName->SetText(InItem->CachedRow.Name);
+            TxtItemName->SetText(InItem->GetRow().Name);
         }
     }
 
@@ -33,32 +33,33 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     if (TxtPrice)
     {
         // 3자리마다 자동으로 쉼표가 찍히는 멋진 가격 포맷 (예: "15,000 Gold")
-        FString PriceStr = FString::Printf(TEXT("%s Gold"), *FText::AsNumber(InItem->CachedRow.BuyPrice).ToString());
+        FString PriceStr = FString::Printf(TEXT("%s Gold"), *FText::AsNumber(InItem->GetRow().BuyPrice).ToString());
         TxtPrice->SetText(FText::FromString(PriceStr));
     }
 
     // ── [New] 5. 아이콘 이미지 셋팅 ──────────────────────
     if (ImgIcon)
     {
-        UTexture2D* IconTex = InItem->GetIcon();
-        if (IconTex)
+        // 캐시에 없으면 로드 완료 전까지 숨겨 두고 콜백에서 채움 (툴팁 표시 시 동기 로드 히치 방지)
+        DisplayedItem = InItem;
+        TWeakObjectPtr<UItemToolTipWidget> WeakThis(this);
+        TWeakObjectPtr<UInventoryItem> WeakItem(InItem);
+        SetIconTexture(InItem->RequestIcon(FOnIconLoaded::CreateLambda([WeakThis, WeakItem](UTexture2D* Loaded)
         {
-            ImgIcon->SetBrushFromTexture(IconTex);
-            ImgIcon->SetVisibility(ESlateVisibility::Visible);
-        }
-        else
-        {
-            ImgIcon->SetVisibility(ESlateVisibility::Collapsed);
-        }
+            if (WeakThis.IsValid() && WeakItem.IsValid() && WeakThis->DisplayedItem == WeakItem)
+            {
+                WeakThis->SetIconTexture(Loaded);
+            }
+        })));
     }
 
     // ── [New] 5.5 장비 세부 능력치(Main Stats) 자동 가공 및 실시간 비교 주입 ──────────
     if (TxtMainStats)
     {
-        if (InItem->CachedRow.ItemType == EItemType::Equipment)
+        if (InItem->GetRow().ItemType == EItemType::Equipment)
         {
             FString StatStr;
-            const FEquipmentStatBlock& SB = InItem->CachedRow.StatBlock;
+            const FEquipmentStatBlock& SB = InItem->GetRow().StatBlock;
 
             // 실시간 동일 부위 장착 장비 스탯 비교
             UInventoryItem* EquippedItem = nullptr;
@@ -143,7 +144,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
                 return Line;
             };
 
-            const FEquipmentStatBlock& EquippedSB = EquippedItem ? EquippedItem->CachedRow.StatBlock : FEquipmentStatBlock();
+            const FEquipmentStatBlock& EquippedSB = EquippedItem ? EquippedItem->GetRow().StatBlock : FEquipmentStatBlock();
 
             StatStr += FormatStatLine(TEXT("물리 공격력"), SB.AttackPower, EquippedSB.AttackPower, false, true);
             StatStr += FormatStatLine(TEXT("물리 방어력"), SB.DefensePower, EquippedSB.DefensePower, false, false);
@@ -174,7 +175,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     }
 
     // ── [New] 6. 세트 아이템 정보 가공 및 텍스트 셋팅 ─────────────────
-    if (InItem->CachedRow.bIsSetItem)
+    if (InItem->GetRow().bIsSetItem)
     {
         // ── [UX 혁신 3단계] 플레이어 캐릭터로부터 현재 장착한 동일 세트 장비 개수 실시간 카운팅!
         int32 EquippedSetCount = 0;
@@ -185,7 +186,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
                 for (const auto& Pair : EquipComp->Equipped)
                 {
                     UInventoryItem* EquippedItem = Pair.Value;
-                    if (EquippedItem && EquippedItem->CachedRow.bIsSetItem && EquippedItem->CachedRow.SetId == InItem->CachedRow.SetId)
+                    if (EquippedItem && EquippedItem->GetRow().bIsSetItem && EquippedItem->GetRow().SetId == InItem->GetRow().SetId)
                     {
                         EquippedSetCount++;
                     }
@@ -195,7 +196,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
 
         // 최대 세트 아이템 수(N) 실시간 연산 (기입된 세트 효과 중 최댓값 추적)
         int32 MaxSetPieces = 0;
-        for (const FSetBonusEntry& Entry : InItem->CachedRow.SetBonuses)
+        for (const FSetBonusEntry& Entry : InItem->GetRow().SetBonuses)
         {
             if (Entry.PiecesRequired > MaxSetPieces)
             {
@@ -206,7 +207,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
         // 세트 전용 식별 명칭 텍스트블록 연동 세팅 (장착중인 카드일 경우에만 분수비 (X / N) 노출!)
         if (TxtSetName)
         {
-            FString SetNameStr = FString::Printf(TEXT("세트: [%s]"), *InItem->CachedRow.SetId.ToString());
+            FString SetNameStr = FString::Printf(TEXT("세트: [%s]"), *InItem->GetRow().SetId.ToString());
             if (bIsComparePanel)
             {
                 SetNameStr += FString::Printf(TEXT(" (%d / %d)"), EquippedSetCount, MaxSetPieces);
@@ -235,7 +236,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
 
         // 동일 필요 개수별 효과 그룹화
         TMap<int32, TArray<FString>> GroupedBonuses;
-        for (const FSetBonusEntry& Entry : InItem->CachedRow.SetBonuses)
+        for (const FSetBonusEntry& Entry : InItem->GetRow().SetBonuses)
         {
             FString RawTagName = Entry.BonusEffectTag.GetTagName().ToString();
             FString KoreanEffect = TranslateTagToKorean(RawTagName);
@@ -276,7 +277,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     else
     {
         // ── [UX 혁신] 장비 아이템인데 세트 템이 아닌 경우에만 '세트 효과 없음' 을 띄우도록 가공!
-        if (InItem->CachedRow.ItemType == EItemType::Equipment)
+        if (InItem->GetRow().ItemType == EItemType::Equipment)
         {
             if (TxtSetName)
             {
@@ -305,13 +306,13 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     FText RarityText = FText::FromString(TEXT("일반"));
 
     // 디자이너가 에디터에서 설정한 RarityColors가 있으면 그것을 최우선적으로 상속받아 칠합니다
-    if (RarityColors.Contains(InItem->CachedRow.Rarity))
+    if (RarityColors.Contains(InItem->GetRow().Rarity))
     {
-        RarityColor = RarityColors[InItem->CachedRow.Rarity];
+        RarityColor = RarityColors[InItem->GetRow().Rarity];
     }
     else
     {
-        switch (InItem->CachedRow.Rarity)
+        switch (InItem->GetRow().Rarity)
         {
             case EItemRarity::Uncommon:  RarityColor = FLinearColor(0.12f, 0.77f, 0.12f, 1.0f); break; // 연초록색
             case EItemRarity::Rare:      RarityColor = FLinearColor(0.0f, 0.47f, 0.95f, 1.0f);  break; // 푸른색 (파랑)
@@ -323,7 +324,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     }
 
     // 등급 텍스트 매칭은 안정적으로 기존 체계 유지
-    switch (InItem->CachedRow.Rarity)
+    switch (InItem->GetRow().Rarity)
     {
         case EItemRarity::Uncommon:  RarityText = FText::FromString(TEXT("고급")); break;
         case EItemRarity::Rare:      RarityText = FText::FromString(TEXT("희귀")); break;
@@ -337,12 +338,12 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     if (TxtItemRarity)
     {
         FString TypeStr;
-        if (InItem->CachedRow.ItemType == EItemType::Equipment)
+        if (InItem->GetRow().ItemType == EItemType::Equipment)
         {
             // 1. 만약 무기 종류가 지정되어 있다면 무기 상세 종류로 변환
-            if (InItem->CachedRow.WeaponType != EWeaponType::None)
+            if (InItem->GetRow().WeaponType != EWeaponType::None)
             {
-                switch (InItem->CachedRow.WeaponType)
+                switch (InItem->GetRow().WeaponType)
                 {
                     case EWeaponType::OneHanded: TypeStr = TEXT("한손 검"); break;
                     case EWeaponType::TwoHanded: TypeStr = TEXT("양손 검"); break;
@@ -370,7 +371,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
         }
         else
         {
-            switch (InItem->CachedRow.ItemType)
+            switch (InItem->GetRow().ItemType)
             {
                 case EItemType::Consumable:  TypeStr = TEXT("소비품"); break;
                 case EItemType::Material:    TypeStr = TEXT("재료"); break;
@@ -437,7 +438,7 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     if (!bIsComparePanel && CompareToolTipWidget)
     {
         UInventoryItem* EquippedCompareItem = nullptr;
-        if (InItem->CachedRow.ItemType == EItemType::Equipment)
+        if (InItem->GetRow().ItemType == EItemType::Equipment)
         {
             if (APawn* PlayerPawn = GetOwningPlayerPawn())
             {
@@ -470,3 +471,18 @@ void UItemToolTipWidget::SetItemData(UInventoryItem* InItem)
     }
 }
 
+
+void UItemToolTipWidget::SetIconTexture(UTexture2D* IconTex)
+{
+    if (!ImgIcon) return;
+
+    if (IconTex)
+    {
+        ImgIcon->SetBrushFromTexture(IconTex);
+        ImgIcon->SetVisibility(ESlateVisibility::Visible);
+    }
+    else
+    {
+        ImgIcon->SetVisibility(ESlateVisibility::Collapsed);
+    }
+}
@@ -94,9 +94,18 @@ void UQuickSlotSlotWidget::UpdateVisual(UInventoryItem* Item)
 
     if (IconImage)
     {
-        if (Item && Item->GetIcon())
+        // 캐시에 없으면 로드 완료 시 슬롯을 다시 그림 (그 전에는 아래 플레이스홀더 경로)
+        TWeakObjectPtr<UQuickSlotSlotWidget> WeakThis(this);
+        UTexture2D* NewTex = Item ? Item->RequestIcon(FOnIconLoaded::CreateLambda([WeakThis](UTexture2D* Loaded)
+        {
+            if (Loaded && WeakThis.IsValid() && WeakThis->Manager.IsValid())
+            {
+                WeakThis->Refresh();
+            }
+        })) : nullptr;
+
+        if (NewTex)
         {
-            UTexture2D* NewTex = Item->GetIcon();
 
             // BP에서 설정한 Rounded Box 브러시 유지 + 텍스처만 교체
             FSlateBrush Brush = IconImage->GetBrush();
@@ -166,7 +175,7 @@ void UQuickSlotSlotWidget::UpdateVisual(UInventoryItem* Item)
         // 현재 상태 확인
         if (BoundInventoryComp.IsValid())
         {
-            const FName GroupId = Item->CachedRow.Consumable.CooldownGroupId;
+            const FName GroupId = Item->GetRow().Consumable.CooldownGroupId;
             float Val = 0.f, TotalDuration = 0.f;
             if (BoundInventoryComp->GetCooldownRemaining(GroupId, Val, TotalDuration))
             {
@@ -209,7 +218,7 @@ void UQuickSlotSlotWidget::OnInventoryCooldownStarted(FName GroupId, float Durat
     if (!Manager.IsValid() || QuickIndex < 0) return;
     
     UInventoryItem* Item = Manager->ResolveItem(QuickIndex);
-    if (Item && Item->CachedRow.Consumable.CooldownGroupId == GroupId)
+    if (Item && Item->GetRow().Consumable.CooldownGroupId == GroupId)
     {
         StartCooldown(Duration, EndTime);
     }
@@ -409,16 +418,17 @@ bool UQuickSlotSlotWidget::NativeOnDrop(const FGeometry& G, const FDragDropEvent
 
         AssignedSkillId = SkillOp->SkillId;
 
-        // 아이콘 로드
-        UTexture2D* IconTex = nullptr;
-        if (!SkillOp->Icon.IsNull())
-        {
-            IconTex = SkillOp->Icon.Get();
-            if (!IconTex)
+        // 아이콘 로드 (캐시에 없으면 로드 완료 시 스킬 데이터 기준으로 다시 그림)
+        TWeakObjectPtr<UQuickSlotSlotWidget> WeakThis(this);
+        const FName DroppedSkillId = AssignedSkillId;
+        UTexture2D* IconTex = UIconCacheSubsystem::Resolve(this, SkillOp->Icon,
+            FOnIconLoaded::CreateLambda([WeakThis, DroppedSkillId](UTexture2D* Loaded)
             {
-                IconTex = SkillOp->Icon.LoadSynchronous();
-            }
-        }
+                if (Loaded && WeakThis.IsValid() && WeakThis->AssignedSkillId == DroppedSkillId)
+                {
+                    WeakThis->UpdateSkillIconFromData();
+                }
+            }));
 
         if (IconImage && IconTex)
         {
@@ -761,14 +771,16 @@ void UQuickSlotSlotWidget::UpdateSkillIconFromData()
                     
                     if (const FSkillRow* Row = DA->Skills.Find(SkillToShow))
                     {
-                        if (!Row->Icon.IsNull())
-                        {
-                            NewTex = Row->Icon.Get();
-                            if (!NewTex)
+                        // 캐시에 없으면 로드 완료 시 다시 호출 (콤보 스위칭 중이면 그때 기준으로 다시 고름)
+                        TWeakObjectPtr<UQuickSlotSlotWidget> WeakThis(this);
+                        NewTex = UIconCacheSubsystem::Resolve(this, Row->Icon,
+                            FOnIconLoaded::CreateLambda([WeakThis](UTexture2D* Loaded)
                             {
-                                NewTex = Row->Icon.LoadSynchronous();
-                            }
-                        }
+                                if (Loaded && WeakThis.IsValid())
+                                {
+                                    WeakThis->UpdateSkillIconFromData();
+                                }
+                            }));
                     }
                 }
             }
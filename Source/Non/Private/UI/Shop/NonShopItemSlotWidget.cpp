@@ -5,6 +5,8 @@
 #include "Inventory/InventoryComponent.h"
 #include "Data/ItemStructs.h"
 #include "Engine/DataTable.h"
+#include "System/ItemDefinitionSubsystem.h"
+#include "System/IconCacheSubsystem.h"
 
 void UNonShopItemSlotWidget::InitializeSlot(FName InItemId, UInventoryComponent* InPlayerInventory)
 {
@@ -13,8 +15,8 @@ void UNonShopItemSlotWidget::InitializeSlot(FName InItemId, UInventoryComponent*
 
     if (!PlayerInventory.IsValid() || !PlayerInventory->ItemDataTable) return;
 
-    const FItemRow* ItemRow = PlayerInventory->ItemDataTable->FindRow<FItemRow>(ItemId, TEXT("ShopSlotLoad"));
-    if (!ItemRow) return;
+    const FItemDefinitionHandle ItemRow = UItemDefinitionSubsystem::Resolve(PlayerInventory.Get(), ItemId, PlayerInventory->ItemDataTable);
+    if (!ItemRow.IsValid()) return;
 
     if (TextBlock_ItemName)
     {
@@ -29,7 +31,17 @@ void UNonShopItemSlotWidget::InitializeSlot(FName InItemId, UInventoryComponent*
 
     if (Image_Icon && !ItemRow->Icon.IsNull())
     {
-        UTexture2D* LoadedIcon = ItemRow->Icon.LoadSynchronous();
+        // 상점 목록을 한 번에 채울 때 동기 로드 히치 방지: 캐시에 없으면 로드 완료 시 교체
+        TWeakObjectPtr<UNonShopItemSlotWidget> WeakThis(this);
+        const FName RequestedId = ItemId;
+        UTexture2D* LoadedIcon = UIconCacheSubsystem::Resolve(this, ItemRow->Icon,
+            FOnIconLoaded::CreateLambda([WeakThis, RequestedId](UTexture2D* Loaded)
+            {
+                if (Loaded && WeakThis.IsValid() && WeakThis->ItemId == RequestedId && WeakThis->Image_Icon)
+                {
+                    WeakThis->Image_Icon->SetBrushFromTexture(Loaded);
+                }
+            }));
         if (LoadedIcon)
         {
             Image_Icon->SetBrushFromTexture(LoadedIcon);
@@ -5,9 +5,8 @@
 #include "Components/Image.h"
 #include "Components/SizeBox.h"
 #include "Components/TextBlock.h"
-#include "Engine/AssetManager.h"
-#include "Engine/StreamableManager.h"
 #include "Skill/SkillManagerComponent.h"
+#include "System/IconCacheSubsystem.h"
 #include "UI/Skill/SkillDragDropOperation.h"
 #include "UI/Skill/SkillWindowWidget.h"
 #include "UI/UIViewportUtils.h"
@@ -166,19 +165,15 @@ void USkillSlotWidget::Refresh() {
 
   // === 아이콘 ===
   if (IconImage) {
-    if (Row.Icon.IsNull()) {
-      IconImage->SetBrush(FSlateBrush());
+    // 캐시에 없으면 로드 완료 전까지 비워 두고 완료 시 OnIconLoaded 에서 채움
+    UTexture2D *Tex = UIconCacheSubsystem::Resolve(
+        this, Row.Icon,
+        FOnIconLoaded::CreateWeakLambda(
+            this, [this](UTexture2D *) { OnIconLoaded(); }));
+    if (Tex) {
+      IconImage->SetBrushFromTexture(Tex, /*bMatchSize=*/false);
     } else {
-      if (UTexture2D *Tex = Row.Icon.Get()) {
-        IconImage->SetBrushFromTexture(Tex, /*bMatchSize=*/false);
-      } else if (UTexture2D *TexSync = Row.Icon.LoadSynchronous()) {
-        IconImage->SetBrushFromTexture(TexSync, /*bMatchSize=*/false);
-      } else {
-        FStreamableManager &SM = UAssetManager::GetStreamableManager();
-        SM.RequestAsyncLoad(Row.Icon.ToSoftObjectPath(),
-                            FStreamableDelegate::CreateUObject(
-                                this, &USkillSlotWidget::OnIconLoaded));
-      }
+      IconImage->SetBrush(FSlateBrush());
     }
   }
 
@@ -286,13 +281,8 @@ void USkillSlotWidget::NativeOnDragDetected(const FGeometry &InGeometry,
   Op->Icon = Row.Icon;
 
   // === DragVisual (아이콘 고스트) ===
-  UTexture2D *IconTex = nullptr;
-  if (!Row.Icon.IsNull()) {
-    IconTex = Row.Icon.Get();
-    if (!IconTex) {
-      IconTex = Row.Icon.LoadSynchronous();
-    }
-  }
+  // 슬롯에 보이는 아이콘이면 이미 캐시에 있음
+  UTexture2D *IconTex = UIconCacheSubsystem::Resolve(this, Row.Icon);
 
   if (IconTex) {
     UImage *Img = NewObject<UImage>(this);
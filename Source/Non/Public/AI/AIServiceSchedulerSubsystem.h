@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIServiceSchedulerSubsystem.generated.h"
+
+class UBehaviorTreeComponent;
+class UBTService_Scheduled;
+struct FBTScheduledServiceMemory;
+
+/** 스케줄링 우선순위 (낮은 값이 먼저 실행) */
+UENUM(BlueprintType)
+enum class EAIServicePriority : uint8
+{
+    Combat  UMETA(DisplayName = "Combat (Aggro)"),
+    Near    UMETA(DisplayName = "Near Player"),
+    Far     UMETA(DisplayName = "Far / Idle"),
+    Num     UMETA(Hidden)
+};
+
+/** 스케줄러 통계 */
+USTRUCT(BlueprintType)
+struct FAIServiceSchedulerStats
+{
+    GENERATED_BODY()
+
+    /** 지난 프레임 실행된 서비스 수 */
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int32 ExecutedLastFrame = 0;
+
+    /** 지난 프레임 예산 초과로 다음 프레임으로 미뤄진 수 */
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int32 DeferredLastFrame = 0;
+
+    /** 지난 프레임 건너뛴 요청 수 (원거리 간격 조절, 중복 요청, 비활성 노드) */
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int32 SkippedLastFrame = 0;
+
+    /** 지난 프레임 서비스 실행에 쓴 시간 (ms) */
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    float LastFrameMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int64 TotalExecuted = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int64 TotalDeferred = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int64 TotalSkipped = 0;
+};
+
+/**
+ * 월드 단위 AI 서비스 스케줄러
+ * - UBTService_Scheduled 파생 서비스들의 실행 요청을 모아 프레임 예산(ms) 안에서 실행
+ * - 어그로 중인 적 > 플레이어 근처 적 > 원거리/대기 적 순서, 원거리 적은 요청 일부를 건너뜀
+ * - 캠프 리스폰처럼 한 프레임에 몰리는 요청을 여러 프레임으로 분산
+ */
+UCLASS()
+class NON_API UAIServiceSchedulerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** 서비스 실행 요청 (UBTService_Scheduled::TickNode 에서 호출) */
+    void RequestUpdate(UBehaviorTreeComponent& OwnerComp, UBTService_Scheduled& Service, FBTScheduledServiceMemory& Memory);
+
+    /** 프레임당 서비스 실행 예산 (ms) */
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    void SetFrameBudgetMs(float InBudgetMs) { FrameBudgetMs = FMath::Max(0.f, InBudgetMs); }
+
+    UFUNCTION(BlueprintPure, Category = "AI|Scheduler")
+    float GetFrameBudgetMs() const { return FrameBudgetMs; }
+
+    UFUNCTION(BlueprintPure, Category = "AI|Scheduler")
+    const FAIServiceSchedulerStats& GetStats() const { return Stats; }
+
+    UFUNCTION(BlueprintPure, Category = "AI|Scheduler")
+    int32 GetNumPending() const { return Pending.Num(); }
+
+    /** 이 거리(2D) 안에 플레이어가 있으면 Near 우선순위 */
+    float NearPlayerRadius = 3000.f;
+
+    /** 우선순위별 실행 간격 배수 (N 번 요청 중 1 번만 실행) */
+    int32 RequestStride[static_cast<int32>(EAIServicePriority::Num)] = { 1, 1, 3 };
+
+    /** 이 프레임 수 이상 밀린 요청은 예산과 관계없이 실행 (기아 방지) */
+    int32 MaxDeferredFrames = 4;
+
+private:
+    struct FPendingRequest
+    {
+        TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp;
+        TWeakObjectPtr<UBTService_Scheduled> Service;
+        EAIServicePriority Priority = EAIServicePriority::Far;
+        uint64 RequestFrame = 0;
+    };
+
+    EAIServicePriority ClassifyOwner(const UBehaviorTreeComponent& OwnerComp) const;
+
+    /** 요청을 실행. 노드가 더 이상 유효/활성이 아니면 false */
+    bool ExecuteRequest(const FPendingRequest& Request);
+
+    TArray<FPendingRequest> Pending;
+
+    float FrameBudgetMs = 1.0f;
+
+    FAIServiceSchedulerStats Stats;
+
+    // 다음 Tick 에서 지난 프레임 통계로 넘길 RequestUpdate 단계 건너뜀 수
+    int32 SkippedSinceTick = 0;
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BTService.h"
+#include "BTService_Scheduled.generated.h"
+
+/**
+ * 스케줄러 관리 서비스의 노드 메모리 공통부
+ * - 파생 서비스의 메모리 구조체는 이 구조체를 상속해야 함
+ */
+struct FBTScheduledServiceMemory
+{
+    /** 아직 실행되지 않은 누적 DeltaSeconds */
+    float PendingDeltaSeconds = 0.f;
+
+    /** 마지막 실행 이후 무시된 요청 수 (원거리 적 간격 조절용) */
+    int32 RequestsSinceRun = 0;
+
+    /** 스케줄러 대기열에 올라가 있는지 */
+    bool bQueued = false;
+};
+
+/**
+ * 월드 AI 서비스 스케줄러(UAIServiceSchedulerSubsystem)를 거쳐 실행되는 서비스 베이스
+ * - Interval 이 되면 바로 실행하지 않고 스케줄러에 요청만 등록
+ * - 실제 로직은 스케줄러가 프레임 예산 안에서 TickScheduled 로 호출
+ */
+UCLASS(Abstract)
+class NON_API UBTService_Scheduled : public UBTService
+{
+    GENERATED_BODY()
+
+public:
+    /** 끄면 기존처럼 Interval 마다 즉시 실행 */
+    UPROPERTY(EditAnywhere, Category = "Scheduling")
+    bool bUseScheduler = true;
+
+    /** 스케줄러가 실행을 허가했을 때 호출 (NodeMemory 는 이 서비스의 인스턴스 메모리) */
+    virtual void TickScheduled(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) {}
+
+protected:
+    virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override final;
+    virtual uint16 GetInstanceMemorySize() const override { return sizeof(FBTScheduledServiceMemory); }
+    virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+};
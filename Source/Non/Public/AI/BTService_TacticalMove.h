@@ -1,16 +1,25 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/BTService_Scheduled.h"
 #include "BTService_TacticalMove.generated.h"
 
+/** 적 인스턴스별 상태 (노드 객체는 모든 적이 공유하므로 노드 메모리에 보관) */
+struct FBTTacticalMoveMemory : public FBTScheduledServiceMemory
+{
+    /** 마지막으로 보낸 후보 질의 세대 (결과의 세대가 다르면 버림) */
+    uint32 QueryGeneration = 0;
+};
+
 /**
  * 전술적 이동 (비전투 걷기/대기가 아닌, 전투 중 위치 선정)
  * - Strafe: 타겟을 중심으로 회전 이동
  * - KeepDistance: 타겟과 일정 거리 유지 (Backstep)
+ * - 후보 지점 투영은 UNavQueryBatchSubsystem 에서 모아서 처리 (결과 도착 시 블랙보드 기록)
+ * - 결과가 늦게 와도 그 사이 새 질의를 보냈거나 서비스가 비활성화됐으면 기록하지 않음
  */
 UCLASS(meta = (DisplayName = "Tactical Move (C++)"))
-class NON_API UBTService_TacticalMove : public UBTService
+class NON_API UBTService_TacticalMove : public UBTService_Scheduled
 {
     GENERATED_BODY()
     
@@ -45,9 +54,18 @@ public:
     bool bDebugDraw = false;
 
 protected:
-    virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual void TickScheduled(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+    virtual uint16 GetInstanceMemorySize() const override { return sizeof(FBTTacticalMoveMemory); }
+    virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
 
 private:
-    bool GetStrafeLocation(UWorld* World, const FVector& Origin, const FVector& Target, FVector& OutLoc) const;
-    bool GetBackstepLocation(UWorld* World, const FVector& Origin, const FVector& Target, FVector& OutLoc) const;
+    /** 질의를 보낸 서비스 인스턴스가 아직 활성이고 그 뒤로 새 질의/비활성화가 없었는지 */
+    static bool IsQueryCurrent(UBehaviorTreeComponent* OwnerComp, UBTService_TacticalMove* Service, uint32 Generation);
+
+    /** 좌우 이동 후보 (NavMesh 배치 질의용) */
+    void BuildStrafeCandidates(const FVector& Origin, const FVector& Target, TArray<FVector>& OutCandidates) const;
+
+    /** 뒤로 물러날 후보 (NavMesh 배치 질의용) */
+    void BuildBackstepCandidates(const FVector& Origin, const FVector& Target, TArray<FVector>& OutCandidates) const;
 };
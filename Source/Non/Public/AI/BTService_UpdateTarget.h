@@ -1,9 +1,16 @@
 #pragma once
-#include "BehaviorTree/BTService.h"
+#include "AI/BTService_Scheduled.h"
 #include "BTService_UpdateTarget.generated.h"
 
+/** 적 인스턴스별 상태 (노드 객체는 모든 적이 공유하므로 노드 메모리에 보관) */
+struct FBTUpdateTargetMemory : public FBTScheduledServiceMemory
+{
+    /** 마지막 타겟 상태 전환 시각 */
+    float LastSwitchTime = -1.f;
+};
+
 UCLASS(meta = (DisplayName = "Update Target (C++)"))
-class NON_API UBTService_UpdateTarget : public UBTService
+class NON_API UBTService_UpdateTarget : public UBTService_Scheduled
 {
     GENERATED_BODY()
 public:
@@ -41,9 +48,7 @@ public:
     float HomeLeashRadius = 2500.f;
 
 protected:
-    virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
-
-private:
-    /** 마지막 타겟 상태 전환 시각 */
-    float LastSwitchTime = -1.f;
+    virtual void TickScheduled(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual uint16 GetInstanceMemorySize() const override { return sizeof(FBTUpdateTargetMemory); }
+    virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
 };
@@ -1,5 +1,5 @@
 ﻿#pragma once
-#include "BehaviorTree/BTService.h"
+#include "AI/BTService_Scheduled.h"
 #include "BTService_WanderInRadius.generated.h"
 
 UENUM(BlueprintType)
@@ -10,7 +10,7 @@ enum class EWanderCenterSource : uint8
 };
 
 UCLASS(meta = (DisplayName = "Wander In Radius (C++)"))
-class NON_API UBTService_WanderInRadius : public UBTService
+class NON_API UBTService_WanderInRadius : public UBTService_Scheduled
 {
     GENERATED_BODY()
 public:
@@ -52,7 +52,7 @@ public:
     float DebugDrawTime = 1.5f;
 
 protected:
-    virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+    virtual void TickScheduled(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 
 private:
     // 컨트롤러별 마지막 갱신시간 캐시
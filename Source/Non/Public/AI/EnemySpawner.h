@@ -44,18 +44,50 @@ public:
     UPROPERTY(EditAnywhere, Category = "Spawn|Refill", meta = (EditCondition = "bAutoRefill", ClampMin = "0.1"))
     float RefillInterval = 3.f;
 
+    // --- 풀 모드 ---
+    // 죽은 적을 파괴하지 않고 숨겨 두었다가 컨트롤러/ASC/MID 와 함께 재사용
+    UPROPERTY(EditAnywhere, Category = "Spawn|Pool")
+    bool bUsePooling = false;
+
+    // 보관할 최대 개수 (초과분은 기존처럼 파괴)
+    UPROPERTY(EditAnywhere, Category = "Spawn|Pool", meta = (EditCondition = "bUsePooling", ClampMin = "0"))
+    int32 MaxPoolSize = 5;
+
+    // 페이드 아웃이 끝난 적을 풀에 반환 (받지 않으면 false → 호출자가 파괴)
+    bool ReleaseToPool(AEnemyCharacter* Enemy);
+
+    // 풀에서 재사용한 스폰 수
+    UFUNCTION(BlueprintPure, Category = "Spawn|Pool")
+    int32 GetPoolHits() const { return PoolHits; }
+
+    // 풀이 비어 새로 SpawnActor 한 수 (풀 모드일 때만 집계)
+    UFUNCTION(BlueprintPure, Category = "Spawn|Pool")
+    int32 GetPoolMisses() const { return PoolMisses; }
+
+    UFUNCTION(BlueprintPure, Category = "Spawn|Pool")
+    int32 GetNumPooled() const { return Pool.Num(); }
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
     UPROPERTY()
     TArray<TWeakObjectPtr<AEnemyCharacter>> Alive;
 
+    // 재사용 대기 중인 적 (숨김 상태)
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<AEnemyCharacter>> Pool;
+
+    int32 PoolHits = 0;
+    int32 PoolMisses = 0;
+
     FTimerHandle RespawnTimer;
     FTimerHandle RefillTimer;
 
     void TryInitialSpawn();
     void TrySpawnOne();
+    bool TrySpawnFromPool(const FVector& SpawnLoc, const FRotator& SpawnRot, float HalfHeight, float Radius);
     FVector PickSpawnPoint() const;
 
     UFUNCTION()
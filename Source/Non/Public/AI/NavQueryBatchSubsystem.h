@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NavQueryBatchSubsystem.generated.h"
+
+/**
+ * 후보 지점 묶음 질의
+ * - Candidates 를 NavMesh 에 투영한 뒤 점수가 가장 좋은(낮은) 지점 하나를 콜백으로 전달
+ * - 점수 = |ScoreTarget 까지 2D 거리 - DesiredDistance| + 투영 보정 거리 * SnapPenalty
+ */
+struct FNavCandidateQuery
+{
+    /** 같은 Owner 의 대기 중 질의는 새 질의로 교체됨 (보통 AIController) */
+    TWeakObjectPtr<const UObject> Owner;
+
+    /** 우선순위 순서의 후보 지점 (동점이면 앞쪽 선택) */
+    TArray<FVector> Candidates;
+
+    FVector ProjectExtent = FVector(100.f, 100.f, 100.f);
+
+    FVector ScoreTarget = FVector::ZeroVector;
+    float DesiredDistance = 0.f;
+    float SnapPenalty = 1.f;
+
+    /** 게임 스레드에서 호출. 투영에 모두 실패하면 bFound=false */
+    TFunction<void(bool bFound, const FVector& Location)> OnResolved;
+};
+
+/**
+ * NavMesh 투영 질의 일괄 처리기
+ * - 서비스는 질의를 제출만 하고 즉시 반환 (블로킹 없음)
+ * - 매 프레임 대기 중인 모든 후보를 하나의 BatchProjectPoints 로 처리하고 결과를 콜백으로 전달
+ * - 프레임당 처리 지점 수 상한으로 대규모 전투 시 부하를 여러 프레임에 분산
+ */
+UCLASS()
+class NON_API UNavQueryBatchSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** 질의 제출 (같은 Owner 의 이전 질의는 취소) */
+    void SubmitQuery(FNavCandidateQuery&& Query);
+
+    /** Owner 의 대기 중 질의 취소 */
+    void CancelQueries(const UObject* Owner);
+
+    UFUNCTION(BlueprintPure, Category = "AI|Navigation")
+    int32 GetNumPendingQueries() const { return Pending.Num(); }
+
+    /** 프레임당 투영할 최대 지점 수 (최소 1개 질의는 항상 처리) */
+    int32 MaxPointsPerFrame = 96;
+
+private:
+    TArray<FNavCandidateQuery> Pending;
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerSpatialGridSubsystem.generated.h"
+
+class APawn;
+
+/**
+ * 플레이어 폰 공간 격자 (AI 타겟 탐색용)
+ * - 프레임마다 첫 조회 시 살아 있는 플레이어 폰으로 2D 격자를 한 번만 재구성
+ * - 적 AI 는 주변 셀만 확인하므로 적 1마리당 비용이 플레이어 수와 무관하게 일정
+ * - 단, 확인할 셀 수가 플레이어 수보다 많으면 전수 검사가 더 싸므로 전수 검사
+ *   (감지 반경 1400 이면 셀 9~16개 → 4인 협동에서는 항상 전수 검사, 격자는 대략 16명 이상일 때 쓰임)
+ */
+UCLASS()
+class NON_API UPlayerSpatialGridSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** 격자 셀 크기 (cm). 일반적인 감지 반경과 비슷하게 */
+    static constexpr float CellSize = 1000.f;
+
+    /**
+     * Origin 기준 Radius(2D) 안에서 가장 가까운 살아 있는 플레이어 폰
+     * @param OutDist2D 찾은 경우 2D 거리
+     */
+    APawn* FindNearestPlayer(const FVector& Origin, float Radius, float* OutDist2D = nullptr);
+
+    /** 반경 제한 없이 가장 가까운 살아 있는 플레이어까지 2D 거리 (플레이어가 없으면 false) */
+    bool GetNearestPlayerDistance2D(const FVector& Origin, float& OutDist2D);
+
+    /** 이번 프레임 격자에 포함된 플레이어 폰 수 */
+    int32 GetNumPlayers();
+
+private:
+    struct FPlayerEntry
+    {
+        TWeakObjectPtr<APawn> Pawn;
+        FVector2D Location = FVector2D::ZeroVector;
+    };
+
+    void RebuildIfStale();
+
+    static FIntPoint ToCell(const FVector2D& Location)
+    {
+        return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+    }
+
+    TArray<FPlayerEntry> Players;
+    TMap<FIntPoint, TArray<int32>> Cells;
+    uint64 BuiltFrame = MAX_uint64;
+};
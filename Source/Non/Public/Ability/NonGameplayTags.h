@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+/**
+ * 프로젝트 공용 네이티브 게임플레이 태그
+ * - 모듈 로드 시 한 번 등록되므로 핫패스에서 RequestGameplayTag 문자열 조회가 필요 없음
+ * - 여러 태그를 함께 검사하는 곳은 미리 만든 컨테이너로 HasAny 한 번에 처리
+ */
+namespace NonGameplayTags
+{
+    // ── State ──
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Attack);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Attacking);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Combat);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Combat_Dueling);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Combo_Ready);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Dead);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Dodge);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Guard);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_HitReacting);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_IFrame);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Invincible);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Jump);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Skill);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Stunned);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_ToggleWeapon_Root);
+
+    // ── Ability ──
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Attack);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Combo);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Combo1);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Combo2);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Combo3);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Dodge);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_Guard);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Ability_ToggleWeapon);
+
+    // ── Effect ──
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Effect_Damage_Critical);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Effect_Death);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Effect_Hit);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Effect_Hit_Light);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Effect_Revive);
+
+    // ── SetByCaller ──
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Damage);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_ExpToNextLevel);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_MaxHP);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_MaxMP);
+    NON_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_StunDuration);
+
+    /** 이동 회전을 잠그는 상태 (공격/회피/콤보/스킬/피격/스턴/사망/무기 전환) */
+    NON_API const FGameplayTagContainer& GetRotationLockTags();
+
+    /** 입력으로 새 행동을 시작할 수 없는 상태 (회피/공격/콤보/스킬/가드) */
+    NON_API const FGameplayTagContainer& GetActionBusyTags();
+
+    /**
+     * 스킬별 연계 대기 태그 (State.Combo.Ready.<SkillId>)
+     * - 스킬마다 한 번만 조회해서 캐시. 태그가 정의되지 않은 스킬이면 빈 태그
+     */
+    NON_API FGameplayTag GetComboReadyTag(FName SkillId);
+}
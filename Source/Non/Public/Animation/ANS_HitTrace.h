@@ -5,12 +5,16 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Combat/NonDamageHelpers.h" 
 #include "GameplayTagContainer.h"
+#include "Combat/WeaponTraceComponent.h"
 #include "ANS_HitTrace.generated.h"
 
 /**
- * 무기 소켓(시작/끝) 기준으로 구체 스윕(SphereTrace) 하여 타격 판정
+ * 무기 소켓(시작/끝) 기준으로 캡슐 스윕 하여 타격 판정
  * - 서버 전용 판정(기본값): bServerOnly=true
  * - 한 NotifyState 동안 같은 액터는 한 번만 타격: bSingleHitPerActor=true
+ * - 스윙별 상태(맞은 액터, 이전 프레임 소켓 위치)는 Owner 의 UWeaponTraceComponent 에 보관
+ *   (노티파이 객체는 같은 몽타주를 쓰는 모든 메시가 공유하므로 멤버에 두면 안 됨)
+ * - 이전 프레임 → 현재 프레임 사이를 끝점 이동량 / Radius 만큼 나눠 보간 스윕 (빠른 스윙/낮은 FPS 관통 방지)
  * - 무기 메시 자동 탐색: PreferredComponentTag 우선, 없으면 소켓 존재하는 다른 SkeletalMeshComponent 검색
  * - 데미지 적용:
  *    * bUseGASDamage=true 이면 AEnemyCharacter::ApplyDamage 호출(없으면 무시)
@@ -45,6 +49,10 @@ public:
     UPROPERTY(EditAnywhere, Category = "HitTrace")
     TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Pawn;
 
+    // 이전 프레임과 현재 프레임 사이 보간 스윕 횟수 상한 (실제 횟수는 소켓 이동량 / Radius)
+    UPROPERTY(EditAnywhere, Category = "HitTrace", meta = (ClampMin = "1", ClampMax = "64"))
+    int32 MaxSubSteps = 16;
+
     // 서버에서만 판정할지(권장)
     UPROPERTY(EditAnywhere, Category = "HitTrace")
     bool bServerOnly = true;
@@ -112,14 +120,8 @@ public:
     FName PreferredComponentTag;
 
 private:
-    // 찾은 소켓 소유 컴포넌트 캐시
-    TWeakObjectPtr<USceneComponent> SocketOwnerComp;
-
-    // 중복 타격 방지용
-    TSet<TWeakObjectPtr<AActor>> HitActors;
-
-    // 소켓 소유 컴포넌트 찾기
-    USceneComponent* ResolveSocketOwner(USkeletalMeshComponent* MeshComp) const;
+    // 소켓 소유 컴포넌트 찾기 (장착 무기는 UEquipmentComponent 캐시 사용)
+    FWeaponTraceSockets ResolveTraceSockets(USkeletalMeshComponent* MeshComp) const;
 
     bool IsValidTarget(AActor* Other) const;
 
@@ -30,6 +30,6 @@ public:
   UNiagaraSystem *TrailSystem;
 
 private:
-  // 헬퍼 함수: 태그를 통해 무기 액터에 붙어있는 현재 나이아가라 컴포넌트 찾기
-  UNiagaraComponent *FindTrailComponent(class AActor *WeaponActor) const;
+  // 헬퍼 함수: 장비 컴포넌트에 캐시된 현재 메인 무기 트레일 찾기
+  UNiagaraComponent *FindTrailComponent(class UEquipmentComponent *EqComp) const;
 };
@@ -11,6 +11,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBossPhaseChanged, int32, NewPhase
 
 class UBossDataAsset;
 class UGameplayAbility;
+struct FOnAttributeChangeData;
 
 UCLASS()
 class NON_API ABossCharacter : public AEnemyCharacter
@@ -65,6 +66,10 @@ public:
     UFUNCTION()
     void EndPhaseTransition();
 
+    // [New] 페이즈 전환 연출 (서버가 ApplyPhase 후 모든 클라이언트에 전파)
+    UFUNCTION(NetMulticast, Reliable)
+    void Multicast_PhaseChanged(int32 NewPhase);
+
 protected:
     UFUNCTION()
     virtual void OnUIZoneOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, 
@@ -76,4 +81,15 @@ protected:
                                     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 
     void CheckPhaseTransition();
+
+    // [New] HP 어트리뷰트 변경 시 페이즈 검사 (서버 전용, HUD 갱신과 무관)
+    void OnHealthChangedForPhase(const FOnAttributeChangeData& Data);
+
+    // [New] PhaseList 로부터 전환 체력 비율 정리 (인덱스 i = Phase i+1 → i+2, 내림차순)
+    void BuildPhaseBreakpoints();
+
+    // 연출만 재생 (몽타주 + 이벤트)
+    void HandlePhaseChanged(int32 NewPhase);
+
+    TArray<float> PhaseBreakpoints;
 };
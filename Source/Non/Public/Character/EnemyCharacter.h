@@ -16,7 +16,6 @@ class UAbilitySystemComponent;
 class UNonAbilitySystemComponent;
 class UNonAttributeSet;
 class UGameplayEffect;
-class UWidgetComponent;
 class ADamageNumberActor;
 class UBoxComponent;
 class USphereComponent;
@@ -24,6 +23,9 @@ class UEnemyDataAsset;
 class UEnemyDataAsset;
 class ANonCharacterBase;
 class UGameplayAbility; // [Fix] Forward declaration
+class AEnemySpawner;
+class UEnemyHPBarWidget;
+struct FEnemyPartBoneTable;
 
 UENUM(BlueprintType)
 enum class EAggroStyle : uint8
@@ -58,7 +60,6 @@ public:
 
 protected:
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaSeconds) override;
     bool bDied = false;
 
 public:
@@ -68,6 +69,12 @@ public:
     // HP바 갱신
     virtual void UpdateHPBar() const;
 
+    // 머리 위 HP바 위치 (공용 HP바 오버레이가 투영)
+    FVector GetHPBarWorldLocation() const;
+
+    // 머리 위 HP바 스타일 (HPBarStyleClass 기본값, 미지정이면 UEnemyHPBarWidget 기본값)
+    const UEnemyHPBarWidget* GetHPBarStyle() const;
+
     //  EnemyDataAsset으로부터 값 세팅
     UFUNCTION(BlueprintCallable, Category = "Config")
     void InitFromDataAsset(const UEnemyDataAsset* InData);
@@ -113,6 +120,7 @@ public:
     float AttackPowerScale = 1.0f;
 
     void SetAggro(bool bNewAggro);
+    bool IsAggro() const { return bAggro; }
     void TryStartAttack();
 
     // [Legacy Removed] PlayAttackMontage, PickAttackMontage (Moved to GA_EnemyAttack)
@@ -225,9 +233,8 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Spawn|FadeIn")
     bool IsSpawnFading() const { return bSpawnFadeActive; }
 
-    // 페이드 시작/틱/종료
-    void BeginSpawnFade(float DurationSeconds);
-    void TickSpawnFade();
+    // 페이드 종료 (타이머) / 페이드 인 종료 후 AI 재개
+    void OnFadeTimelineFinished();
     void OnSpawnFadeFinished();
 
 
@@ -237,8 +244,13 @@ public:
     UPROPERTY(EditAnywhere, Category = "Spawn|FadeIn", meta = (ClampMin = "0.05", ClampMax = "20.0"))
     float SpawnFadeDuration = 0.6f;
 
-    UPROPERTY(EditAnywhere, Category = "Spawn|FadeIn")
-    FName FadeParamName = TEXT("Fade");
+    /**
+     * 페이드 타임라인을 넣을 커스텀 프리미티브 데이터 시작 인덱스
+     * - [Index] = 시작 시각(월드 시간), [Index + 1] = 길이 (음수면 페이드 아웃)
+     * - 머티리얼이 Time 노드로 직접 계산하므로 MID/틱 없이 동작
+     */
+    UPROPERTY(EditAnywhere, Category = "Spawn|FadeIn", meta = (ClampMin = "0"))
+    int32 FadeCustomDataIndex = 0;
 
     UPROPERTY(EditAnywhere, Category = "Spawn|FadeOut", meta = (ClampMin = "0.5", ClampMax = "10.0"))
     float CorpseFadeOutDuration = 3.0f;
@@ -276,8 +288,17 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "GAS|Abilities")
     TArray<TSubclassOf<UGameplayAbility>> DefaultAbilities;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
-    TObjectPtr<UWidgetComponent> HPBarWidget;
+    // [Changed] 적마다 WidgetComponent 를 두지 않고 UEnemyHPBarSubsystem 오버레이에 등록해서 그림
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI|HPBar")
+    bool bUseOverheadHPBar = true;
+
+    // 메시 기준 HP바 높이 (cm)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI|HPBar")
+    float HPBarHeight = 120.f;
+
+    // HP바 색/크기를 가져올 위젯 클래스 (예전 HPBar 컴포넌트에 지정하던 WBP, 위젯을 만들지는 않고 기본값만 읽음)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI|HPBar")
+    TSubclassOf<UEnemyHPBarWidget> HPBarStyleClass;
 
     public:
     // [New] GAS GA_Death에서 호출할 함수들 (Public)
@@ -287,6 +308,20 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Combat|Death")
     void StartRagdoll();
 
+    // ───── Pooling (AEnemySpawner 풀 모드) ─────
+
+    // 풀을 관리하는 스포너 등록 (페이드 아웃이 끝나면 Destroy 대신 스포너에 반환)
+    void SetOwningSpawner(AEnemySpawner* InSpawner) { OwningSpawner = InSpawner; }
+
+    // 풀 보관 상태로 전환: 숨김 + 충돌/틱 끔 (Server Only)
+    void DeactivateForPool();
+
+    // 풀에서 꺼내 데이터에셋 기본값으로 리셋 후 재활성화, 컨트롤러/MID 재사용 (Server Only)
+    void ActivateFromPool(const FVector& Location, const FRotator& Rotation);
+
+    UFUNCTION(BlueprintPure, Category = "Spawn|Pool")
+    bool IsInPool() const { return bInPool; }
+
 protected:
     void HandleDeath(); // Legacy Internal
     void BindAttributeDelegates();
@@ -400,10 +435,7 @@ private:
     TWeakObjectPtr<ANonCharacterBase> LastDamageInstigator;
 
     //Fade
-    void InitSpawnFadeMIDs();
-
-    UPROPERTY(Transient)
-    TArray<TObjectPtr<class UMaterialInstanceDynamic>> SpawnFadeMIDs;
+    void SetFadeTimeline(float StartTime, float SignedDuration);
 
     FTimerHandle SpawnFadeTimer;
     bool  bSpawnFadeActive = false;
@@ -418,6 +450,26 @@ private:
     // 이동 재개용 저장
     float SavedMaxWalkSpeed = 0.f;
 
+    // ── Pooling ──
+    // 재사용 시 사망/시체 상태를 모든 머신에서 되돌림 (+ 페이드 인)
+    UFUNCTION(NetMulticast, Reliable)
+    void Multicast_ResetForReuse();
+
+    TWeakObjectPtr<AEnemySpawner> OwningSpawner;
+
+    // 사망 시 빙의 해제된 컨트롤러 (재사용 시 다시 빙의)
+    TWeakObjectPtr<AAIController> PooledController;
+
+    bool bInPool = false;
+
+    // 기본 어빌리티는 한 번만 부여 (재사용 시 중복 방지)
+    bool bDefaultAbilitiesGranted = false;
+
+    // 래그돌/시체 처리 전 상태 (BeginPlay 에서 기록)
+    FTransform DefaultMeshRelativeTransform;
+    FName DefaultMeshCollisionProfile;
+    FCollisionResponseContainer DefaultCapsuleResponses;
+
     // 데스 몽타주 끝난 뒤 포즈 고정용
     FTimerHandle DeathPoseFreezeTimerHandle;
 
@@ -449,6 +501,22 @@ public:
     // [New] 피격 시 해당 부위 데미지 처리 함수
     void ProcessPartDamage(FName BoneName, float Damage);
 
+protected:
+    // [New] 뼈 인덱스 → 부위 슬롯 표 (같은 메시 + 같은 부위 구성인 적끼리 공유)
+    TSharedPtr<const FEnemyPartBoneTable> PartBoneTable;
+
+    // [New] 슬롯별 현재 부위 체력 / 파괴 여부 (PartHealthMap 은 초기값으로만 사용)
+    TArray<float> PartHealth;
+    TBitArray<> BrokenPartSlots;
+
+    // 표가 없거나 메시가 바뀌었으면 다시 잡음 (false: 부위 판정 불가)
+    bool EnsurePartBoneTable();
+
+    // 풀 재사용 시 부위 체력/파괴 상태 초기화
+    void ResetPartDamage();
+
+public:
+
 
     // ───── 복구된 기존 기능들 ─────
     
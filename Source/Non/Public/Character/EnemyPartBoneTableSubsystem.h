@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "EnemyPartBoneTableSubsystem.generated.h"
+
+class USkeletalMesh;
+
+/** 스켈레탈 메시 1개 + 부위 구성 1개분 뼈 → 부위 표 */
+struct FEnemyPartBoneTable
+{
+    TObjectKey<USkeletalMesh> Mesh;
+
+    // 슬롯 → 부위 뼈 이름 (이름순)
+    TArray<FName> PartBones;
+
+    // 레퍼런스 스켈레톤 뼈 인덱스 → 슬롯 (어느 부위에도 속하지 않으면 INDEX_NONE)
+    TArray<int32> BoneToPart;
+};
+
+/**
+ * 적 부위 판정용 뼈 → 부위 표 캐시 (월드 단위)
+ * - 같은 메시 + 같은 부위 구성인 적끼리 표 하나를 공유 (게임 스레드 전용)
+ * - 월드가 끝나면 Deinitialize 에서 비움. 월드 도중 언로드된 메시의 표는 새 표를 만들 때 정리
+ */
+UCLASS()
+class NON_API UEnemyPartBoneTableSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    static UEnemyPartBoneTableSubsystem* Get(const UObject* WorldContextObject);
+
+    /** 캐시된 표를 찾고 없으면 생성 (리임포트로 뼈 수가 바뀐 표는 다시 만듦) */
+    TSharedPtr<const FEnemyPartBoneTable> FindOrBuild(const USkeletalMesh* Mesh, const TArray<FName>& PartBones);
+
+    /**
+     * 서브시스템 유무와 관계없이 표 획득
+     * - 월드가 없는 경우(에디터 프리뷰 등)는 캐시 없이 새로 만듦
+     */
+    static TSharedPtr<const FEnemyPartBoneTable> Resolve(const UObject* WorldContextObject, const USkeletalMesh* Mesh, const TArray<FName>& PartBones);
+
+    /** 레퍼런스 스켈레톤을 한 번 훑어 표 생성 */
+    static TSharedRef<FEnemyPartBoneTable> BuildTable(const USkeletalMesh* Mesh, const TArray<FName>& PartBones);
+
+    int32 GetNumCachedTables() const;
+
+private:
+    void PruneUnloadedMeshes();
+
+    // 부위 구성이 다른 적이 같은 메시를 쓰면 여러 개
+    TMap<TObjectKey<USkeletalMesh>, TArray<TSharedPtr<const FEnemyPartBoneTable>>> Tables;
+};
@@ -167,6 +167,9 @@ public:
   UFUNCTION(BlueprintPure, Category = "Inventory")
   class UInventoryComponent *GetInventoryComponent() const { return InventoryComp; }
 
+  UFUNCTION(BlueprintPure, Category = "Equipment")
+  UEquipmentComponent *GetEquipmentComponent() const { return EquipmentComp; }
+
   // === 타겟팅 (Target Frame) ===
   UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Transient, Category = "Combat")
   TObjectPtr<class AEnemyCharacter> CurrentTarget;
@@ -177,6 +180,23 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Combat")
   void SetCombatTarget(class AEnemyCharacter *NewTarget);
 
+  // [New] 타겟 프레임은 타겟 HP/MaxHP 변경 이벤트로 갱신하고,
+  // 거리/사망 체크만 짧은 주기 타이머로 수행
+  UPROPERTY(EditAnywhere, Category = "Combat")
+  float TargetRangeCheckInterval = 0.1f;
+
+  UPROPERTY(EditAnywhere, Category = "Combat")
+  float TargetMaxDistance = 2000.f;
+
+  void RefreshTargetHUD();
+  void BindTargetHUDEvents();
+  void UnbindTargetHUDEvents();
+
+  FTimerHandle TargetRangeTimerHandle;
+  TWeakObjectPtr<UAbilitySystemComponent> BoundTargetASC;
+  FDelegateHandle TargetHPChangedHandle;
+  FDelegateHandle TargetMaxHPChangedHandle;
+
   // === 무장 토글 ===
   UFUNCTION(BlueprintCallable, Category = "Combat")
   void ToggleArmed();
@@ -305,6 +325,19 @@ public:
   void UpdateDirectionalSpeed();
   void UpdateStrafeYawFollowBySpeed();
 
+  // [New] 이벤트 기반 로코모션 갱신
+  // - 회전 잠금 태그는 ASC 태그 카운트 이벤트로 캐시
+  // - 스트레이프/가드/백페달 상태나 입력 유무가 바뀐 프레임에만 회전 설정을 다시 계산
+  void BindLocomotionStateEvents();
+  void OnRotationLockTagChanged(const FGameplayTag Tag, int32 NewCount);
+  void MarkLocomotionDirty() { bLocomotionDirty = true; }
+  bool HasLocomotionInput() const;
+
+  bool bRotationLockTagActive = false;
+  bool bLocomotionDirty = true;
+  bool bHadLocomotionInput = false;
+  bool bLocomotionEventsBound = false;
+
   // [Fix] 회피 방향 미리 계산 (Client Prediction용)
   // 0:Fwd, 1:Back, 2:Left, 3:Right, ... (enum 매핑)
   UFUNCTION(BlueprintPure, Category = "Dodge")
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Combat/DamageAOE.h"
+#include "AOEOverlapSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 활성 AOE 공용 오버랩 처리기
+ * - 각 ADamageAOE 가 타이머로 개별 물리 쿼리를 하던 것을 월드 단위로 모음
+ * - 이번 프레임에 판정할 AOE 들을 거친 격자 칸별로 묶고, 묶음의 합집합 범위로 Pawn 채널 쿼리를 한 번씩 (브로드페이즈 스냅샷)
+ *   각 AOE 는 스냅샷 안의 컴포넌트만 형태별로 정밀 판정
+ * - 묶음 안에서도 AOE 가 흩어져 합집합이 부피 합보다 훨씬 크면 그 묶음은 AOE 별 쿼리로 처리
+ * - 대상의 팀(플레이어/적)은 스냅샷 생성 시 한 번만 판별
+ */
+UCLASS()
+class NON_API UAOEOverlapSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** AOE 등록 (첫 판정은 이번 프레임). Interval 이 0 이면 한 번만 판정 후 해제 */
+    void RegisterAOE(ADamageAOE* AOE, float Interval);
+    void UnregisterAOE(ADamageAOE* AOE);
+
+    UFUNCTION(BlueprintPure, Category = "AOE")
+    int32 GetNumActiveAOEs() const { return Entries.Num(); }
+
+    /** 직전 프레임 판정한 AOE 수 / 브로드페이즈 쿼리 수 / 스냅샷 컴포넌트 수 합 (프로파일링용) */
+    int32 GetLastQueriedAOEs() const { return LastQueriedAOEs; }
+    int32 GetLastBroadphaseQueries() const { return LastBroadphaseQueries; }
+    int32 GetLastSnapshotSize() const { return LastSnapshotSize; }
+
+    /** AOE 묶음용 격자 칸 크기 (중심이 같은 칸에 있는 AOE 끼리 쿼리 하나) */
+    float ClusterCellSize = 4000.f;
+
+    /** 묶음 합집합 부피가 AOE 부피 합의 이 배수를 넘으면 AOE 별 쿼리로 전환 */
+    float MaxUnionVolumeRatio = 8.f;
+
+private:
+    struct FAOEEntry
+    {
+        TWeakObjectPtr<ADamageAOE> AOE;
+        double NextHitTime = 0.0;
+        float Interval = 0.f;
+    };
+
+    struct FPawnSnapshot
+    {
+        AActor* Actor = nullptr;
+        UPrimitiveComponent* Component = nullptr;
+        FBox Bounds;
+        ETeamSideAOE Team = ETeamSideAOE::Neutral;
+    };
+
+    /** 이번 프레임 판정 대상 AOE 의 쿼리 */
+    struct FDueQuery
+    {
+        ADamageAOE* AOE = nullptr;
+        FVector Center = FVector::ZeroVector;
+        FCollisionShape Shape;
+        FBox Bounds;
+        int32 NumHits = 1; // 프레임이 간격보다 길면 밀린 횟수만큼 적용
+    };
+
+    /** 같은 격자 칸에 중심이 있는 AOE 묶음 */
+    struct FQueryCluster
+    {
+        FBox Bounds = FBox(ForceInit);
+        double SumVolume = 0.0;
+        TArray<int32, TInlineAllocator<8>> Members;
+    };
+
+    void BuildSnapshot(const FBox& QueryBounds);
+
+    /** 현재 스냅샷 안에서 AOE 하나 정밀 판정 후 적용 */
+    void ResolveQuery(const FDueQuery& Query);
+
+    TArray<FAOEEntry> Entries;
+    TArray<FPawnSnapshot> Snapshot;
+
+    int32 LastQueriedAOEs = 0;
+    int32 LastBroadphaseQueries = 0;
+    int32 LastSnapshotSize = 0;
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatEventSubsystem.generated.h"
+
+class APlayerController;
+class UPackageMap;
+
+/** 클라이언트 연출용 전투 이벤트 종류 */
+UENUM()
+enum class ECombatEventType : uint8
+{
+    Damage,         // 일반 데미지 숫자
+    CriticalDamage, // 크리티컬 데미지 숫자
+    PlayerDamage,   // 플레이어가 받은 데미지
+    Dodge,          // 회피 텍스트
+    Immune,         // 무적 텍스트
+    HitConfirm,     // 때린 플레이어에게 적 HP바 표시 (대상 지정)
+    Num UMETA(Hidden)
+};
+
+/** 전투 이벤트 1건 (위치/수치는 직렬화 시 양자화) */
+USTRUCT()
+struct FCombatEvent
+{
+    GENERATED_BODY()
+
+    ECombatEventType Type = ECombatEventType::Damage;
+
+    TWeakObjectPtr<AActor> Target;
+
+    FVector Location = FVector::ZeroVector;
+
+    float Amount = 0.f;
+
+    bool HasLocation() const { return Type != ECombatEventType::HitConfirm; }
+    bool HasAmount() const { return Type <= ECombatEventType::PlayerDamage; }
+};
+
+/**
+ * 한 프레임 분량의 전투 이벤트 묶음
+ * - 종류 3비트, 대상은 NetGUID, 위치는 1cm 양자화, 수치는 정수 가변 길이로 기록
+ * - MaxEvents 를 넘는 프레임은 여러 묶음으로 나눠 전송
+ */
+USTRUCT()
+struct FCombatEventBundle
+{
+    GENERATED_BODY()
+
+    static constexpr int32 MaxEvents = 64;
+
+    TArray<FCombatEvent> Events;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCombatEventBundle> : public TStructOpsTypeTraitsBase2<FCombatEventBundle>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
+
+/**
+ * 전투 연출 이벤트 채널 (서버)
+ * - 데미지 숫자/회피/무적/HP바 알림을 히트마다 멀티캐스트하던 것을 대체
+ * - 프레임 동안 쌓은 이벤트를 연결(플레이어 컨트롤러)별로 거리 컬링해 Unreliable RPC 한 번으로 전송
+ * - 클라이언트에서 호출되면 (예측 등) 바로 로컬 연출
+ */
+UCLASS()
+class NON_API UCombatEventSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * 이벤트 등록
+     * @param Recipient 지정 시 해당 컨트롤러에게만 전송 (거리 무시). 없으면 주변 플레이어 전체
+     */
+    static void Post(const UObject* WorldContextObject, ECombatEventType Type, AActor* Target,
+        const FVector& Location, float Amount = 0.f, APlayerController* Recipient = nullptr);
+
+    /**
+     * 한 연결로 보낼 이벤트를 MaxEvents 단위 묶음으로 나눔
+     * - HitConfirm 을 먼저 담음 (첫 묶음만 도착해도 적중 알림은 전달)
+     * - 나머지는 Events 순서 유지
+     */
+    static void BuildBundles(TConstArrayView<FCombatEvent> Events, TArray<FCombatEventBundle>& OutBundles);
+
+    /** 받은 이벤트를 로컬에서 연출 (클라이언트) */
+    static void DispatchLocal(const FCombatEvent& Event, APlayerController* LocalController);
+
+    /** 이 거리(cm) 밖의 이벤트는 보내지 않음 (자기 캐릭터 관련 이벤트는 항상 전송) */
+    float CullDistance = 6000.f;
+
+    /** 직전 프레임 전송 통계 (프로파일링용) */
+    int32 GetLastBundlesSent() const { return LastBundlesSent; }
+    int32 GetLastEventsSent() const { return LastEventsSent; }
+
+private:
+    struct FPendingEvent
+    {
+        FCombatEvent Event;
+        TWeakObjectPtr<APlayerController> Recipient;
+    };
+
+    TArray<FPendingEvent> Pending;
+
+    int32 LastBundlesSent = 0;
+    int32 LastEventsSent = 0;
+};
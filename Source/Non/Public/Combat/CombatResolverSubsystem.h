@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/HitResult.h"
+#include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
+#include "Templates/SubclassOf.h"
+#include "Combat/NonDamageHelpers.h"
+#include "CombatResolverSubsystem.generated.h"
+
+class UDamageType;
+class UGameplayEffect;
+class AController;
+
+/**
+ * 히트 1건에 대한 데미지 요청
+ * - 판정(트레이스/오버랩)은 호출부에서 끝내고, 수치 계산과 적용만 해석기에 맡김
+ */
+struct FCombatHitRequest
+{
+    /** 스탯을 읽을 공격자 (투사체/AOE 면 Owner 또는 Instigator 를 따라감) */
+    TWeakObjectPtr<AActor> Attacker;
+
+    /** ApplyDamageAt/ApplyPointDamage 에 넘길 가해 액터 */
+    TWeakObjectPtr<AActor> DamageCauser;
+
+    TWeakObjectPtr<AActor> Target;
+
+    /** ApplyPointDamage 경로에서 사용 */
+    TWeakObjectPtr<AController> InstigatorController;
+
+    /** 공격자 스탯 × PowerScale → 피격자 방어 적용 */
+    float PowerScale = 1.f;
+    ENonDamageType DamageType = ENonDamageType::Physical;
+
+    /** 스탯 계산 결과가 0 일 때 대신 쓸 데미지 (0 이면 히트 무시) */
+    float FallbackDamage = 0.f;
+
+    FVector HitLocation = FVector::ZeroVector;
+    FVector HitDirection = FVector::ZeroVector;
+    FHitResult Hit;
+    FGameplayTag ReactionTag;
+
+    /** true: 캐릭터의 ApplyDamageAt (GAS), false: UGameplayStatics::ApplyPointDamage */
+    bool bApplyThroughGAS = true;
+    TSubclassOf<UDamageType> DamageTypeClass;
+
+    /** 히트마다 추가로 부여할 상태이상 GE (스턴 등) */
+    TSubclassOf<UGameplayEffect> AdditionalEffect;
+    float EffectLevel = 1.f;
+    float StunDuration = 0.f;
+
+    /** true 면 최종 데미지가 0 일 때 AdditionalEffect 도 생략 */
+    bool bEffectRequiresDamage = false;
+};
+
+/**
+ * 전투 해석기 (월드 단위)
+ * - 한 프레임 동안 들어온 히트 요청을 모아 프레임 끝에 한 번에 처리
+ * - 공격자/피격자 스탯은 프레임당 액터별로 한 번만 읽음 (AOE 다단히트 시 ASC 조회 반복 제거)
+ * - 같은 공격자의 같은 상태이상 GE 는 Spec 을 한 번만 만들어 모든 피격자에게 적용
+ */
+UCLASS()
+class NON_API UCombatResolverSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * 히트 요청 제출
+     * - 해석기가 없는 월드(에디터 프리뷰 등)에서는 즉시 처리
+     */
+    static void Submit(const UObject* WorldContextObject, FCombatHitRequest&& Request);
+
+    void QueueHit(FCombatHitRequest&& Request);
+
+    UFUNCTION(BlueprintPure, Category = "Combat")
+    int32 GetNumPendingHits() const { return Pending.Num(); }
+
+    /** 직전 처리 패스의 히트 수 / 스탯 스냅샷 수 (프로파일링용) */
+    int32 GetLastResolvedHits() const { return LastResolvedHits; }
+    int32 GetLastSnapshotCount() const { return LastSnapshotCount; }
+
+private:
+    /** 한 패스 동안만 유효한 캐시 */
+    struct FResolveContext
+    {
+        TMap<TObjectKey<AActor>, FNonAttackerStats> Attackers;
+        TMap<TObjectKey<AActor>, FNonDefenderStats> Defenders;
+        // (공격자, GE, 레벨, 스턴 시간) → 공유 Spec
+        TMap<TTuple<TObjectKey<AActor>, const UClass*, float, float>, FGameplayEffectSpecHandle> EffectSpecs;
+    };
+
+    static void ResolveBatch(TArrayView<FCombatHitRequest> Batch, FResolveContext& Context);
+    static void ResolveHit(const FCombatHitRequest& Request, FResolveContext& Context);
+
+    TArray<FCombatHitRequest> Pending;
+    TArray<FCombatHitRequest> Resolving;
+
+    int32 LastResolvedHits = 0;
+    int32 LastSnapshotCount = 0;
+};
@@ -4,6 +4,7 @@
 #include "GameFramework/Actor.h"
 #include "Combat/NonDamageHelpers.h"
 #include "GameplayTagContainer.h"
+#include "CollisionShape.h"
 #include "DamageAOE.generated.h"
 
 class USceneComponent;
@@ -124,10 +125,29 @@ public:
     void ConfigureCapsule(float InHalfHeight, float InRadius, float InDamage, float InDuration, float InInterval = 0.1f, bool bSingleHit = true);
 
 
+    // ── 공용 오버랩 처리기(UAOEOverlapSubsystem)용 ──
+    /** 현재 판정 위치/형태 (Box/Capsule 은 축 정렬) */
+    void GetOverlapQuery(FVector& OutCenter, FCollisionShape& OutShape) const;
+
+    /** 팀/자기 자신 필터를 통과한 대상들에 중복 히트 규칙 적용 후 데미지 요청 */
+    void ApplyOverlapResults(TConstArrayView<AActor*> Targets);
+
+    /** 대상 액터의 팀 (플레이어/적/그 외) */
+    static ETeamSideAOE GetTargetTeam(const AActor* Actor);
+
+    /** 이 AOE 가 해당 팀을 맞출 수 있는지 */
+    bool CanHitTeam(ETeamSideAOE TargetTeam) const;
+
+    /** 이미 맞춘 대상인지 (bSingleHitPerActor 일 때만 기록) */
+    bool HasHitActor(AActor* Actor) const { return HitActors.Contains(Actor); }
+    int32 GetNumHitActors() const { return HitActors.Num(); }
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+    // 공용 처리기가 없는 월드에서만 사용
     FTimerHandle TickTimer;
     TSet<TWeakObjectPtr<AActor>> HitActors;
     TWeakObjectPtr<USceneComponent> FollowComp;
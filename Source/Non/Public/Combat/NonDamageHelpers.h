@@ -10,6 +10,34 @@ enum class ENonDamageType : uint8
     Magical  UMETA(DisplayName = "Magical"),
 };
 
+/**
+ * 공격자 스탯 스냅샷
+ * - ASC/AttributeSet 조회를 한 번만 하고, 같은 공격자의 여러 히트가 재사용
+ * - Pawn/AttributeSet 이 없으면 모두 0 (데미지 0)
+ */
+struct NON_API FNonAttackerStats
+{
+    float AttackPower = 0.f;
+    float MinAttackPower = 0.f;
+    float MaxAttackPower = 0.f;
+    float MagicPower = 0.f;
+    float MinMagicPower = 0.f;
+    float MaxMagicPower = 0.f;
+    float CriticalRate = 0.f;   // 확률(0~100)
+    float CriticalDamage = 0.f; // 배율(1.0 이상)
+
+    static FNonAttackerStats Capture(AActor* SourceActor);
+};
+
+/** 피격자 방어 스냅샷 (Pawn/AttributeSet 이 없으면 방어 0 → 원 데미지 그대로) */
+struct NON_API FNonDefenderStats
+{
+    float Defense = 0.f;
+    float MagicResist = 0.f;
+
+    static FNonDefenderStats Capture(AActor* TargetActor);
+};
+
 UCLASS()
 class NON_API UNonDamageHelpers : public UObject
 {
@@ -32,4 +60,16 @@ public:
         AActor* TargetActor,
         float RawDamage,
         ENonDamageType DamageType);
+
+    // 스냅샷 버전 (전투 해석기에서 프레임 단위로 캐시한 스탯 사용)
+    static float ComputeDamageFromStats(
+        const FNonAttackerStats& Stats,
+        float PowerScale,
+        ENonDamageType DamageType,
+        bool* bOutWasCritical = nullptr);
+
+    static float ApplyDefenseFromStats(
+        const FNonDefenderStats& Stats,
+        float RawDamage,
+        ENonDamageType DamageType);
 };
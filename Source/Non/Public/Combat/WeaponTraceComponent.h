@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WeaponTraceComponent.generated.h"
+
+class USkeletalMeshComponent;
+class UAnimNotifyState;
+struct FAnimNotifyEventReference;
+
+/** 스윙 식별자: 같은 메시/같은 노티파이라도 몽타주 인스턴스가 다르면 별개 스윙 */
+struct FWeaponSwingKey
+{
+    TWeakObjectPtr<const USkeletalMeshComponent> Mesh;
+    const UAnimNotifyState* Notify = nullptr;
+    int32 MontageInstanceId = INDEX_NONE;
+
+    bool operator==(const FWeaponSwingKey& Other) const
+    {
+        return Mesh == Other.Mesh && Notify == Other.Notify && MontageInstanceId == Other.MontageInstanceId;
+    }
+
+    friend uint32 GetTypeHash(const FWeaponSwingKey& Key)
+    {
+        return HashCombine(HashCombine(GetTypeHash(Key.Mesh), PointerHash(Key.Notify)), ::GetTypeHash(Key.MontageInstanceId));
+    }
+};
+
+/**
+ * 무기 트레이스용으로 해석해 둔 소켓 쌍
+ * - 스켈레탈 메시면 소켓이 붙은 본 인덱스와 본 기준 로컬 트랜스폼을 저장해 매 프레임 이름 검색을 생략
+ * - 그 외 컴포넌트는 소켓 이름으로 조회
+ */
+struct NON_API FWeaponTraceSockets
+{
+    TWeakObjectPtr<USceneComponent> Component;
+    FName StartSocket;
+    FName EndSocket;
+
+    int32 StartBoneIndex = INDEX_NONE;
+    int32 EndBoneIndex = INDEX_NONE;
+    FTransform StartLocal = FTransform::Identity;
+    FTransform EndLocal = FTransform::Identity;
+
+    bool IsValid() const { return Component.IsValid(); }
+
+    /** Comp 에 두 소켓이 모두 있으면 해석 결과, 없으면 Component 가 빈 값 */
+    static FWeaponTraceSockets Resolve(USceneComponent* Comp, FName InStartSocket, FName InEndSocket);
+
+    /** 현재 월드 위치 (컴포넌트가 사라졌으면 false) */
+    bool GetLocations(FVector& OutStart, FVector& OutEnd) const;
+};
+
+/** 스윙 한 번의 판정 상태 */
+struct FWeaponSwingState
+{
+    // 소켓 소유 컴포넌트 (무기 메시 등) 와 해석된 소켓
+    FWeaponTraceSockets Sockets;
+
+    // 이전 판정 시점의 소켓 위치 (서브스텝 보간 시작점)
+    FVector PrevStart = FVector::ZeroVector;
+    FVector PrevEnd = FVector::ZeroVector;
+    bool bHasPrev = false;
+
+    // 이번 스윙에서 이미 맞은 액터
+    TSet<TWeakObjectPtr<AActor>> HitActors;
+};
+
+/** 스윕 설정 */
+struct FWeaponSweepParams
+{
+    float Radius = 12.f;
+    ECollisionChannel Channel = ECC_Pawn;
+
+    // 이전 프레임 → 현재 프레임 사이 서브스텝 상한
+    // 실제 횟수는 끝점 이동량 / Radius 로 정함 (프레임이 낮을수록 많이 나눔)
+    int32 MaxSubSteps = 16;
+
+    bool bDrawDebug = false;
+    FColor DebugColor = FColor::Red;
+    float DebugDrawTime = 0.f;
+};
+
+/**
+ * 무기 판정 상태 보관 컴포넌트
+ * - 애님 노티파이 객체는 같은 몽타주를 재생하는 모든 메시가 공유하므로 스윙별 상태는 여기(액터별)에 둠
+ * - 이전 프레임 소켓 위치를 기억하고, 현재 프레임까지 칼날 자세를 보간하며 캡슐 스윕 → 빠른 스윙/낮은 서버 FPS 에서도 관통 방지
+ * - 판정 결과는 소켓 위치에만 의존 (시간 값을 쓰지 않음)
+ */
+UCLASS(ClassGroup = (Combat), meta = (BlueprintSpawnableComponent))
+class NON_API UWeaponTraceComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UWeaponTraceComponent();
+
+    /** Owner 의 컴포넌트를 찾고, 없으면 런타임에 추가 */
+    static UWeaponTraceComponent* FindOrAdd(AActor* Owner);
+
+    /**
+     * 노티파이 이벤트로부터 스윙 키 생성
+     * - 몽타주 인스턴스 ID 는 이벤트 자신의 컨텍스트에서 가져옴 (지금 활성인 인스턴스가 아니라 노티파이를 발생시킨 인스턴스)
+     * - 몽타주가 아니면 인스턴스 ID 없음
+     */
+    static FWeaponSwingKey MakeSwingKey(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference, const UAnimNotifyState* Notify);
+
+    FWeaponSwingState& BeginSwing(const FWeaponSwingKey& Key, const FWeaponTraceSockets& Sockets);
+    FWeaponSwingState* FindSwing(const FWeaponSwingKey& Key) { return Swings.Find(Key); }
+    void EndSwing(const FWeaponSwingKey& Key);
+
+    /**
+     * 이전 판정 위치부터 현재 소켓 위치까지 서브스텝 스윕
+     * - 액터당 가장 이른 서브스텝의 히트 하나만 반환 (Owner 제외)
+     * - 호출 후 현재 소켓 위치가 다음 판정의 시작점이 됨
+     */
+    void SweepSwing(FWeaponSwingState& State, const FWeaponSweepParams& Params, TArray<FHitResult>& OutHits) const;
+
+    /**
+     * 서브스텝 수: 스텝당 양 끝점 이동이 Radius 이하가 되도록 ceil(max(|ΔStart|, |ΔEnd|) / Radius)
+     * - 서브스텝마다 칼날 방향은 하나뿐이라 이동이 반지름보다 크면 끝(팁) 쪽 얇은 대상이 빈틈으로 빠짐
+     * - [1, MaxSubSteps] 로 제한
+     */
+    static int32 ComputeNumSubSteps(const FVector& PrevStart, const FVector& PrevEnd, const FVector& CurStart, const FVector& CurEnd, float Radius, int32 MaxSubSteps);
+
+    /** 두 칼날 자세 사이 서브스텝 스윕 (SweepSwing 본체, IgnoreActor 제외) */
+    static void SweepPoses(UWorld* World, const AActor* IgnoreActor, const FVector& PrevStart, const FVector& PrevEnd, const FVector& CurStart, const FVector& CurEnd, const FWeaponSweepParams& Params, TArray<FHitResult>& OutHits);
+
+    UFUNCTION(BlueprintPure, Category = "Combat|Trace")
+    int32 GetNumActiveSwings() const { return Swings.Num(); }
+
+protected:
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    TMap<FWeaponSwingKey, FWeaponSwingState> Swings;
+};
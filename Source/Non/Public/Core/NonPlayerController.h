@@ -4,6 +4,7 @@
 #include "GameFramework/PlayerController.h"
 #include "InputAction.h"
 #include "InputMappingContext.h"
+#include "Combat/CombatEventSubsystem.h"
 #include "NonPlayerController.generated.h"
 
 class UNonUIManagerComponent;
@@ -202,6 +203,10 @@ public:
   UFUNCTION(Server, Reliable, BlueprintCallable)
   void ServerRespawnPlayer(bool bInPlace);
 
+  // [New] 한 프레임 분량의 전투 연출 이벤트 (데미지 숫자/회피/무적/HP바)
+  UFUNCTION(Client, Unreliable)
+  void ClientReceiveCombatEvents(const FCombatEventBundle &Bundle);
+
   // === [New] 1:1 결투(Duel) 시스템 ===
   UPROPERTY(BlueprintReadOnly, Replicated, Category = "Non|Duel")
   TObjectPtr<ANonPlayerController> CurrentDuelOpponent = nullptr;
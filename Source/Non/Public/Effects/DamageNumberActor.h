@@ -8,6 +8,7 @@
 
 class UWidgetComponent;
 class UDamageNumberWidget;
+class UUserWidget;
 
 UCLASS()
 class NON_API ADamageNumberActor : public AActor
@@ -34,6 +35,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "DamageNumber")
     void SetupAsDodge();
 
+    // 풀 표시기(UDamageNumberSubsystem)가 스타일로 읽는 값 (CDO 기준)
+    TSubclassOf<UUserWidget> GetWidgetClass() const;
+    float GetLifeTime() const { return LifeTime; }
+
 protected:
     virtual void BeginPlay() override;
     virtual void Tick(float DeltaSeconds) override;
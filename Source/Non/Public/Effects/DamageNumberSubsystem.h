@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UI/NonDamageTypes.h"
+#include "DamageNumberSubsystem.generated.h"
+
+class ADamageNumberActor;
+class UDamageNumberWidget;
+class APlayerController;
+
+/**
+ * 클라이언트 데미지 숫자 표시기
+ * - 이벤트마다 ADamageNumberActor(+WidgetComponent)를 스폰하던 것을 대체
+ * - 위젯 클래스별 고정 풀을 뷰포트에 한 번만 올려두고, 활성 숫자는 링 버퍼로 관리
+ * - 매 프레임 활성 숫자만 화면 좌표로 투영해 위치 갱신 (틱/컴포넌트 등록 비용 없음)
+ * - 데디케이티드 서버에서는 생성되지 않음
+ *
+ * ADamageNumberActor 블루프린트는 스타일(위젯 클래스/수명) 지정용으로 계속 사용
+ */
+UCLASS()
+class NON_API UDamageNumberSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** 동시에 표시할 수 있는 최대 숫자 수 (가득 차면 가장 오래된 숫자를 재사용) */
+    static constexpr int32 MaxOnScreen = 64;
+
+    /** 숫자 표시. StyleClass 는 위젯 클래스/수명을 읽을 ADamageNumberActor (없으면 기본) */
+    static void ShowNumber(const UObject* WorldContextObject, TSubclassOf<ADamageNumberActor> StyleClass,
+        const FVector& WorldLocation, float Amount, ENonDamageNumberCategory Category, int32 FontSize = 28);
+
+    /** 라벨(Dodge/IMMUNE 등) 표시 */
+    static void ShowLabel(const UObject* WorldContextObject, TSubclassOf<ADamageNumberActor> StyleClass,
+        const FVector& WorldLocation, const FText& Label, ENonDamageNumberCategory Category, int32 FontSize = 28);
+
+    UFUNCTION(BlueprintPure, Category = "DamageNumber")
+    int32 GetNumActive() const { return NumActive; }
+
+    /** 지금까지 생성한 위젯 수 (풀 크기 확인용) */
+    UFUNCTION(BlueprintPure, Category = "DamageNumber")
+    int32 GetNumCreatedWidgets() const { return AllWidgets.Num(); }
+
+private:
+    struct FActiveNumber
+    {
+        UDamageNumberWidget* Widget = nullptr;
+        FVector WorldLocation = FVector::ZeroVector;
+        double ExpireTime = 0.0;
+    };
+
+    /** 풀에서 위젯을 꺼내 링 버퍼에 추가 (설정은 호출부에서) */
+    UDamageNumberWidget* Acquire(TSubclassOf<ADamageNumberActor> StyleClass, const FVector& WorldLocation);
+    void Release(FActiveNumber& Entry);
+    APlayerController* GetLocalController() const;
+
+    // 링 버퍼 (Head = 가장 오래된 항목). 만료된 중간 항목은 Widget=nullptr 로 비워 둠
+    FActiveNumber Ring[MaxOnScreen];
+    int32 Head = 0;
+    int32 Count = 0;
+    int32 NumActive = 0;
+
+    // GC 보관용 (생성된 모든 위젯)
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UDamageNumberWidget>> AllWidgets;
+
+    // 위젯 클래스별 대기 위젯
+    TMap<TObjectKey<UClass>, TArray<UDamageNumberWidget*>> FreeWidgets;
+};
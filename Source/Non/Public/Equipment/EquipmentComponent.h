@@ -7,9 +7,11 @@
 #include "GameplayAbilitySpec.h"
 #include "Inventory/InventoryItem.h"
 #include "Inventory/ItemEnums.h"
+#include "Combat/WeaponTraceComponent.h"
 #include "EquipmentComponent.generated.h"
 
 class UInventoryComponent;
+class UNiagaraComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEquipped, EEquipmentSlot, Slot,
                                              UInventoryItem *, Item);
@@ -138,6 +140,19 @@ public:
 
   USceneComponent *GetVisualForSlot(EEquipmentSlot Slot) const;
 
+  // === 무기 트레이스 캐시 ===
+  // 슬롯 무기(스폰 액터 → 비주얼 컴포넌트)에서 두 소켓을 모두 가진 컴포넌트를
+  // 해석해 캐시. 장착/해제/재부착 때만 무효화 (없으면 nullptr)
+  const FWeaponTraceSockets *FindTraceSockets(EEquipmentSlot Slot,
+                                              FName StartSocket,
+                                              FName EndSocket);
+
+  // 무기 트레일 이펙트 캐시 (UANS_WeaponTrail 에서 태그 검색 대신 사용)
+  UNiagaraComponent *GetActiveTrail(EEquipmentSlot Slot) const;
+  void SetActiveTrail(EEquipmentSlot Slot, UNiagaraComponent *Trail);
+
+  void InvalidateTraceCache(EEquipmentSlot Slot);
+
   // (1) 기본 시스(등/허리) 소켓 — BP에서 바꿔도 됨
   UPROPERTY(EditDefaultsOnly, Category = "Equipment|Defaults")
   FName DefaultSheathSocket1H = TEXT("sheath_hip_r");
@@ -232,6 +247,13 @@ private:
   UPROPERTY(Transient)
   TMap<EEquipmentSlot, TObjectPtr<AActor>> SpawnedEquipActors;
 
+  // 슬롯 → 해석된 트레이스 소켓 쌍 (노티파이마다 소켓 이름이 다를 수 있어
+  // 목록). 소켓이 없는 경우도 빈 항목으로 기록해서 재검색 방지
+  TMap<EEquipmentSlot, TArray<FWeaponTraceSockets>> TraceSocketCache;
+
+  // 슬롯 → 현재 재생 중인 트레일
+  TMap<EEquipmentSlot, TWeakObjectPtr<UNiagaraComponent>> ActiveTrails;
+
   // 슬롯별로 부여된 어빌리티 핸들 추적
   UPROPERTY(Transient)
   TMap<EEquipmentSlot, FGrantedAbilityHandles> GrantedAbilityHandles;
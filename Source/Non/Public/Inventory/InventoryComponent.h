@@ -1,6 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "Inventory/InventoryItem.h"
 #include "Data/ItemStructs.h"
 #include "Inventory/ItemEnums.h"
@@ -12,9 +13,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInventoryRefreshed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnInventoryCooldownStarted, FName, GroupId, float, Duration, float, EndTime);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGoldChanged, int32, NewGold);
 
-// [Multiplayer] 리플리케이션용 구조체
+// [Multiplayer] 리플리케이션용 구조체 (FastArray 아이템)
 USTRUCT(BlueprintType)
-struct FReplicatedInventorySlot
+struct FReplicatedInventorySlot : public FFastArraySerializerItem
 {
     GENERATED_BODY()
 
@@ -22,14 +23,63 @@ struct FReplicatedInventorySlot
     UPROPERTY() FName ItemId = NAME_None;
     UPROPERTY() int32 Quantity = 0;
 
-    // 필요시 인챈트 정보 등 추가
+    // 강화 수치 (인스턴스 데이터라 데이터테이블로 복원할 수 없으므로 함께 복제)
+    UPROPERTY() int32 EnhancementLevel = 0;
 
     bool operator==(const FReplicatedInventorySlot& Other) const
     {
-        return SlotIndex == Other.SlotIndex && ItemId == Other.ItemId && Quantity == Other.Quantity;
+        return SlotIndex == Other.SlotIndex && ItemId == Other.ItemId && Quantity == Other.Quantity && EnhancementLevel == Other.EnhancementLevel;
     }
 };
 
+/* ===================================
+ * FastArray: 인벤토리 슬롯 컨테이너
+ *  - 변경된 슬롯만 델타 복제
+ *  - 클라에서는 항목별 추가/변경/제거 콜백으로 해당 슬롯만 패치
+ * =================================== */
+USTRUCT()
+struct FReplicatedInventoryList : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FReplicatedInventorySlot> Items;
+
+    /** 소유 컴포넌트(클라에서 슬롯 패치용) */
+    UPROPERTY(NotReplicated)
+    class UInventoryComponent* Owner = nullptr;
+
+    /** [서버] 슬롯 내용 반영 (Item == nullptr 이면 항목 제거) */
+    void SetSlot(int32 SlotIndex, const UInventoryItem* Item);
+
+    /** 복제 이벤트 훅: 변경된 항목만 소유자에게 전달 */
+    void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+    void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+    void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+
+    /** 한 번의 수신이 끝나면 모아 둔 슬롯 알림을 한 번에 (서버 트랜잭션과 같은 규칙) */
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FReplicatedInventorySlot, FReplicatedInventoryList>(Items, DeltaParms, *this);
+    }
+
+private:
+    // [클라] 수신 중 첫 콜백에서 소유자 트랜잭션을 열고 PostReplicatedReceive 에서 닫음
+    void BeginReceiveBatch();
+    bool bReceiveBatchOpen = false;
+
+    // [서버 전용] SlotIndex -> Items 인덱스 (선형 탐색 제거용)
+    TArray<int32> EntryIndexBySlot;
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedInventoryList> : public TStructOpsTypeTraitsBase2<FReplicatedInventoryList>
+{
+    enum { WithNetDeltaSerializer = true };
+};
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class NON_API UInventoryComponent : public UActorComponent
 {
@@ -126,6 +176,20 @@ public:
     UFUNCTION(BlueprintPure)  bool IsCooldownActive(FName GroupId) const;
     UFUNCTION(BlueprintCallable) void StartCooldown(FName GroupId, float CooldownSeconds);
 
+    /**
+     * 트랜잭션 시작: Commit 전까지 슬롯 변경을 모아두고 UI/복제 갱신을 미룸 (중첩 가능)
+     * - C++ 에서는 FScopedInventoryTransaction 사용 권장
+     */
+    UFUNCTION(BlueprintCallable, Category = "Inventory|Transaction")
+    void BeginTransaction();
+
+    /** 트랜잭션 종료: 가장 바깥 Commit 에서 변경된 슬롯을 한 번에 복제/브로드캐스트 */
+    UFUNCTION(BlueprintCallable, Category = "Inventory|Transaction")
+    void CommitTransaction();
+
+    UFUNCTION(BlueprintPure, Category = "Inventory|Transaction")
+    bool IsInTransaction() const { return TransactionDepth > 0; }
+
     /** 저장용: 전체 아이템 리스트 반환 (빈 슬롯 제외) */
     TArray<FInventorySaveData> GetItemsForSave() const;
 
@@ -139,12 +203,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     void ClearAllNewItemFlags();
 
-    // [Multiplayer]
-    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedSlots)
-    TArray<FReplicatedInventorySlot> ReplicatedSlots;
+    // [Multiplayer] 델타 복제되는 슬롯 목록
+    UPROPERTY(Replicated)
+    FReplicatedInventoryList ReplicatedSlots;
 
-    UFUNCTION()
-    void OnRep_ReplicatedSlots();
+    /** [클라] FastArray 콜백: 추가/변경된 항목 하나를 로컬 슬롯에 반영 (기존 객체 재사용, 알림은 수신 단위로 모음) */
+    void HandleReplicatedSlotChanged(const FReplicatedInventorySlot& Entry);
+
+    /** [클라] FastArray 콜백: 제거된 항목의 로컬 슬롯 비우기 */
+    void HandleReplicatedSlotRemoved(const FReplicatedInventorySlot& Entry);
 
     // [Multiplayer] 소비 아이템 사용 RPC
     UFUNCTION(Server, Reliable)
@@ -169,6 +236,27 @@ private:
     void BroadcastSlot(int32 Index);
     int32 FindStackableSlot(FName ItemId) const;
 
+    /** 슬롯 Index 의 빈 슬롯/열린 스택 색인 갱신 (슬롯 내용이 바뀐 직후 호출) */
+    void UpdateSlotIndex(int32 Index);
+
+    /** 색인 전체 재구성 (슬롯 수가 바뀌었을 때) */
+    void RebuildSlotIndex();
+
+    bool IsSlotIndexValid() const { return FreeSlotBits.Num() == Slots.Num() && OpenStackKeyBySlot.Num() == Slots.Num(); }
+
+    // 빈 슬롯 비트셋 (true = 비어 있음)
+    TBitArray<> FreeSlotBits;
+
+    // ItemId -> 가득 차지 않은 스택 슬롯 목록 (오름차순, 맨 앞이 채울 슬롯)
+    TMap<FName, TArray<int32>> OpenStacksByItem;
+
+    // 슬롯별로 OpenStacksByItem 에 등록된 ItemId (미등록이면 NAME_None)
+    TArray<FName> OpenStackKeyBySlot;
+
+    // 트랜잭션 중첩 깊이 / 커밋 대기 중인 슬롯
+    int32 TransactionDepth = 0;
+    TBitArray<> PendingDirtySlots;
+
     /** [New] 멀티플레이어 서버 동기화(Replication)가 보증되는 골드 재화 변수 */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, ReplicatedUsing = OnRep_Gold, meta = (AllowPrivateAccess = "true"), Category = "Inventory|Currency")
     int32 Gold = 0;
@@ -176,3 +264,18 @@ private:
     UFUNCTION()
     void OnRep_Gold();
 };
+
+/**
+ * 인벤토리 트랜잭션 RAII 가드
+ * - 범위 안의 모든 슬롯 변경을 모아 범위 종료 시 한 번만 UI/복제 갱신
+ */
+struct NON_API FScopedInventoryTransaction
+{
+    explicit FScopedInventoryTransaction(UInventoryComponent* InInventory);
+    ~FScopedInventoryTransaction();
+
+    UE_NONCOPYABLE(FScopedInventoryTransaction);
+
+private:
+    TWeakObjectPtr<UInventoryComponent> Inventory;
+};
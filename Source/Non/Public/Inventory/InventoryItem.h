@@ -2,6 +2,8 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "Data/ItemStructs.h"
+#include "System/ItemDefinitionSubsystem.h"
+#include "System/IconCacheSubsystem.h"
 #include "InventoryItem.generated.h"
 
 UCLASS(BlueprintType)
@@ -26,27 +28,44 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
     bool bIsNewItem = false;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item")
-    FItemRow CachedRow;
+    // 공유 아이템 정의 핸들 (행을 복사하지 않고 레지스트리의 행을 참조)
+    FItemDefinitionHandle Definition;
+
+    /** C++ 접근용: 공유 행 참조 (정의가 없으면 빈 기본 행) */
+    const FItemRow& GetRow() const { return Definition.Get(); }
+
+    /** 블루프린트 접근용: 행 데이터 사본 반환 */
+    UFUNCTION(BlueprintPure, Category = "Item")
+    FItemRow GetItemRow() const { return Definition.Get(); }
+
+    /** [Deprecated] 예전 CachedRow 프로퍼티 대체용 (BP 이전 후 제거 예정) */
+    UFUNCTION(BlueprintPure, Category = "Item", meta = (DeprecatedFunction, DeprecationMessage = "CachedRow 는 제거되었습니다. GetItemRow 를 사용하세요."))
+    FItemRow GetCachedRow() const { return Definition.Get(); }
 
     UPROPERTY(Transient)
     TObjectPtr<UDataTable> ItemDataTable;
 
     UFUNCTION(BlueprintCallable) void Init(FName InItemId, int32 InQty, UDataTable* DT);
-    UFUNCTION(BlueprintPure)   bool IsStackable() const { return CachedRow.MaxStack > 1; }
+    UFUNCTION(BlueprintPure)   bool IsStackable() const { return GetRow().MaxStack > 1; }
 
     UFUNCTION(BlueprintPure, Category = "Item")
     int32 GetStackCount() const { return Quantity; }
 
     UFUNCTION(BlueprintPure, Category = "Item")
-    int32 GetMaxStack() const { return CachedRow.MaxStack; }
+    int32 GetMaxStack() const { return GetRow().MaxStack; }
 
     UFUNCTION(BlueprintPure, Category = "Item")
     UTexture2D* GetIcon() const
     {
-        return CachedRow.Icon.IsNull() ? nullptr : CachedRow.Icon.LoadSynchronous();
+        return GetRow().Icon.IsNull() ? nullptr : GetRow().Icon.LoadSynchronous();
     }
 
+    /**
+     * 위젯용 아이콘 요청 (블로킹 없음)
+     * - 캐시에 있으면 바로 반환, 없으면 nullptr 반환 후 로드 완료 시 OnLoaded 호출
+     */
+    UTexture2D* RequestIcon(FOnIconLoaded OnLoaded = FOnIconLoaded()) const;
+
     //  슬롯 판정용 접근자 추가
     EEquipmentSlot GetEquipSlot() const;
 
@@ -58,7 +77,7 @@ public:
     UFUNCTION(BlueprintPure, Category = "Item")
     FName GetAttachSocket() const
     {
-        // CachedRow.AttachSocket 가 NONE이면 데이터테이블에 빈 값입니다.
-        return CachedRow.AttachSocket;
+        // GetRow().AttachSocket 가 NONE이면 데이터테이블에 빈 값입니다.
+        return GetRow().AttachSocket;
     }
 };
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "IconCacheSubsystem.generated.h"
+
+class UTexture2D;
+struct FStreamableHandle;
+
+/** 아이콘 비동기 로드 완료 콜백 (로드 실패 시 nullptr) */
+DECLARE_DELEGATE_OneParam(FOnIconLoaded, UTexture2D*);
+
+/**
+ * 아이템/스킬 아이콘 공용 캐시
+ * - LoadSynchronous 대신 FStreamableManager 로 비동기 요청하고, 로드가 끝나면 요청한 위젯에 콜백
+ * - 위젯은 로드 전까지 빈 아이콘(플레이스홀더)을 보여주고 콜백에서 브러시만 교체
+ * - 로드된 아이콘은 스트리머블 핸들로 붙잡아 두고, MaxCachedIcons 를 넘으면 가장 오래 안 쓴 것부터 해제 (LRU)
+ */
+UCLASS()
+class NON_API UIconCacheSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** 월드 컨텍스트로부터 서브시스템 획득 (게임 인스턴스가 없으면 nullptr) */
+    static UIconCacheSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * 아이콘 요청
+     * @return 이미 메모리에 있으면 바로 반환. 없으면 nullptr 을 반환하고 로드가 끝나면 OnLoaded 호출
+     */
+    UTexture2D* RequestIcon(const TSoftObjectPtr<UTexture2D>& Icon, FOnIconLoaded OnLoaded = FOnIconLoaded());
+
+    /**
+     * 서브시스템 유무와 관계없이 아이콘 요청
+     * - 게임 인스턴스가 없는 경우(에디터 프리뷰, CDO 등)는 기존처럼 동기 로드
+     */
+    static UTexture2D* Resolve(const UObject* WorldContextObject, const TSoftObjectPtr<UTexture2D>& Icon,
+        FOnIconLoaded OnLoaded = FOnIconLoaded());
+
+    /** 아이콘 여러 개를 낮은 우선순위로 미리 로드 */
+    void Prefetch(TConstArrayView<TSoftObjectPtr<UTexture2D>> Icons);
+
+    /** 캐릭터의 가방/퀵슬롯(아이템 + 스킬) 아이콘 미리 로드 (세이브 복구 직후 호출) */
+    void PrefetchForCharacter(const AActor* Character);
+
+    /** 붙잡아 둘 최대 아이콘 수 (넘으면 LRU 해제) */
+    int32 MaxCachedIcons = 256;
+
+    int32 GetNumCachedIcons() const { return Entries.Num(); }
+
+    /** 해당 아이콘을 캐시가 붙잡고 있는지 (LRU 확인용) */
+    bool IsIconCached(const TSoftObjectPtr<UTexture2D>& Icon) const { return Entries.Contains(Icon.ToSoftObjectPath()); }
+
+private:
+    struct FIconEntry
+    {
+        TSharedPtr<FStreamableHandle> Handle;
+        TArray<FOnIconLoaded> Waiters;
+        uint64 LastUsed = 0;
+    };
+
+    FIconEntry& FindOrRequest(const FSoftObjectPath& Path, bool bLowPriority);
+    void OnIconStreamed(FSoftObjectPath Path);
+    void EvictIfNeeded();
+
+    TMap<FSoftObjectPath, FIconEntry> Entries;
+
+    // LRU 순서용 단조 증가 카운터
+    uint64 UseClock = 0;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Data/ItemStructs.h"
+#include "ItemDefinitionSubsystem.generated.h"
+
+class UDataTable;
+
+/**
+ * 레지스트리가 소유하는 정의 1개
+ * - Row 는 데이터테이블 내부 행을 가리키며, 테이블이 리임포트/수정되면 레지스트리가 다시 잡아 줌
+ * - 레지스트리가 없을 때(에디터 프리뷰 등)는 Detached 사본을 가리킴
+ */
+struct FItemDefinitionSlot
+{
+    const FItemRow* Row = nullptr;
+    TUniquePtr<FItemRow> Detached;
+};
+
+/**
+ * 공유 아이템 정의(FItemRow)에 대한 가벼운 핸들
+ * - 행 데이터를 복사하지 않고 레지스트리의 슬롯을 통해 데이터테이블 행을 참조 (행 포인터를 직접 들고 있지 않음)
+ * - 행이 없으면 빈 기본 행을 반환하므로 호출부에서 null 체크 불필요
+ */
+struct NON_API FItemDefinitionHandle
+{
+    FItemDefinitionHandle() = default;
+    explicit FItemDefinitionHandle(TSharedPtr<const FItemDefinitionSlot> InSlot) : Slot(MoveTemp(InSlot)) {}
+
+    bool IsValid() const { return Slot.IsValid() && Slot->Row != nullptr; }
+
+    const FItemRow& Get() const { return IsValid() ? *Slot->Row : GetEmptyRow(); }
+    const FItemRow* operator->() const { return &Get(); }
+
+    static const FItemRow& GetEmptyRow();
+
+private:
+    TSharedPtr<const FItemDefinitionSlot> Slot;
+};
+
+/**
+ * 아이템 정의 레지스트리
+ * - ItemDataTable 을 게임 인스턴스 단위로 한 번만 색인하고, 모든 아이템 인스턴스가 같은 행을 공유
+ * - 인벤토리/장비/상점/툴팁은 FindRow 대신 이 핸들을 통해 읽음
+ * - 등록된 테이블이 바뀌면(리임포트, 에디터 수정) 다시 색인하므로 기존 핸들도 새 행을 보게 됨
+ */
+UCLASS()
+class NON_API UItemDefinitionSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** 월드 컨텍스트로부터 서브시스템 획득 (게임 인스턴스가 없으면 nullptr) */
+    static UItemDefinitionSubsystem* Get(const UObject* WorldContextObject);
+
+    /** 데이터테이블을 레지스트리에 등록 (이미 등록된 테이블이면 무시) */
+    void RegisterTable(UDataTable* Table);
+
+    /** ItemId 로 공유 정의 핸들 조회 (Table 이 아직 등록되지 않았으면 먼저 등록) */
+    FItemDefinitionHandle FindDefinition(FName ItemId, UDataTable* Table = nullptr);
+
+    /**
+     * 서브시스템 유무와 관계없이 핸들 획득
+     * - 게임 인스턴스가 없는 경우(에디터 프리뷰, CDO 등) 테이블 행을 직접 가리킴
+     */
+    static FItemDefinitionHandle Resolve(const UObject* WorldContextObject, FName ItemId, UDataTable* Table);
+
+    UFUNCTION(BlueprintPure, Category = "Item")
+    int32 GetNumDefinitions() const { return Definitions.Num(); }
+
+private:
+    // 테이블 1개의 행을 색인 (이미 다른 테이블이 채운 ItemId 는 건드리지 않음)
+    void IndexTable(const UDataTable* Table);
+
+    // 등록된 테이블 중 하나가 바뀌면 전체 재색인 (행 메모리가 새로 할당됨)
+    void HandleTableChanged();
+
+    // 색인된 테이블 (행 메모리 수명 보장용)
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UDataTable>> RegisteredTables;
+
+    // ItemId -> 정의 슬롯 (먼저 등록된 테이블 우선, 재색인 시에도 슬롯은 유지)
+    TMap<FName, TSharedRef<FItemDefinitionSlot>> Definitions;
+};
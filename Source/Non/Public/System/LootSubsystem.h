@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "LootSubsystem.generated.h"
+
+class UEnemyDataAsset;
+class UInventoryComponent;
+
+/** 굴림 결과 1건 */
+struct FLootDrop
+{
+    FName ItemId;
+    int32 Count = 0;
+};
+
+/**
+ * 드롭 테이블 1묶음 (최대 MaxEntries 개 항목)
+ * - 항목별 독립 확률의 모든 조합(2^N)을 결과로 보는 앨리어스 테이블
+ * - 난수 하나로 "이번에 떨어질 항목 비트마스크"를 O(1) 에 뽑음 (항목별 굴림과 분포 동일)
+ */
+struct FLootAliasChunk
+{
+    static constexpr int32 MaxEntries = 8;
+
+    int32 FirstEntry = 0;
+    int32 NumEntries = 0;
+
+    // 결과(비트마스크)별 자기 자신을 채택할 확률 / 아니면 넘어갈 결과
+    TArray<float> Prob;
+    TArray<uint8> Alias;
+
+    uint32 Sample(float U) const;
+};
+
+/** 적 데이터 에셋 1개분 컴파일된 드롭 테이블 */
+struct FCompiledLootTable
+{
+    // 확률 0 을 제외한 항목 (확률 1 인 항목은 앞쪽 AlwaysCount 개)
+    struct FEntry
+    {
+        FName ItemId;
+        int32 MinCount = 1;
+        int32 MaxCount = 1;
+    };
+
+    TArray<FEntry> Entries;
+    int32 AlwaysCount = 0;
+    TArray<FLootAliasChunk> Chunks;
+
+    void Build(const UEnemyDataAsset& Data);
+    void Roll(TArray<FLootDrop>& OutDrops) const;
+};
+
+/**
+ * 서버 드롭 판정
+ * - 적 데이터 에셋의 DropList 를 처음 쓰일 때(적 스폰 시) 앨리어스 테이블로 미리 컴파일
+ * - 처치 1회당 굴림은 묶음당 난수 하나, 결과는 픽업 액터 없이 처치자 인벤토리에 트랜잭션 한 번으로 지급
+ */
+UCLASS()
+class NON_API ULootSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    static ULootSubsystem* Get(const UObject* WorldContextObject);
+
+    /** 드롭 테이블 미리 컴파일 (이미 있으면 무시) */
+    const FCompiledLootTable* Precompile(const UEnemyDataAsset* Data);
+
+    /** 드롭 굴림 (결과를 OutDrops 에 추가) */
+    void RollLoot(const UEnemyDataAsset* Data, TArray<FLootDrop>& OutDrops);
+
+    /**
+     * 굴림 + 지급
+     * @return 지급된 항목 수 (인벤토리가 가득 차 못 받은 것은 제외)
+     */
+    int32 GrantLoot(const UEnemyDataAsset* Data, UInventoryComponent* Inventory);
+
+private:
+    TMap<TObjectKey<UEnemyDataAsset>, FCompiledLootTable> Tables;
+};
@@ -2,7 +2,6 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/SaveGame.h"
-#include "GameFramework/SaveGame.h"
 #include "Skill/SkillTypes.h"
 #include "Inventory/ItemEnums.h"
 #include "NonSaveGame.generated.h"
@@ -20,6 +19,15 @@ struct FInventorySaveData
 
     UPROPERTY(SaveGame, BlueprintReadWrite)
     int32 Quantity = 0;
+
+    // [New] 인스턴스별 강화 수치
+    UPROPERTY(SaveGame, BlueprintReadWrite)
+    int32 EnhancementLevel = 0;
+
+    bool operator==(const FInventorySaveData& Other) const
+    {
+        return ItemId == Other.ItemId && Quantity == Other.Quantity && EnhancementLevel == Other.EnhancementLevel;
+    }
 };
 
 /**
@@ -38,6 +46,11 @@ struct FQuickSlotSaveData
 
     UPROPERTY(SaveGame, BlueprintReadWrite)
     FName SkillId = NAME_None;
+
+    bool operator==(const FQuickSlotSaveData& Other) const
+    {
+        return SlotIndex == Other.SlotIndex && ItemId == Other.ItemId && SkillId == Other.SkillId;
+    }
 };
 
 /**
@@ -56,10 +69,47 @@ struct FEquipmentSaveData
 
     UPROPERTY(SaveGame, BlueprintReadWrite)
     int32 Quantity = 1;
+
+    // [New] 인스턴스별 강화 수치
+    UPROPERTY(SaveGame, BlueprintReadWrite)
+    int32 EnhancementLevel = 0;
+
+    bool operator==(const FEquipmentSaveData& Other) const
+    {
+        return Slot == Other.Slot && ItemId == Other.ItemId && Quantity == Other.Quantity && EnhancementLevel == Other.EnhancementLevel;
+    }
+};
+
+/**
+ * 바이너리 세이브 섹션 (섹션 단위로 인코딩/캐시)
+ */
+enum class ENonSaveSection : uint8
+{
+    Items,
+    Skills,
+    Equipment,
+    QuickSlots,
+    Num
+};
+
+/**
+ * 세이브 스키마 버전
+ * - Legacy: 기존 USaveGame 태그 프로퍼티 직렬화
+ * - Sections: 헤더 + 섹션별 길이 접두 바이너리
+ */
+enum class ENonSaveSchemaVersion : int32
+{
+    Legacy = 0,
+    Sections = 1,
+
+    LatestPlusOne,
+    Latest = LatestPlusOne - 1
 };
 
 /**
  * 게임 저장 데이터 클래스
+ * - 파일에는 버전 헤더 + 섹션(아이템/스킬/장비/퀵슬롯) 단위의 압축 바이너리로 기록
+ * - 변경되지 않은 섹션은 이전 인코딩 결과(EncodedSections)를 그대로 재사용
  */
 UCLASS()
 class NON_API UNonSaveGame : public USaveGame
@@ -107,4 +157,32 @@ public:
     /* 장비 데이터 */
     UPROPERTY(SaveGame, BlueprintReadWrite, Category = "Equipment")
     TArray<FEquipmentSaveData> EquippedItems;
+
+    /** 로드된 파일의 스키마 버전 (마이그레이션 판단용) */
+    UPROPERTY(Transient, BlueprintReadOnly, Category = "Save")
+    int32 SchemaVersion = static_cast<int32>(ENonSaveSchemaVersion::Latest);
+
+    /**
+     * 로드 실패 여부 (더 최신 스키마, 섹션 디코딩 실패, 아카이브 오류)
+     * - LoadGameFromSlot/LoadGameFromMemory 는 아카이브 오류를 확인하지 않고 기본값 객체를 돌려주므로 반드시 확인
+     */
+    UPROPERTY(Transient, BlueprintReadOnly, Category = "Save")
+    bool bLoadFailed = false;
+
+    /** 섹션별 인코딩 결과 (비어 있으면 저장 시 인코딩) */
+    TArray<uint8> EncodedSections[static_cast<int32>(ENonSaveSection::Num)];
+
+    virtual void Serialize(FArchive& Ar) override;
+
+    /** 섹션 데이터를 바이너리로 인코딩하여 EncodedSections 에 저장 */
+    void EncodeSection(ENonSaveSection Section);
+
+    /** 다른 세이브 객체와 섹션 데이터가 같은지 비교 (Dirty 판단용) */
+    bool IsSectionDataEqual(ENonSaveSection Section, const UNonSaveGame& Other) const;
+
+    /** 다른 세이브 객체의 섹션 데이터와 인코딩 결과를 복사 */
+    void CopySectionFrom(ENonSaveSection Section, const UNonSaveGame& Other);
+
+private:
+    bool DecodeSection(ENonSaveSection Section, const TArray<uint8>& Bytes, int32 Version);
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "System/NonSaveGame.h"
+#include "Async/Future.h"
 #include "SaveGameSubsystem.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGameSaved, bool, bSuccess);
@@ -20,14 +21,35 @@ public:
     // 저장 슬롯 이름 (하나만 사용)
     static const FString DefaultSlotName;
 
-    /** 현재 게임 상태를 파일에 저장 */
+    virtual void Deinitialize() override;
+
+    /** 현재 게임 상태를 파일에 저장 (동기, 종료/맵 이동 시 사용) */
     UFUNCTION(BlueprintCallable, Category = "SaveSystem")
     void SaveGame();
 
+    /**
+     * 비동기 저장 (전투 중 자동 저장용)
+     * - 게임 스레드는 스냅샷 복사만, 직렬화와 세이브 시스템 쓰기는 워커 스레드 (임시 슬롯에 쓴 뒤 교체, 동기 저장과 같은 슬롯)
+     * - 완료 시 게임 스레드에서 OnGameSaved 호출
+     */
+    UFUNCTION(BlueprintCallable, Category = "SaveSystem")
+    void SaveGameAsync();
+
     /** 파일에서 게임 상태를 로드하여 적용 */
     UFUNCTION(BlueprintCallable, Category = "SaveSystem")
     void LoadGame();
 
+    /** 비동기 로드: 세이브 시스템 읽기는 워커 스레드, 적용과 OnGameLoaded 는 게임 스레드 (저장 중이면 완료 후 시작) */
+    UFUNCTION(BlueprintCallable, Category = "SaveSystem")
+    void LoadGameAsync();
+
+    UFUNCTION(BlueprintPure, Category = "SaveSystem")
+    bool IsSaveInProgress() const { return bSaveInFlight; }
+
+    /** 마지막 비동기 저장에서 게임 스레드가 소비한 시간 (ms) */
+    UFUNCTION(BlueprintPure, Category = "SaveSystem")
+    float GetLastSaveGameThreadMs() const { return LastSaveGameThreadMs; }
+
     /** 저장된 게임 데이터를 삭제 (초기화) */
     UFUNCTION(BlueprintCallable, Category = "SaveSystem")
     void DeleteSaveGame();
@@ -37,4 +59,35 @@ public:
 
     UPROPERTY(BlueprintAssignable)
     FOnGameLoaded OnGameLoaded;
+
+private:
+    /** 현재 플레이어 상태를 세이브 객체로 복사 (게임 스레드) */
+    UNonSaveGame* CaptureSnapshot() const;
+
+    /** 로드된 세이브 객체를 플레이어에게 적용 (게임 스레드) */
+    bool ApplyLoadedSave(UNonSaveGame* LoadInst);
+
+    /** 이전 저장과 내용이 같은 섹션은 캐시된 인코딩 결과를 재사용 (게임 스레드) */
+    void ReuseCleanSections(UNonSaveGame* Snapshot) const;
+
+    /** 저장에 성공한 스냅샷의 섹션 데이터/인코딩 결과를 캐시 */
+    void UpdateSectionCache(const UNonSaveGame* Saved);
+
+    FString GetTargetSlotName() const;
+    void WaitForPendingSave();
+    void HandleAsyncSaveFinished(bool bSuccess);
+
+    // 워커 스레드가 직렬화 중인 스냅샷 (GC 방지)
+    UPROPERTY(Transient)
+    TObjectPtr<UNonSaveGame> InFlightSnapshot;
+
+    // 마지막으로 저장된 섹션 데이터 + 인코딩 결과 (Dirty 판단용)
+    UPROPERTY(Transient)
+    TObjectPtr<UNonSaveGame> SectionCache;
+
+    TFuture<void> PendingSaveTask;
+    bool bSaveInFlight = false;
+    bool bSaveQueued = false;
+    bool bLoadQueued = false;
+    float LastSaveGameThreadMs = 0.f;
 };
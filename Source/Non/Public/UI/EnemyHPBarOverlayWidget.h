@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "EnemyHPBarOverlayWidget.generated.h"
+
+class UEnemyHPBarSubsystem;
+
+/**
+ * 적 HP바 전체를 한 번에 그리는 화면 오버레이
+ * - 자식 위젯 없이 NativePaint 에서 바마다 배경/채움 박스 두 개만 그림
+ * - 스타일(색/크기)은 적별 HPBarStyleClass 기본값 (항목에 복사되어 있음)
+ */
+UCLASS()
+class NON_API UEnemyHPBarOverlayWidget : public UUserWidget
+{
+    GENERATED_BODY()
+
+public:
+    void SetSource(UEnemyHPBarSubsystem* InSource) { Source = InSource; }
+
+protected:
+    virtual void NativeConstruct() override;
+    virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+        FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+private:
+    TWeakObjectPtr<UEnemyHPBarSubsystem> Source;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "EnemyHPBarSubsystem.generated.h"
+
+class AEnemyCharacter;
+class APlayerController;
+class UEnemyHPBarOverlayWidget;
+
+/** 오버레이가 그릴 HP바 1개 */
+struct FEnemyHPBarEntry
+{
+    TWeakObjectPtr<const AEnemyCharacter> Enemy;
+    TObjectKey<AEnemyCharacter> Key;
+    float Ratio = 1.f;
+
+    // 적별 스타일 (등록 시 AEnemyCharacter::GetHPBarStyle 에서 복사)
+    FLinearColor FillColor = FLinearColor::Red;
+    FLinearColor BackgroundColor = FLinearColor::Black;
+    FVector2D BarSize = FVector2D(120.f, 12.f);
+
+    // 뷰포트 픽셀 좌표 (변경 감지용) / 오버레이 로컬 좌표 (그리기용)
+    FIntPoint Pixel = FIntPoint(MIN_int32, MIN_int32);
+    FVector2D LocalPosition = FVector2D::ZeroVector;
+    bool bOnScreen = false;
+};
+
+/**
+ * 클라이언트 적 HP바 레이어
+ * - 적마다 UWidgetComponent(위젯 트리)를 두던 것을 대체: HUD 아래 오버레이 위젯 하나가 모든 바를 그림
+ * - 표시 중인 적만 {적, HP 비율, 화면 좌표} 배열로 관리
+ * - 거리/렌더링 여부로 컬링하고, HP 가 바뀌거나 투영 픽셀이 바뀐 프레임에만 다시 그림
+ * - 데디케이티드 서버에서는 생성되지 않음
+ */
+UCLASS()
+class NON_API UEnemyHPBarSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** HP바 표시/숨김 (표시할 때 현재 HP 비율도 함께 전달) */
+    static void SetBarVisible(const AEnemyCharacter* Enemy, bool bVisible, float Ratio);
+
+    /** HP 비율 갱신 (표시 중이 아니면 무시) */
+    static void SetBarRatio(const AEnemyCharacter* Enemy, float Ratio);
+
+    /** 카메라에서 이 거리(cm) 밖의 바는 그리지 않음 */
+    float MaxDrawDistance = 3000.f;
+
+    /** 이 시간(초) 안에 렌더링되지 않은 적(가려짐/화면 밖)의 바는 그리지 않음 */
+    float VisibleTolerance = 0.2f;
+
+    const TArray<FEnemyHPBarEntry>& GetEntries() const { return Entries; }
+
+    UFUNCTION(BlueprintPure, Category = "HPBar")
+    int32 GetNumBars() const { return Entries.Num(); }
+
+private:
+    static UEnemyHPBarSubsystem* Find(const AEnemyCharacter* Enemy);
+
+    void RemoveAt(int32 Index);
+    void EnsureOverlay(APlayerController* PC);
+    void MarkDirty() { bDirty = true; }
+
+    TArray<FEnemyHPBarEntry> Entries;
+    TMap<TObjectKey<AEnemyCharacter>, int32> IndexByEnemy;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UEnemyHPBarOverlayWidget> Overlay;
+
+    bool bDirty = false;
+};
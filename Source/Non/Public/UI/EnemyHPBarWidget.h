@@ -23,6 +23,11 @@ public:
 
     virtual void NativeConstruct() override;
 
+    // 공용 HP바 오버레이가 스타일 원본으로 사용
+    const FLinearColor& GetFillColor() const { return FillColor; }
+    const FLinearColor& GetBackgroundColor() const { return BackgroundColor; }
+    FVector2D GetBarSize() const { return FVector2D(Width, Height); }
+
 protected:
     UPROPERTY(meta = (BindWidgetOptional))
     TObjectPtr<UProgressBar> Bar = nullptr;
@@ -12,6 +12,7 @@ class UImage;
 class UTextBlock;
 class UBorder;
 class UMaterialInstanceDynamic;
+class UTexture2D;
 
 UCLASS()
 class NON_API UInventorySlotWidget : public UUserWidget
@@ -19,8 +20,12 @@ class NON_API UInventorySlotWidget : public UUserWidget
     GENERATED_BODY()
 
 public:
+    /**
+     * @param bBindInventoryEvents false 면 슬롯/전체 갱신 델리게이트를 직접 구독하지 않음
+     *        (UInventoryWidget 처럼 소유 위젯이 인덱스별로 갱신을 전달하는 경우)
+     */
     UFUNCTION(BlueprintCallable, Category = "Inventory")
-    void InitSlot(UInventoryComponent* InInventory, int32 InIndex);
+    void InitSlot(UInventoryComponent* InInventory, int32 InIndex, bool bBindInventoryEvents = true);
 
     UFUNCTION()
     void HandleSlotUpdated(int32 UpdatedIndex, UInventoryItem* UpdatedItem);
@@ -151,6 +156,9 @@ private:
 
     void UpdateVisual();
 
+    // 아이콘 브러시 교체 (nullptr 이면 로드 완료 전 플레이스홀더로 숨김)
+    void SetIconTexture(UTexture2D* IconTex);
+
     bool bDragArmed = false;
     bool bDraggingItemActive = false;
 
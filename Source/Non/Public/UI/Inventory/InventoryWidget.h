@@ -50,6 +50,7 @@ public:
 protected:
     virtual void NativeConstruct() override;
     virtual void NativeDestruct() override;
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     virtual bool NativeOnDragOver(const FGeometry& InGeometry, const FDragDropEvent& InDragDropEvent,
         UDragDropOperation* InOperation) override;
@@ -64,9 +65,18 @@ private:
     /** 현재 연결된 인벤토리 */
     UPROPERTY() TObjectPtr<UInventoryComponent> InvRef;
 
-    /** 생성된 슬롯 위젯 캐시 */
+    /** 생성된 슬롯 위젯 캐시 (인덱스 = 인벤토리 슬롯 인덱스) */
     UPROPERTY() TArray<TObjectPtr<UInventorySlotWidget>> Slots;
 
+    /** [New] 이번 프레임에 갱신할 슬롯 (NativeTick 에서 한 번에 처리) */
+    TBitArray<> DirtySlots;
+
+    /** [New] 전체 리프레시 요청이 있었는지 (개별 슬롯 갱신을 대체) */
+    bool bFullRefreshPending = false;
+
+    /** [New] 모아둔 갱신 요청을 한 번에 처리 */
+    void FlushPendingRefresh();
+
     /** 슬롯 UI 구성 */
     void InitSlots();
     /** 기존 슬롯 UI 제거 */
@@ -97,6 +107,9 @@ private:
     /** [New] 현재 설정된 필터를 모든 슬롯 위젯에 일괄 비주얼 적용 */
     void ApplyFilter();
 
+    /** [New] 슬롯 하나에만 현재 필터 적용 */
+    void ApplyFilterToSlot(UInventorySlotWidget* SlotWidget) const;
+
     /** [New] 필터링이 활성화되어 있는지 여부 */
     UPROPERTY()
     bool bIsFilterActive = false;
@@ -10,6 +10,7 @@ class URichTextBlock;
 class UImage;
 class UBorder;
 class UInventoryItem;
+class UTexture2D;
 
 UCLASS()
 class NON_API UItemToolTipWidget : public UUserWidget
@@ -101,4 +102,10 @@ public:
     /** [New] 자신이 비교용 서브 팝업 패널인지 여부 (재귀 무한 루프 차단 안전 제어 장치) */
     UPROPERTY(BlueprintReadWrite, Category = "Inventory|ToolTip")
     bool bIsComparePanel = false;
+
+private:
+    /** 아이콘 비동기 로드 완료 시 아직 같은 아이템을 보여주는지 확인용 */
+    TWeakObjectPtr<UInventoryItem> DisplayedItem;
+
+    void SetIconTexture(UTexture2D* IconTex);
 };